@@ -1,5 +1,5 @@
 // Example: simple generation of normally distributed random numbers
-// in C++ (C++20)
+// in C++ (C++20), using the engine classes of `randommw.hpp`
 //
 // This program produces output identical to `example_randommw.c`.
 //
@@ -8,17 +8,18 @@
 
 #include <iostream>
 #include <format>
-#include "randommw.h"
+#include "randommw.hpp"
 
 int main(void) {
 	unsigned int i;
 	uint64_t zigseed = 10;
 	double rval;
-		
-	RanInit("", zigseed, 0);
+	
+	randommw::mwc8222 eng(zigseed);
+	randommw::zignor_normal<randommw::mwc8222> normal;
 	
 	for(i = 0; i < 20; i++)	{
-		rval = DRanNormalZig();
+		rval = normal(eng);
 		std::cout << std::format("{:10.6f}\n", rval);
 	}
 	
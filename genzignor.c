@@ -4,6 +4,31 @@ genzignor.c
 
 Generate a binary file containing normally N(0,1) distributed random numbers
 
+Without the '-j' option, all numbers are taken from a single stream of the
+generator (RanInit(sRan, seed, 0)), as in previous versions.
+
+With '-j N', the output is divided into blocks of GENZIGNOR_BLOCK numbers,
+which are generated in parallel by N threads. Block b contains the first
+numbers of the stream obtained with RanInit(sRan, seed, b), i.e. the
+generator is positioned by 'b' jumps (for MWC8222 and Lehmer64, by 
+forwarding their Splitmix64 initialization). The output file therefore does
+not depend on the number of threads: any N >= 1 gives the same file.
+
+The output is streamed through a ring of buffers of GENZIGNOR_BLOCK numbers
+each ('-b' option). The generator thread(s) fill free buffers, while the
+main thread writes the completed buffers to the file in order. Memory use
+is therefore fixed (Nbuffers * 8 MiB), independent of the file size, and
+generation and file output overlap.
+
+By default, the numbers are preceded by a header of ZIGFILE_HEADER_SIZE bytes
+that describes the file (see genzignor.h), including a checksum of the
+numbers. '-f raw' writes the numbers only, as in previous versions.
+
+The numbers are written as float64 (double, DRanNormalZigVec), or with 
+'-t float32' as float32 (float, FRanNormalZigVec), which halves the file
+size and the use of the uniform RNG. The float32 numbers are generated 
+directly in single precision, and are not the float64 numbers rounded.
+
 */
 
 #include <stdint.h>
@@ -11,68 +36,436 @@ Generate a binary file containing normally N(0,1) distributed random numbers
 #include <stdlib.h>
 #include <stdio.h>
 #include <string.h>
+#include <time.h>
+#include <pthread.h>
 
 #include "randommw.h"
+#include "genzignor.h"
 
 #define FNAMEMAX 63
+#define RANNAMEMAX 31
+#define THREADSMAX 256
+#define BUFFERSMAX 4096
+
+/* Number of samples per block (and per ring buffer). In multi-threaded
+   ('-j') mode, changing this changes the contents of the output file. */
+#define GENZIGNOR_BLOCK ((uint64_t)1 << 20)
+
+/* Ring of output buffers, shared by the generator threads and the writer */
+typedef struct
+{
+	pthread_mutex_t mutex;
+	pthread_cond_t cond;
+	int nbuf;
+	void **apBuf;
+	size_t uElemSize;	// sizeof(double) or sizeof(float)
+	uint64_t *auBlock;	// block stored in buffer (ready for output)
+	uint64_t uWritten;	// number of blocks written to file
+	uint64_t uBlocks;	// total number of blocks in file
+	uint64_t uSamples;	// total number of samples in file
+	ZIGFILESUM sum;		// checksum of blocks written
+	int bAbort;
+} GENRING;
+
+typedef struct
+{
+	RANSTATE ran;		// generator state of this thread
+	uint64_t uSeed;
+	uint64_t uFirst;	// first block of this thread
+	uint64_t uStride;	// number of threads
+	int bSingleStream;	// continue one stream instead of positioning blocks
+	int bReseed;		// position blocks with RanSeedJump_r, not by jumps
+	double dTime;		// time spent generating numbers
+	GENRING *pRing;
+} GENBLOCKS;
+
+#define NO_BLOCK UINT64_MAX
+
+static double WallTime(void)
+{
+	struct timespec ts;
+
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return ts.tv_sec + 1e-9 * ts.tv_nsec;
+}
+
+/* Generate blocks uFirst, uFirst + uStride, uFirst + 2*uStride, ...
+
+   Block b goes into ring buffer b % nbuf, once block b - nbuf has been
+   written. For generators for which RanSeedJump_r() is RanSetSeed_r() 
+   followed by jumps, a copy of the state at the start of the current block
+   is kept, which is moved to the next block of this thread by uStride 
+   jumps. The other generators (MWC8222 and Lehmer64, which forward their
+   initializing Splitmix64 generator instead, see randommw.h) are re-seeded
+   for each block with RanSeedJump_r(). In single-stream mode, there is only one
+   generator thread, and its stream simply continues from block to block.
+*/
+static void *GenerateBlocks(void *arg)
+{
+	GENBLOCKS *pGen = (GENBLOCKS *)arg;
+	GENRING *pRing = pGen->pRing;
+	uint64_t b, n;
+	RANSTATE *pBase = NULL;
+	int k, bAbort;
+	double dt;
+
+	pGen->dTime = 0.0;
+	if (!pGen->bSingleStream && !pGen->bReseed)
+	{
+		pBase = malloc(sizeof(*pBase));
+		if (pBase == NULL)
+		{
+			printf("ERROR. Cannot allocate generator state.\n");
+			pthread_mutex_lock(&pRing->mutex);
+			pRing->bAbort = 1;
+			pthread_cond_broadcast(&pRing->cond);
+			pthread_mutex_unlock(&pRing->mutex);
+			return NULL;
+		}
+		RanSeedJump_r(&pGen->ran, pGen->uSeed, pGen->uFirst);
+		*pBase = pGen->ran;
+	}
+
+	for (b = pGen->uFirst; b < pRing->uBlocks; b += pGen->uStride)
+	{
+		k = b % pRing->nbuf;
+
+		// wait for the buffer to become free
+		pthread_mutex_lock(&pRing->mutex);
+		while (!pRing->bAbort && (b >= pRing->uWritten + pRing->nbuf))
+			pthread_cond_wait(&pRing->cond, &pRing->mutex);
+		bAbort = pRing->bAbort;
+		pthread_mutex_unlock(&pRing->mutex);
+		if (bAbort)
+			break;
+
+		dt = WallTime();
+		if (pGen->bSingleStream)
+			;
+		else if (pBase == NULL)
+			RanSeedJump_r(&pGen->ran, pGen->uSeed, b);
+		else if (b != pGen->uFirst)
+		{
+			RanJumpRan_r(pBase, pGen->uStride);
+			pGen->ran = *pBase;
+		}
+
+		n = pRing->uSamples - b * GENZIGNOR_BLOCK;
+		if (n > GENZIGNOR_BLOCK)
+			n = GENZIGNOR_BLOCK;
+		if (pRing->uElemSize == sizeof(float))
+			FRanNormalZigVec_r(&pGen->ran, pRing->apBuf[k], n);
+		else
+			DRanNormalZigVec_r(&pGen->ran, pRing->apBuf[k], n);
+		pGen->dTime += WallTime() - dt;
+
+		pthread_mutex_lock(&pRing->mutex);
+		pRing->auBlock[k] = b;
+		pthread_cond_broadcast(&pRing->cond);
+		pthread_mutex_unlock(&pRing->mutex);
+	}
+
+	free(pBase);
+	return NULL;
+}
+
+/* Write all blocks to file in order, as they become ready.
+   Returns the time spent in file output, or a negative value on error,
+   including an abort by a generator thread. */
+static double WriteBlocks(GENRING *pRing, FILE *fp)
+{
+	uint64_t b, n;
+	int k, bAbort;
+	double dt, dTime = 0.0;
+
+	for (b = 0; b < pRing->uBlocks; b++)
+	{
+		k = b % pRing->nbuf;
+
+		pthread_mutex_lock(&pRing->mutex);
+		while (!pRing->bAbort && (pRing->auBlock[k] != b))
+			pthread_cond_wait(&pRing->cond, &pRing->mutex);
+		bAbort = pRing->bAbort;
+		pthread_mutex_unlock(&pRing->mutex);
+		if (bAbort)
+		{
+			dTime = -1.0;
+			break;
+		}
+
+		n = pRing->uSamples - b * GENZIGNOR_BLOCK;
+		if (n > GENZIGNOR_BLOCK)
+			n = GENZIGNOR_BLOCK;
+		dt = WallTime();
+		ZigFileSumAdd(&pRing->sum, pRing->apBuf[k], n * pRing->uElemSize);
+		if (fwrite(pRing->apBuf[k], pRing->uElemSize, n, fp) != n)
+			dTime = -1.0;
+		else
+			dTime += WallTime() - dt;
+
+		pthread_mutex_lock(&pRing->mutex);
+		if (dTime < 0.0)
+			pRing->bAbort = 1;
+		pRing->auBlock[k] = NO_BLOCK;
+		pRing->uWritten = b + 1;
+		pthread_cond_broadcast(&pRing->cond);
+		pthread_mutex_unlock(&pRing->mutex);
+		if (dTime < 0.0)
+			break;
+	}
+
+	return dTime;
+}
 
 int main(int argc, char **argv)
 {
 	char fname[FNAMEMAX+1];
+	char sRan[RANNAMEMAX+1] = "";
 	union
 	{
 		int64_t int64;
 		uint64_t uint64;
 	} zigseed, Nsamples;
-	uint64_t i;
-	double *dbuf;
+	int iarg, nthreads = 0, ngen, nbuf = 0, t, nstarted, bRaw = 0, bFloat = 0;
+	double dtWall, dtGen, dtOut;
 	FILE *fp;
-	
-	switch(argc)
+	ZIGFILEHEADER hdr;
+	GENRING ring;
+	GENBLOCKS *gen;
+	pthread_t *threads;
+
+	for (iarg = 1; (iarg < argc) && (argv[iarg][0] == '-'); iarg += 2)
 	{
-		case 4:
-			zigseed.int64 = atoll(argv[1]);
-			Nsamples.int64 = atoll(argv[2]);
-			if (Nsamples.int64 < 0)
-				Nsamples.int64 = 0;
-			strncpy(fname, argv[3], FNAMEMAX);
+		if (iarg + 1 >= argc)
+			break;
+		if (strcmp(argv[iarg], "-j") == 0)
+			nthreads = atoi(argv[iarg + 1]);
+		else if (strcmp(argv[iarg], "-b") == 0)
+			nbuf = atoi(argv[iarg + 1]);
+		else if (strcmp(argv[iarg], "-f") == 0)
+		{
+			if (strcmp(argv[iarg + 1], "raw") == 0)
+				bRaw = 1;
+			else if (strcmp(argv[iarg + 1], "zgn") == 0)
+				bRaw = 0;
+			else
+				break;
+		}
+		else if (strcmp(argv[iarg], "-t") == 0)
+		{
+			if (strcmp(argv[iarg + 1], "float32") == 0)
+				bFloat = 1;
+			else if (strcmp(argv[iarg + 1], "float64") == 0)
+				bFloat = 0;
+			else
+				break;
+		}
+		else if (strcmp(argv[iarg], "-r") == 0)
+		{
+			strncpy(sRan, argv[iarg + 1], RANNAMEMAX);
+			sRan[RANNAMEMAX] = '\0';
+		}
+		else
 			break;
-		default:
-			printf("ERROR. Unexpected number of arguments.\n");
-			printf("usage: %s <seed> <Nsamples> <filename>\n", argv[0]);
-			return(1);
 	}
 
-	printf("\nGENZIGNOR v1.0\n");
-	printf("---------------------------------------------------------\n");	
-	printf("seed (int64 -> uint64)      : %"PRId64" -> %"PRIu64"\n", 
+	if ((argc - iarg == 3) && (nthreads >= 0) && (nthreads <= THREADSMAX)
+	    && (nbuf >= 0) && (nbuf <= BUFFERSMAX))
+	{
+		zigseed.int64 = atoll(argv[iarg]);
+		Nsamples.int64 = atoll(argv[iarg + 1]);
+		if (Nsamples.int64 < 0)
+			Nsamples.int64 = 0;
+		strncpy(fname, argv[iarg + 2], FNAMEMAX);
+		fname[FNAMEMAX] = '\0';
+	}
+	else
+	{
+		printf("ERROR. Unexpected arguments.\n");
+		printf("usage: %s [-r <RNG>] [-j <Nthreads>] [-b <Nbuffers>]"
+		       " [-f zgn|raw] [-t float64|float32] <seed> <Nsamples>"
+		       " <filename>\n", argv[0]);
+		return(1);
+	}
+
+	ngen = (nthreads > 0) ? nthreads : 1;
+	if (nbuf == 0)
+		nbuf = 2 * ngen;
+	if (nbuf < 2)
+		nbuf = 2;
+
+	printf("\nGENZIGNOR v1.4\n");
+	printf("---------------------------------------------------------\n");
+	printf("seed (int64 -> uint64)      : %"PRId64" -> %"PRIu64"\n",
 	       zigseed.int64, zigseed.uint64);
 	printf("Nsamples (uint64)           : %"PRIu64"\n", Nsamples.uint64);
-	printf("output file                 : %s\n", fname);
+	printf("RNG                         : %s\n",
+	       (strlen(sRan) > 0) ? sRan : "MWC8222");
+	if (nthreads > 0)
+		printf("threads, block size         : %d, %"PRIu64"\n",
+		       nthreads, GENZIGNOR_BLOCK);
+	else
+		printf("threads, block size         : 1, single stream\n");
+	ring.uElemSize = bFloat ? sizeof(float) : sizeof(double);
+	printf("buffers                     : %d x %"PRIu64" MiB\n",
+	       nbuf, (GENZIGNOR_BLOCK * ring.uElemSize) >> 20);
+	printf("output file                 : %s (%s, %s)\n", fname,
+	       bRaw ? "raw" : "with header", bFloat ? "float32" : "float64");
 	printf("---------------------------------------------------------\n");
-	
-	RanInit("", zigseed.uint64, 0);
-	
-	dbuf = malloc(sizeof(*dbuf) * Nsamples.uint64);
-	
-	StartTimer();
-	for (i = 0; i < Nsamples.uint64; i++)
-		dbuf[i] = DRanNormalZig();
-	StopTimer();
-	
-	printf("Random generation           : %s\n", GetLapsedTime());
-	printf("---------------------------------------------------------\n");	
-	
-	StartTimer();
+
+	gen = malloc(sizeof(*gen) * ngen);
+	if (gen == NULL)
+	{
+		printf("ERROR. Cannot allocate generator states.\n");
+		return(1);
+	}
+	RanSetRan_r(&gen[0].ran, (strlen(sRan) > 0) ? sRan : "MWC8222");
+	if (gen[0].ran.fnDRanu == NULL)
+	{
+		printf("ERROR. Unknown RNG '%s'.\n", sRan);
+		free(gen);
+		return(1);
+	}
+
 	fp = fopen(fname, "wb");
-	fwrite(dbuf, sizeof(*dbuf), Nsamples.uint64, fp);	
-	fclose(fp);
-	StopTimer();
-	
-	printf("File output                 : %s\n", GetLapsedTime());
-	printf("---------------------------------------------------------\n\n");	
-	
-	free(dbuf);
-	
-	return 0;
+	if (fp == NULL)
+	{
+		printf("ERROR. Cannot open output file.\n");
+		free(gen);
+		return(1);
+	}
+
+	// From here on, all errors go to the single clean-up path at the end,
+	// which closes and removes the incomplete output file.
+	dtOut = 0.0;
+	dtWall = 0.0;
+	nstarted = 0;
+	ring.apBuf = NULL;
+	ring.auBlock = NULL;
+	threads = NULL;
+
+	// header with checksum zero, to be updated after writing the numbers
+	ZigFileInitHeader(&hdr, (strlen(sRan) > 0) ? sRan : "MWC8222",
+	                  zigseed.uint64, 0, Nsamples.uint64,
+	                  (nthreads > 0) ? GENZIGNOR_BLOCK : 0,
+	                  bFloat ? ZIGFILE_FLOAT32 : ZIGFILE_FLOAT64, ZIGFILE_NORMAL);
+	if (!bRaw && (ZigFileWriteHeader(fp, &hdr) != 0))
+	{
+		printf("ERROR. Cannot write output file.\n");
+		dtOut = -1.0;
+	}
+
+	ring.nbuf = nbuf;
+	ring.uSamples = Nsamples.uint64;
+	ring.uBlocks = (Nsamples.uint64 + GENZIGNOR_BLOCK - 1) / GENZIGNOR_BLOCK;
+	ring.uWritten = 0;
+	ring.bAbort = 0;
+	ZigFileSumInit(&ring.sum);
+	if (dtOut >= 0.0)
+	{
+		ring.apBuf = calloc(nbuf, sizeof(*ring.apBuf));
+		ring.auBlock = malloc(sizeof(*ring.auBlock) * nbuf);
+		threads = malloc(sizeof(*threads) * ngen);
+		if ((ring.apBuf == NULL) || (ring.auBlock == NULL) || (threads == NULL))
+			dtOut = -1.0;
+		for (t = 0; (dtOut >= 0.0) && (t < nbuf); t++)
+		{
+			ring.apBuf[t] = malloc(ring.uElemSize * GENZIGNOR_BLOCK);
+			if (ring.apBuf[t] == NULL)
+				dtOut = -1.0;
+			ring.auBlock[t] = NO_BLOCK;
+		}
+		if (dtOut < 0.0)
+			printf("ERROR. Cannot allocate output buffers.\n");
+	}
+
+	if (dtOut >= 0.0)
+	{
+		pthread_mutex_init(&ring.mutex, NULL);
+		pthread_cond_init(&ring.cond, NULL);
+
+		// initialize all generator states (and the shared ziggurat tables)
+		// before starting the threads
+		for (t = 0; t < ngen; t++)
+		{
+			RanInit_r(&gen[t].ran, sRan, zigseed.uint64, 0);
+			gen[t].uSeed = zigseed.uint64;
+			gen[t].uFirst = t;
+			gen[t].uStride = ngen;
+			gen[t].bSingleStream = (nthreads == 0);
+#ifdef RANDOMMW_SEEDJUMP_JUMPS
+			gen[t].bReseed = 0;
+#else
+			gen[t].bReseed = (strlen(sRan) == 0) || 
+			                 (strcmp(sRan, "MWC8222") == 0) || 
+			                 (strcmp(sRan, "Lehmer64") == 0);
+#endif
+			gen[t].pRing = &ring;
+		}
+
+		// if a thread cannot be created, its blocks will never be ready:
+		// stop the threads already started instead of waiting for them
+		dtWall = WallTime();
+		for (nstarted = 0; nstarted < ngen; nstarted++)
+			if (pthread_create(&threads[nstarted], NULL, GenerateBlocks, 
+			                   &gen[nstarted]) != 0)
+				break;
+		if (nstarted < ngen)
+		{
+			printf("ERROR. Cannot create generator threads.\n");
+			pthread_mutex_lock(&ring.mutex);
+			ring.bAbort = 1;
+			pthread_cond_broadcast(&ring.cond);
+			pthread_mutex_unlock(&ring.mutex);
+			dtOut = -1.0;
+		}
+		else
+			dtOut = WriteBlocks(&ring, fp);
+		for (t = 0; t < nstarted; t++)
+			pthread_join(threads[t], NULL);
+		if (!bRaw && (dtOut >= 0.0))
+		{
+			hdr.uChecksum = ZigFileSumGet(&ring.sum);
+			if ((fseek(fp, 0, SEEK_SET) != 0) || 
+			    (ZigFileWriteHeader(fp, &hdr) != 0))
+				dtOut = -1.0;
+		}
+		dtWall = WallTime() - dtWall;
+
+		pthread_cond_destroy(&ring.cond);
+		pthread_mutex_destroy(&ring.mutex);
+	}
+
+	if (fclose(fp) != 0)
+		dtOut = -1.0;
+	if (dtOut < 0.0)
+	{
+		printf("ERROR. File output failed, %s removed.\n", fname);
+		remove(fname);
+	}
+	else
+	{
+		dtGen = 0.0;
+		for (t = 0; t < ngen; t++)
+			dtGen += gen[t].dTime;
+		printf("Random generation           : %.3f s (%.1f Msamples/s per thread)\n",
+		       dtGen, (dtGen > 0.0) ? 1e-6 * Nsamples.uint64 / dtGen : 0.0);
+		printf("File output                 : %.3f s (%.1f MB/s)\n",
+		       dtOut, (dtOut > 0.0) ? 1e-6 * ring.uElemSize * Nsamples.uint64 / dtOut
+		                            : 0.0);
+		printf("Total (wall clock)          : %.3f s\n", dtWall);
+		if (!bRaw)
+			printf("checksum (Fletcher-64)      : %016"PRIx64"\n", hdr.uChecksum);
+	}
+	printf("---------------------------------------------------------\n\n");
+
+	if (ring.apBuf != NULL)
+		for (t = 0; t < nbuf; t++)
+			free(ring.apBuf[t]);
+	free(ring.apBuf);
+	free(ring.auBlock);
+	free(threads);
+	free(gen);
+
+	return (dtOut < 0.0);
 }
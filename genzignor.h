@@ -0,0 +1,410 @@
+/*==========================================================================
+ *  genzignor.h
+ *
+ *  File format for pre-generated random numbers written by genzignor.c
+ *  M. H. V. Werts, 2024
+ *
+ *  A genzignor file consists of a fixed-size header, followed by the
+ *  payload: the random numbers as a contiguous array of float64 (or float32)
+ *  values, in the byte order of the machine that wrote the file. The
+ *  payload starts at offset ZIGFILE_HEADER_SIZE (4096 bytes), which is a
+ *  multiple of the page size on all common systems, so that readers can
+ *  memory-map the payload directly.
+ *
+ *  Header layout (offsets in bytes, integers in file byte order):
+ *
+ *     0  char[8]   magic "ZIGNORMW"
+ *     8  uint32    format version (ZIGFILE_VERSION)
+ *    12  uint32    header size = payload offset (ZIGFILE_HEADER_SIZE)
+ *    16  uint32    byte order mark 0x01020304
+ *    20  uint32    element type (ZIGFILE_FLOAT64, ZIGFILE_FLOAT32)
+ *    24  uint32    element size in bytes
+ *    28  uint32    distribution (ZIGFILE_NORMAL, ZIGFILE_UNIFORM)
+ *    32  char[32]  name of uniform RNG, zero-terminated
+ *    64  uint64    seed
+ *    72  uint64    jump index of the first stream
+ *    80  uint64    number of samples in payload
+ *    88  uint64    block size (samples per separately positioned block,
+ *                  0 for a single stream, see genzignor.c)
+ *    96  uint64    Fletcher-64 checksum of the payload
+ *   104  uint64    Fletcher-64 checksum of header bytes 0-103
+ *   112  zero padding up to ZIGFILE_HEADER_SIZE
+ *
+ *  The checksums are Fletcher-64 sums over the data taken as 32-bit words,
+ *  with both running sums modulo 2^32 - 1, and are returned as
+ *  (sum2 << 32) | sum1.
+ *
+ *  On POSIX systems, files can be memory-mapped with ZigFileMap(), which
+ *  gives direct (zero-copy) access to the samples. A ZIGFILECURSOR hands out
+ *  consecutive, non-overlapping slices of a mapped file to several consumer
+ *  threads.
+ *==========================================================================*/
+
+#ifndef GENZIGNOR_H
+#define GENZIGNOR_H
+
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+#include <stddef.h>
+
+#if defined(__unix__) || defined(__APPLE__)
+#define ZIGFILE_MMAP
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#endif
+
+#define ZIGFILE_MAGIC        "ZIGNORMW"
+#define ZIGFILE_VERSION      1
+#define ZIGFILE_HEADER_SIZE  4096
+#define ZIGFILE_BYTEORDER    0x01020304
+
+#define ZIGFILE_FLOAT64      1
+#define ZIGFILE_FLOAT32      2
+
+#define ZIGFILE_NORMAL       1
+#define ZIGFILE_UNIFORM      2
+
+#define ZIGFILE_RANNAMEMAX   32
+
+typedef struct
+{
+	char      acMagic[8];
+	uint32_t  uVersion;
+	uint32_t  uHeaderSize;
+	uint32_t  uByteOrder;
+	uint32_t  uElemType;
+	uint32_t  uElemSize;
+	uint32_t  uDistribution;
+	char      acRan[ZIGFILE_RANNAMEMAX];
+	uint64_t  uSeed;
+	uint64_t  uJump;
+	uint64_t  uSamples;
+	uint64_t  uBlockSize;
+	uint64_t  uChecksum;
+	uint64_t  uHeaderChecksum;
+} ZIGFILEHEADER;
+
+/* Running state of a Fletcher-64 checksum */
+typedef struct
+{
+	uint64_t  uSum1;
+	uint64_t  uSum2;
+} ZIGFILESUM;
+
+/* Memory-mapped file */
+typedef struct
+{
+	ZIGFILEHEADER  hdr;
+	void          *pMap;		// start of mapping (file offset 0)
+	size_t         nMapBytes;
+	const void    *pData;		// first sample
+	uint64_t       uSamples;
+} ZIGFILEMAP;
+
+/* Hints for ZigFileMap(), may be combined */
+#define ZIGFILE_ADV_NORMAL      0
+#define ZIGFILE_ADV_SEQUENTIAL  1	// madvise(MADV_SEQUENTIAL)
+#define ZIGFILE_ADV_WILLNEED    2	// madvise(MADV_WILLNEED)
+#define ZIGFILE_ADV_HUGEPAGE    4	// madvise(MADV_HUGEPAGE), if available
+
+/* Shared cursor over the samples of a mapped file */
+typedef struct
+{
+	const ZIGFILEMAP  *pMap;
+	uint64_t           uNext;	// index of next sample to hand out
+} ZIGFILECURSOR;
+
+void      ZigFileSumInit(ZIGFILESUM *pSum);
+void      ZigFileSumAdd(ZIGFILESUM *pSum, const void *pData, size_t nBytes);
+uint64_t  ZigFileSumGet(const ZIGFILESUM *pSum);
+
+void      ZigFileInitHeader(ZIGFILEHEADER *pHdr, const char *sRan,
+                            uint64_t uSeed, uint64_t uJump, uint64_t uSamples,
+                            uint64_t uBlockSize, uint32_t uElemType,
+                            uint32_t uDistribution);
+int       ZigFileWriteHeader(FILE *fp, ZIGFILEHEADER *pHdr);
+int       ZigFileReadHeader(FILE *fp, ZIGFILEHEADER *pHdr);
+int       ZigFileVerify(const ZIGFILEHEADER *pHdr, const void *pData);
+
+#ifdef ZIGFILE_MMAP
+int       ZigFileMap(ZIGFILEMAP *pMap, const char *sFile, int iAdvice);
+void      ZigFileUnmap(ZIGFILEMAP *pMap);
+const double *ZigFileDoubles(const ZIGFILEMAP *pMap, uint64_t *puSamples);
+const float  *ZigFileFloats(const ZIGFILEMAP *pMap, uint64_t *puSamples);
+
+void      ZigFileCursorInit(ZIGFILECURSOR *pCur, const ZIGFILEMAP *pMap,
+                            uint64_t uStart);
+const void *ZigFileCursorNext(ZIGFILECURSOR *pCur, uint64_t uWant,
+                              uint64_t *puGot);
+#endif
+
+
+/*--------------------------------------------------------------------------
+ *  Fletcher-64 checksum
+ *
+ *  The sums are accumulated in 64-bit integers, and reduced modulo 2^32 - 1
+ *  every ZIGFILESUM_CHUNK words, before uSum2 can overflow. pData must
+ *  contain a whole number of 32-bit words.
+ *--------------------------------------------------------------------------*/
+#define ZIGFILESUM_MOD    0xFFFFFFFFu
+#define ZIGFILESUM_CHUNK  65536
+
+void  ZigFileSumInit(ZIGFILESUM *pSum)
+{
+	pSum->uSum1 = 0;
+	pSum->uSum2 = 0;
+}
+
+void  ZigFileSumAdd(ZIGFILESUM *pSum, const void *pData, size_t nBytes)
+{
+	const uint32_t *puData = (const uint32_t *)pData;
+	size_t i, n, nWords = nBytes / sizeof(uint32_t);
+	uint64_t s1 = pSum->uSum1, s2 = pSum->uSum2;
+
+	while (nWords > 0)
+	{
+		n = (nWords < ZIGFILESUM_CHUNK) ? nWords : ZIGFILESUM_CHUNK;
+		for (i = 0; i < n; i++)
+		{
+			s1 += puData[i];
+			s2 += s1;
+		}
+		s1 %= ZIGFILESUM_MOD;
+		s2 %= ZIGFILESUM_MOD;
+		puData += n;
+		nWords -= n;
+	}
+	pSum->uSum1 = s1;
+	pSum->uSum2 = s2;
+}
+
+uint64_t  ZigFileSumGet(const ZIGFILESUM *pSum)
+{
+	return (pSum->uSum2 << 32) | pSum->uSum1;
+}
+
+
+/*--------------------------------------------------------------------------
+ *  File header
+ *--------------------------------------------------------------------------*/
+static uint64_t ZigFileHeaderChecksum(const ZIGFILEHEADER *pHdr)
+{
+	ZIGFILESUM sum;
+
+	ZigFileSumInit(&sum);
+	ZigFileSumAdd(&sum, pHdr, offsetof(ZIGFILEHEADER, uHeaderChecksum));
+	return ZigFileSumGet(&sum);
+}
+
+/* Fill in a header. The payload checksum is set to zero, and should be
+   filled in once all samples have been written. */
+void  ZigFileInitHeader(ZIGFILEHEADER *pHdr, const char *sRan,
+                        uint64_t uSeed, uint64_t uJump, uint64_t uSamples,
+                        uint64_t uBlockSize, uint32_t uElemType,
+                        uint32_t uDistribution)
+{
+	memset(pHdr, 0, sizeof(*pHdr));
+	memcpy(pHdr->acMagic, ZIGFILE_MAGIC, sizeof(pHdr->acMagic));
+	pHdr->uVersion = ZIGFILE_VERSION;
+	pHdr->uHeaderSize = ZIGFILE_HEADER_SIZE;
+	pHdr->uByteOrder = ZIGFILE_BYTEORDER;
+	pHdr->uElemType = uElemType;
+	pHdr->uElemSize = (uElemType == ZIGFILE_FLOAT32) ? 4 : 8;
+	pHdr->uDistribution = uDistribution;
+	strncpy(pHdr->acRan, sRan, ZIGFILE_RANNAMEMAX - 1);
+	pHdr->uSeed = uSeed;
+	pHdr->uJump = uJump;
+	pHdr->uSamples = uSamples;
+	pHdr->uBlockSize = uBlockSize;
+}
+
+/* Write the header at the current file position, padded with zeros to
+   ZIGFILE_HEADER_SIZE bytes. The header checksum is updated. Returns 0 on
+   success, -1 on a write error. */
+int  ZigFileWriteHeader(FILE *fp, ZIGFILEHEADER *pHdr)
+{
+	char acBuf[ZIGFILE_HEADER_SIZE];
+
+	pHdr->uHeaderChecksum = ZigFileHeaderChecksum(pHdr);
+	memset(acBuf, 0, sizeof(acBuf));
+	memcpy(acBuf, pHdr, sizeof(*pHdr));
+	if (fwrite(acBuf, 1, sizeof(acBuf), fp) != sizeof(acBuf))
+		return -1;
+	return 0;
+}
+
+/* Validate a header: 0 if valid, -2 if not a genzignor header (or written
+   on a machine of different byte order or with a newer format version) and
+   -3 if corrupt, including an unknown element type or distribution. */
+static int ZigFileCheckHeader(const ZIGFILEHEADER *pHdr)
+{
+	if ((memcmp(pHdr->acMagic, ZIGFILE_MAGIC, sizeof(pHdr->acMagic)) != 0)
+	    || (pHdr->uByteOrder != ZIGFILE_BYTEORDER)
+	    || (pHdr->uVersion > ZIGFILE_VERSION))
+		return -2;
+	if ((pHdr->uHeaderChecksum != ZigFileHeaderChecksum(pHdr))
+	    || (pHdr->uHeaderSize < sizeof(*pHdr))
+	    || ((pHdr->uElemType != ZIGFILE_FLOAT64)
+	        && (pHdr->uElemType != ZIGFILE_FLOAT32))
+	    || (pHdr->uElemSize * 8 != ((pHdr->uElemType == ZIGFILE_FLOAT32) ? 32 : 64))
+	    || ((pHdr->uDistribution != ZIGFILE_NORMAL)
+	        && (pHdr->uDistribution != ZIGFILE_UNIFORM)))
+		return -3;
+	return 0;
+}
+
+/* Read and validate a header from the start of a file, leaving the file
+   positioned at the payload. Returns 0 on success, -1 if the file could not
+   be read, -2 if it is not a genzignor file (or was written on a machine of
+   different byte order or with a newer format version) and -3 if the header
+   is corrupt. */
+int  ZigFileReadHeader(FILE *fp, ZIGFILEHEADER *pHdr)
+{
+	int iErr;
+
+	if ((fseek(fp, 0, SEEK_SET) != 0)
+	    || (fread(pHdr, sizeof(*pHdr), 1, fp) != 1))
+		return -1;
+	iErr = ZigFileCheckHeader(pHdr);
+	if (iErr != 0)
+		return iErr;
+	if (fseek(fp, pHdr->uHeaderSize, SEEK_SET) != 0)
+		return -1;
+	return 0;
+}
+
+/* Check the samples pData against the payload checksum in the header.
+   Returns 0 if they match, -4 otherwise. */
+int  ZigFileVerify(const ZIGFILEHEADER *pHdr, const void *pData)
+{
+	ZIGFILESUM sum;
+
+	ZigFileSumInit(&sum);
+	ZigFileSumAdd(&sum, pData, pHdr->uSamples * pHdr->uElemSize);
+	return (ZigFileSumGet(&sum) == pHdr->uChecksum) ? 0 : -4;
+}
+
+
+#ifdef ZIGFILE_MMAP
+/*--------------------------------------------------------------------------
+ *  Memory-mapped access
+ *
+ *  The whole file is mapped read-only, and the samples are used in place.
+ *  Hints in iAdvice are passed on to madvise(); they only affect
+ *  performance, and failures are ignored (e.g. MADV_HUGEPAGE needs kernel
+ *  support for transparent hugepages in the page cache).
+ *--------------------------------------------------------------------------*/
+
+/* Map a genzignor file. Returns 0 on success, -1 if the file could not be
+   opened or mapped, -2 or -3 for an invalid header (see ZigFileReadHeader)
+   and -5 if the file is shorter than specified in its header. */
+int  ZigFileMap(ZIGFILEMAP *pMap, const char *sFile, int iAdvice)
+{
+	struct stat st;
+	int fd, iErr;
+	char *pc;
+
+	memset(pMap, 0, sizeof(*pMap));
+	fd = open(sFile, O_RDONLY);
+	if (fd < 0)
+		return -1;
+	if (fstat(fd, &st) != 0)
+	{
+		close(fd);
+		return -1;
+	}
+	if ((size_t)st.st_size < sizeof(ZIGFILEHEADER))
+	{
+		close(fd);
+		return -2;
+	}
+	pc = mmap(NULL, st.st_size, PROT_READ, MAP_SHARED, fd, 0);
+	close(fd);	// the mapping stays valid
+	if (pc == MAP_FAILED)
+		return -1;
+	pMap->pMap = pc;
+	pMap->nMapBytes = st.st_size;
+
+	memcpy(&pMap->hdr, pc, sizeof(pMap->hdr));
+	iErr = ZigFileCheckHeader(&pMap->hdr);
+	if ((iErr == 0) && ((pMap->nMapBytes < pMap->hdr.uHeaderSize)
+	                    || ((pMap->nMapBytes - pMap->hdr.uHeaderSize)
+	                        / pMap->hdr.uElemSize < pMap->hdr.uSamples)))
+		iErr = -5;
+	if (iErr != 0)
+	{
+		ZigFileUnmap(pMap);
+		return iErr;
+	}
+	pMap->pData = pc + pMap->hdr.uHeaderSize;
+	pMap->uSamples = pMap->hdr.uSamples;
+
+	if (iAdvice & ZIGFILE_ADV_SEQUENTIAL)
+		madvise(pc, pMap->nMapBytes, MADV_SEQUENTIAL);
+	if (iAdvice & ZIGFILE_ADV_WILLNEED)
+		madvise(pc, pMap->nMapBytes, MADV_WILLNEED);
+#ifdef MADV_HUGEPAGE
+	if (iAdvice & ZIGFILE_ADV_HUGEPAGE)
+		madvise(pc, pMap->nMapBytes, MADV_HUGEPAGE);
+#endif
+	return 0;
+}
+
+void  ZigFileUnmap(ZIGFILEMAP *pMap)
+{
+	if (pMap->pMap != NULL)
+		munmap(pMap->pMap, pMap->nMapBytes);
+	memset(pMap, 0, sizeof(*pMap));
+}
+
+/* Typed access to the samples. Returns NULL if the file contains another
+   element type. */
+const double *ZigFileDoubles(const ZIGFILEMAP *pMap, uint64_t *puSamples)
+{
+	if (pMap->hdr.uElemType != ZIGFILE_FLOAT64)
+		return NULL;
+	*puSamples = pMap->uSamples;
+	return (const double *)pMap->pData;
+}
+
+const float *ZigFileFloats(const ZIGFILEMAP *pMap, uint64_t *puSamples)
+{
+	if (pMap->hdr.uElemType != ZIGFILE_FLOAT32)
+		return NULL;
+	*puSamples = pMap->uSamples;
+	return (const float *)pMap->pData;
+}
+
+/* Cursor over the samples, starting at sample uStart */
+void  ZigFileCursorInit(ZIGFILECURSOR *pCur, const ZIGFILEMAP *pMap,
+                        uint64_t uStart)
+{
+	pCur->pMap = pMap;
+	pCur->uNext = uStart;
+}
+
+/* Hand out the next slice of (at most) uWant samples. Returns a pointer to
+   the first sample of the slice, and its length in *puGot, which is less
+   than uWant only at the end of the file. Returns NULL (and *puGot = 0) when
+   all samples have been handed out. Safe to call from several threads at
+   once: each sample is handed out exactly once, and no data is copied. */
+const void *ZigFileCursorNext(ZIGFILECURSOR *pCur, uint64_t uWant,
+                              uint64_t *puGot)
+{
+	uint64_t uFirst, uSamples = pCur->pMap->uSamples;
+
+	uFirst = __atomic_fetch_add(&pCur->uNext, uWant, __ATOMIC_RELAXED);
+	if (uFirst >= uSamples)
+	{
+		*puGot = 0;
+		return NULL;
+	}
+	*puGot = (uSamples - uFirst < uWant) ? (uSamples - uFirst) : uWant;
+	return (const char *)pCur->pMap->pData + uFirst * pCur->pMap->hdr.uElemSize;
+}
+#endif /* ZIGFILE_MMAP */
+
+#endif /* GENZIGNOR_H */
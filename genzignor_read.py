@@ -1,22 +1,101 @@
 """
-Load the raw binary generated by 'genzignor.c'
+Load a binary file generated by 'genzignor.c'
 
-This is a quick-and-dirty approach, which works on x86-64 gcc system and
-may work on other systems, if all elements (zignormw code and Python stack)
-have been compiled by similar compilers on one an the same system.
+Files with a header (the default, see 'genzignor.h') are self-describing:
+the header gives the element type, the number of samples, the generator
+and seed, and a checksum of the samples. The header is checked, and the
+samples are memory-mapped with numpy.memmap from the page-aligned payload
+offset, so that no data are read or copied until they are used (as with
+ZigFileMap() in 'genzignor.h'). Files written with '-f raw' have no header;
+they are mapped as raw float64 values in native byte order, or as float32
+with raw_dtype=np.float32 (for files written with '-t float32 -f raw').
 
 """
+import struct
 import numpy as np
 import matplotlib.pyplot as plt
 
 
+ZIGFILE_MAGIC = b"ZIGNORMW"
+ZIGFILE_VERSION = 1
+ZIGFILE_HEADER = struct.Struct("<8sIIIIII32sQQQQQQ")
+ZIGFILE_FIELDS = ("magic", "version", "header_size", "byte_order",
+                  "elem_type", "elem_size", "distribution", "ran",
+                  "seed", "jump", "samples", "block_size",
+                  "checksum", "header_checksum")
+ZIGFILE_DTYPES = {1: np.float64, 2: np.float32}
+
+
+def fletcher64(data):
+    """Fletcher-64 checksum of a bytes-like object or array (see
+    genzignor.h), computed in chunks without copying the whole data"""
+    w = np.frombuffer(data, dtype=np.uint32)
+    M = np.uint64(0xFFFFFFFF)
+    s1 = s2 = np.uint64(0)
+    C = 65536
+    for i in range(0, len(w), C):
+        c = w[i:i+C].astype(np.uint64)
+        n = np.uint64(len(c))
+        # s2 over chunk: n*s1 + sum_j (n-j)*c[j], all terms < 2**64
+        wts = np.arange(len(c), 0, -1, dtype=np.uint64)
+        s2 = (s2 + (n * s1) % M + (wts * c).sum() % M) % M
+        s1 = (s1 + c.sum()) % M
+    return int((s2 << np.uint64(32)) | s1)
+
+
+def read_header(f):
+    """Read the header of a genzignor file as a dict, or None if the file
+    has no header (raw format)."""
+    f.seek(0)
+    raw = f.read(ZIGFILE_HEADER.size)
+    if len(raw) < ZIGFILE_HEADER.size or raw[:8] != ZIGFILE_MAGIC:
+        return None
+    hdr = dict(zip(ZIGFILE_FIELDS, ZIGFILE_HEADER.unpack(raw)))
+    if hdr["byte_order"] != 0x01020304:
+        raise ValueError("file was written with different byte order")
+    if hdr["version"] > ZIGFILE_VERSION:
+        raise ValueError("unsupported file format version")
+    if fletcher64(raw[:104]) != hdr["header_checksum"]:
+        raise ValueError("corrupt header")
+    # same checks as ZigFileCheckHeader() in genzignor.h
+    dtype = ZIGFILE_DTYPES.get(hdr["elem_type"])
+    if (hdr["header_size"] < ZIGFILE_HEADER.size or dtype is None
+            or hdr["elem_size"] != np.dtype(dtype).itemsize
+            or hdr["distribution"] not in (1, 2)):
+        raise ValueError("corrupt header")
+    hdr["ran"] = hdr["ran"].split(b"\0")[0].decode()
+    return hdr
+
+
+def read_genzignor(fp, verify=False, raw_dtype=np.float64):
+    """Return (header, samples) for a genzignor file, with samples a
+    read-only numpy.memmap. For raw files, header is None, and the samples
+    are of type raw_dtype. With verify=True, the checksum of the samples is
+    checked, which reads the whole file."""
+    with open(fp, "rb") as f:
+        hdr = read_header(f)
+        f.seek(0, 2)
+        size = f.tell()
+    if hdr is None:
+        return None, np.memmap(fp, dtype=raw_dtype, mode="r")
+    if size - hdr["header_size"] < hdr["samples"] * hdr["elem_size"]:
+        raise ValueError("file is truncated")
+    data = np.memmap(fp, dtype=ZIGFILE_DTYPES[hdr["elem_type"]], mode="r",
+                     offset=hdr["header_size"], shape=(hdr["samples"],))
+    if verify:
+        if fletcher64(data) != hdr["checksum"]:
+            raise ValueError("checksum error")
+    return hdr, data
+
+
 # This points to a file generated using
 #   $ ./genzignor.exe  0 100000000 normalrandoms.bin
 fp = "normalrandoms.bin"
 
-
-with open(fp, "rb") as f:
-    norran = np.fromfile(f, dtype=np.float64) 
+hdr, norran = read_genzignor(fp, verify=True)
+if hdr is not None:
+    print("{0} samples, RNG {1}, seed {2}".format(hdr["samples"], hdr["ran"],
+                                                 hdr["seed"]))
 
 
 # Overall histogram
@@ -0,0 +1,379 @@
+/*
+
+genzigtables.c
+
+Generate the ziggurat tables of randommw.h (section F) as C source code.
+
+The tables of the normal ziggurat (ZIGNOR), the exponential ziggurat and
+McFarland's modified ziggurat are computed from the parameters defined in
+randommw.h (ZIGNOR_C, ZIGNOR_R, ZIGNOR_V, ZIGEXP_C, ZIGEXP_R, ZIGEXP_V,
+ZIGMF_L, ZIGMF_R), and written to standard output as 'static const' arrays,
+aligned to 64-byte cache lines. The output replaces the block between the
+lines "BEGIN generated by genzigtables.c" and "END generated by
+genzigtables.c" in randommw.h. Doubles are written with 17 significant
+digits (9 for floats), so that the compiled tables are bit-identical to the
+computed ones.
+
+With '-c', the tables compiled into randommw.h are compared to the
+computed tables instead. The exit status is 0 if they are identical.
+
+usage:  genzigtables [-c]
+
+*/
+
+#include <stdint.h>
+#include <inttypes.h>
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <math.h>
+
+#include "randommw.h"
+
+
+static double adZigX[ZIGNOR_C + 1], adZigR[ZIGNOR_C], adZigF[ZIGNOR_C + 1];
+static float afZigX[ZIGNOR_C + 1], afZigR[ZIGNOR_C], afZigF[ZIGNOR_C + 1];
+
+static double adZigExpX[ZIGEXP_C + 1], adZigExpR[ZIGEXP_C];
+static double adZigExpF[ZIGEXP_C + 1];
+
+static double adZigMFX[ZIGMF_L + 1], adZigMFXs[ZIGMF_L];
+static double adZigMFF[ZIGMF_L + 1];
+static int64_t aiZigMFE[ZIGMF_L + 1];
+static uint64_t auZigMFThr[256];
+static uint8_t aucZigMFAlias[256];
+static int iZigMFInfl;
+
+
+/*------------------------------ ZIGNOR ------------------------------------*/
+static void zigNorInit(int iC, double dR, double dV)
+{
+	int i;	double f;
+
+	f = exp(-0.5 * dR * dR);
+	adZigX[0] = dV / f; /* [0] is bottom block: V / f(R) */
+	adZigX[1] = dR;
+	adZigX[iC] = 0;
+
+	for (i = 2; i < iC; ++i)
+	{
+		adZigX[i] = sqrt(-2 * log(dV / adZigX[i - 1] + f));
+		f = exp(-0.5 * adZigX[i] * adZigX[i]);
+	}
+	for (i = 0; i < iC; ++i)
+		adZigR[i] = adZigX[i + 1] / adZigX[i];
+	for (i = 0; i <= iC; ++i)
+		adZigF[i] = exp(-0.5 * adZigX[i] * adZigX[i]);
+	
+	/* single precision (FRanNormalZig) */
+	for (i = 0; i <= iC; ++i)
+	{
+		afZigX[i] = (float)adZigX[i];
+		afZigF[i] = (float)adZigF[i];
+	}
+	for (i = 0; i < iC; ++i)
+		afZigR[i] = (float)adZigR[i];
+}
+
+
+/*------------------------- exponential ziggurat ---------------------------*/
+static void zigExpInit(int iC, double dR, double dV)
+{
+	int i;	double f;
+
+	f = exp(-dR);
+	adZigExpX[0] = dV / f; /* [0] is bottom block: V / f(R) */
+	adZigExpX[1] = dR;
+	adZigExpX[iC] = 0;
+
+	for (i = 2; i < iC; ++i)
+	{
+		adZigExpX[i] = -log(dV / adZigExpX[i - 1] + f);
+		f = exp(-adZigExpX[i]);
+	}
+	for (i = 0; i < iC; ++i)
+		adZigExpR[i] = adZigExpX[i + 1] / adZigExpX[i];
+	for (i = 0; i <= iC; ++i)
+		adZigExpF[i] = exp(-adZigExpX[i]);
+}
+
+
+/*-------------------- McFarland's modified ziggurat -----------------------*/
+static double zigMFf(double x)
+{
+	return exp(-0.5 * x * x);
+}
+
+/* b - (1 - a) for overhang k at a, in the unit square */
+static double zigMFDev(int k, double a)
+{
+	double x = adZigMFX[k] + a * (adZigMFX[k - 1] - adZigMFX[k]);
+
+	return (zigMFf(x) - adZigMFF[k - 1]) / (adZigMFF[k] - adZigMFF[k - 1])
+	       - (1 - a);
+}
+
+/* X_k is found by bisection from X_k (f(X_k) - f(X_(k-1))) = A; with
+   A = sqrt(pi/2) / 256, exactly ZIGMF_L = 253 rectangles fit. */
+static void zigMFInit(void)
+{
+	double dSqrtHalfPi = sqrt(2 * atan(1.0)), A = dSqrtHalfPi / 256;
+	double c, lo, hi, m, d, dMax, dSum = 0;
+	double adP[ZIGMF_L + 1], adQ[256];
+	int aiSmall[256], aiLarge[256], nSmall = 0, nLarge = 0;
+	int i, k, it, s, l;
+
+	/* rectangles */
+	adZigMFX[0] = ZIGMF_R;
+	for (k = 1; k < ZIGMF_L; k++)
+	{
+		c = zigMFf(adZigMFX[k - 1]);
+		/* g(x) = x (f(x) - c) is largest where f(x) (1 - x^2) = c */
+		for (lo = 0, hi = 1, it = 0; it < 64; it++)
+		{
+			m = 0.5 * (lo + hi);
+			if (zigMFf(m) * (1 - m * m) > c)
+				lo = m;
+			else
+				hi = m;
+		}
+		for (hi = adZigMFX[k - 1], it = 0; it < 64; it++)
+		{
+			m = 0.5 * (lo + hi);
+			if (m * (zigMFf(m) - c) > A)
+				lo = m;
+			else
+				hi = m;
+		}
+		adZigMFX[k] = lo;
+	}
+	adZigMFX[ZIGMF_L] = 0;
+	for (k = 0; k <= ZIGMF_L; k++)
+		adZigMFF[k] = zigMFf(adZigMFX[k]);
+	for (k = 0; k < ZIGMF_L; k++)
+		adZigMFXs[k] = adZigMFX[k] * 0x1.0p-55;
+
+	/* areas of the tail (0) and of the overhangs (1...L) */
+	adP[0] = dSqrtHalfPi * erfc(adZigMFX[0] / sqrt(2.0));
+	for (k = 1; k <= ZIGMF_L; k++)
+		adP[k] = dSqrtHalfPi * (erf(adZigMFX[k - 1] / sqrt(2.0))
+		                        - erf(adZigMFX[k] / sqrt(2.0)))
+		         - (adZigMFX[k - 1] - adZigMFX[k]) * adZigMFF[k - 1];
+	for (k = 0; k <= ZIGMF_L; k++)
+		dSum += adP[k];
+
+	/* largest distance between curve and chord, by ternary search */
+	iZigMFInfl = 0;
+	for (k = 1; k <= ZIGMF_L; k++)
+	{
+		if ((adZigMFX[k] < 1) && (adZigMFX[k - 1] > 1))
+		{
+			iZigMFInfl = k;
+			aiZigMFE[k] = 0;
+			continue;
+		}
+		for (lo = 0, hi = 1, it = 0; it < 100; it++)
+		{
+			m = (2 * lo + hi) / 3;
+			d = (lo + 2 * hi) / 3;
+			if (fabs(zigMFDev(k, m)) < fabs(zigMFDev(k, d)))
+				lo = m;
+			else
+				hi = d;
+		}
+		/* safety margin for rounding */
+		dMax = fabs(zigMFDev(k, 0.5 * (lo + hi))) * (1 + 1e-6) + 1e-12;
+		aiZigMFE[k] = (int64_t)(dMax * 0x1.0p63);
+	}
+	aiZigMFE[0] = 0;
+
+	/* alias table (Vose), 256 slots for the L + 1 regions */
+	for (s = 0; s < 256; s++)
+	{
+		adQ[s] = (s <= ZIGMF_L) ? adP[s] * 256 / dSum : 0;
+		aucZigMFAlias[s] = (uint8_t)s;
+		if (adQ[s] < 1)
+			aiSmall[nSmall++] = s;
+		else
+			aiLarge[nLarge++] = s;
+	}
+	while ((nSmall > 0) && (nLarge > 0))
+	{
+		s = aiSmall[--nSmall];
+		l = aiLarge[nLarge - 1];
+		auZigMFThr[s] = (uint64_t)(adQ[s] * 0x1.0p56);
+		aucZigMFAlias[s] = (uint8_t)l;
+		adQ[l] -= 1 - adQ[s];
+		if (adQ[l] < 1)
+		{
+			nLarge--;
+			aiSmall[nSmall++] = l;
+		}
+	}
+	/* left over (rounding): keep the slot */
+	for (i = 0; i < nLarge; i++)
+		auZigMFThr[aiLarge[i]] = (uint64_t)1 << 56;
+	for (i = 0; i < nSmall; i++)
+		auZigMFThr[aiSmall[i]] = (uint64_t)1 << 56;
+}
+
+
+/*------------------------------- output -----------------------------------*/
+#define ALIGNED "__attribute__((aligned(64)))"
+
+static void PrintDouble(const char *sType, const char *sName, const char *sSize,
+                        const double *ad, int n)
+{
+	int i;
+
+	printf("static const %s %s[%s] %s = {", sType, sName, sSize, ALIGNED);
+	for (i = 0; i < n; i++)
+		printf("%s%.17g%s", (i % 3) ? " " : "\n\t", ad[i],
+		       (i < n - 1) ? "," : "");
+	printf("\n};\n");
+}
+
+static void PrintFloat(const char *sName, const char *sSize,
+                       const float *af, int n)
+{
+	int i;
+	char sNum[32];
+
+	printf("static const float %s[%s] %s = {", sName, sSize, ALIGNED);
+	for (i = 0; i < n; i++)
+	{
+		/* a float constant needs a decimal point or an exponent */
+		snprintf(sNum, sizeof(sNum), "%.9g", af[i]);
+		if (strpbrk(sNum, ".e") == NULL)
+			strcat(sNum, ".0");
+		printf("%s%sf%s", (i % 4) ? " " : "\n\t", sNum,
+		       (i < n - 1) ? "," : "");
+	}
+	printf("\n};\n");
+}
+
+static void PrintInt64(const char *sName, const char *sSize,
+                       const int64_t *ai, int n)
+{
+	int i;
+
+	printf("static const int64_t %s[%s] %s = {", sName, sSize, ALIGNED);
+	for (i = 0; i < n; i++)
+		printf("%sINT64_C(%" PRId64 ")%s", (i % 2) ? " " : "\n\t", ai[i],
+		       (i < n - 1) ? "," : "");
+	printf("\n};\n");
+}
+
+static void PrintUInt64(const char *sName, const char *sSize,
+                        const uint64_t *au, int n)
+{
+	int i;
+
+	printf("static const uint64_t %s[%s] %s = {", sName, sSize, ALIGNED);
+	for (i = 0; i < n; i++)
+		printf("%sUINT64_C(0x%015" PRIx64 ")%s", (i % 2) ? " " : "\n\t",
+		       au[i], (i < n - 1) ? "," : "");
+	printf("\n};\n");
+}
+
+static void PrintUInt8(const char *sName, const char *sSize,
+                       const uint8_t *auc, int n)
+{
+	int i;
+
+	printf("static const uint8_t %s[%s] %s = {", sName, sSize, ALIGNED);
+	for (i = 0; i < n; i++)
+		printf("%s%3d%s", (i % 12) ? " " : "\n\t", auc[i],
+		       (i < n - 1) ? "," : "");
+	printf("\n};\n");
+}
+
+static void PrintTables(void)
+{
+	printf("/*------------- BEGIN generated by genzigtables.c, do not edit -------------*/\n");
+	printf("/* s_adZigX holds coordinates, such that each rectangle has*/\n");
+	printf("/* same area; s_adZigR holds s_adZigX[i + 1] / s_adZigX[i] */\n");
+	printf("/* s_adZigF holds the density exp(-x^2/2) at s_adZigX[i]   */\n");
+	PrintDouble("double", "s_adZigX", "ZIGNOR_C + 1", adZigX, ZIGNOR_C + 1);
+	PrintDouble("double", "s_adZigR", "ZIGNOR_C", adZigR, ZIGNOR_C);
+	PrintDouble("double", "s_adZigF", "ZIGNOR_C + 1", adZigF, ZIGNOR_C + 1);
+	printf("\n/* single precision: s_adZigX, s_adZigR and s_adZigF as floats */\n");
+	PrintFloat("s_afZigX", "ZIGNOR_C + 1", afZigX, ZIGNOR_C + 1);
+	PrintFloat("s_afZigR", "ZIGNOR_C", afZigR, ZIGNOR_C);
+	PrintFloat("s_afZigF", "ZIGNOR_C + 1", afZigF, ZIGNOR_C + 1);
+	printf("\n/* exponential ziggurat: as above, for the density exp(-x) */\n");
+	PrintDouble("double", "s_adZigExpX", "ZIGEXP_C + 1", adZigExpX, ZIGEXP_C + 1);
+	PrintDouble("double", "s_adZigExpR", "ZIGEXP_C", adZigExpR, ZIGEXP_C);
+	PrintDouble("double", "s_adZigExpF", "ZIGEXP_C + 1", adZigExpF, ZIGEXP_C + 1);
+	printf("\n/* McFarland: X_k, with X_L = 0 */\n");
+	PrintDouble("double", "s_adZigMFX", "ZIGMF_L + 1", adZigMFX, ZIGMF_L + 1);
+	printf("/* McFarland: X_k * 2^-55 (fast path) */\n");
+	PrintDouble("double", "s_adZigMFXs", "ZIGMF_L", adZigMFXs, ZIGMF_L);
+	printf("/* McFarland: f(X_k) */\n");
+	PrintDouble("double", "s_adZigMFF", "ZIGMF_L + 1", adZigMFF, ZIGMF_L + 1);
+	printf("/* McFarland: max. distance curve-chord, 2^63 */\n");
+	PrintInt64("s_aiZigMFE", "ZIGMF_L + 1", aiZigMFE, ZIGMF_L + 1);
+	printf("/* McFarland: alias table, threshold, 2^56 */\n");
+	PrintUInt64("s_auZigMFThr", "256", auZigMFThr, 256);
+	printf("/* McFarland: alias table, alias */\n");
+	PrintUInt8("s_aucZigMFAlias", "256", aucZigMFAlias, 256);
+	printf("/* McFarland: overhang with the inflection */\n");
+	printf("static const int s_iZigMFInfl = %d;\n", iZigMFInfl);
+	printf("/*-------------- END generated by genzigtables.c, do not edit --------------*/\n");
+}
+
+
+/*------------------------------- check ------------------------------------*/
+static int Check(const char *sName, const void *p1, const void *p2,
+                 size_t size)
+{
+	int bOK = (memcmp(p1, p2, size) == 0);
+
+	printf("%-16s %s\n", sName, bOK ? "OK" : "DIFFERENT");
+	return bOK ? 0 : 1;
+}
+
+static int CheckTables(void)
+{
+	int nfail = 0;
+
+	nfail += Check("s_adZigX", s_adZigX, adZigX, sizeof(adZigX));
+	nfail += Check("s_adZigR", s_adZigR, adZigR, sizeof(adZigR));
+	nfail += Check("s_adZigF", s_adZigF, adZigF, sizeof(adZigF));
+	nfail += Check("s_afZigX", s_afZigX, afZigX, sizeof(afZigX));
+	nfail += Check("s_afZigR", s_afZigR, afZigR, sizeof(afZigR));
+	nfail += Check("s_afZigF", s_afZigF, afZigF, sizeof(afZigF));
+	nfail += Check("s_adZigExpX", s_adZigExpX, adZigExpX, sizeof(adZigExpX));
+	nfail += Check("s_adZigExpR", s_adZigExpR, adZigExpR, sizeof(adZigExpR));
+	nfail += Check("s_adZigExpF", s_adZigExpF, adZigExpF, sizeof(adZigExpF));
+	nfail += Check("s_adZigMFX", s_adZigMFX, adZigMFX, sizeof(adZigMFX));
+	nfail += Check("s_adZigMFXs", s_adZigMFXs, adZigMFXs, sizeof(adZigMFXs));
+	nfail += Check("s_adZigMFF", s_adZigMFF, adZigMFF, sizeof(adZigMFF));
+	nfail += Check("s_aiZigMFE", s_aiZigMFE, aiZigMFE, sizeof(aiZigMFE));
+	nfail += Check("s_auZigMFThr", s_auZigMFThr, auZigMFThr,
+	               sizeof(auZigMFThr));
+	nfail += Check("s_aucZigMFAlias", s_aucZigMFAlias, aucZigMFAlias,
+	               sizeof(aucZigMFAlias));
+	nfail += Check("s_iZigMFInfl", &s_iZigMFInfl, &iZigMFInfl,
+	               sizeof(iZigMFInfl));
+	printf("\n%d tables differ\n", nfail);
+	return nfail;
+}
+
+
+int main(int argc, char *argv[])
+{
+	zigNorInit(ZIGNOR_C, ZIGNOR_R, ZIGNOR_V);
+	zigExpInit(ZIGEXP_C, ZIGEXP_R, ZIGEXP_V);
+	zigMFInit();
+
+	if ((argc == 2) && (strcmp(argv[1], "-c") == 0))
+		return (CheckTables() != 0);
+	if (argc != 1)
+	{
+		fprintf(stderr, "usage: genzigtables [-c]\n");
+		return 1;
+	}
+	PrintTables();
+	return 0;
+}
@@ -21,16 +21,21 @@
  *
  * 0. Definitions and prototypes
  * A. MELG19937-64 PRNG by Harase & Kimoto
- * B. Xoshiro256+ PRNG by Vigna & Blackman, and the splitmix64 PRNG (for
- *    initialization of other PRNGs using a single 64-bit seed)
+ * B. Xoshiro256+ PRNG by Vigna & Blackman, its multi-lane (SIMD) variants, 
+ *    and the splitmix64 PRNG (for initialization of other PRNGs using a 
+ *    single 64-bit seed)
  * C. Lehmer64 PRNG from Lemire
  * D. PCG64DXSM by O'Neill
  * E. MWC8222 by Marsaglia, from Doornik's 'zigrandom.c' (Marsaglia originally
       called this generator MWC256, but there is now a different algorithm
 	  with that name.)
  * F. Doornik's ziggurat algorithm for generation of normally distributed 
- *    random numbers (from 'zignor.c')
- * G. Additional functionality: 'zigtimer.c' timing functions etc.
+ *    random numbers (from 'zignor.c'), and an exponential ziggurat
+ * G. Bulk generation: filling arrays with random numbers
+ * H. Additional functionality: 'zigtimer.c' timing functions etc., and
+ *    a high-resolution timer for benchmarks
+ * I. Philox4x32-10 counter-based PRNG by Salmon et al.
+ * J. Asynchronous mode: producer thread with a lock-free ring buffer
  *
  *==========================================================================
  *==========================================================================*/
@@ -52,6 +57,35 @@ extern "C" {
 #include <limits.h>
 #include <math.h>
 #include <string.h>
+#include <time.h>
+
+/* Run-time selection of the instruction set used by the SIMD bulk kernels
+   (see RanSetIsa), on x86-64 with GCC or compatible compilers. Define
+   RANDOMMW_NO_DISPATCH to compile only the generic kernels. */
+#if defined(__GNUC__) && defined(__x86_64__) && !defined(RANDOMMW_NO_DISPATCH)
+#define RANDOMMW_DISPATCH
+#include <immintrin.h>
+#define RANDOMMW_TARGET_AVX2	__attribute__((target("avx2")))
+#define RANDOMMW_TARGET_AVX512	__attribute__((target("avx2,avx512f,avx512dq,avx512vl")))
+#endif
+
+/* Threads of RanFillNormalParallel: OpenMP when compiled with -fopenmp, 
+   else POSIX threads when compiled with -pthread (which defines 
+   _REENTRANT), else none. The producer thread of the asynchronous mode
+   (RanAsyncStart) needs POSIX threads. Define RANDOMMW_NO_THREADS to use
+   no threads at all. */
+#if !defined(RANDOMMW_NO_THREADS)
+#if defined(_OPENMP)
+#define RANDOMMW_OPENMP
+#include <omp.h>
+#endif
+#if defined(_REENTRANT)
+#define RANDOMMW_PTHREADS
+#include <pthread.h>
+#include <sched.h>
+#include <unistd.h>
+#endif
+#endif
 
 typedef double 		( * DRANFUN)(void);
 typedef uint32_t 	( * U32RANFUN)(void);
@@ -59,6 +93,19 @@ typedef void   		( * RANSETSEEDFUN)(uint64_t);
 typedef void   		( * RANJUMPFUN)(uint64_t);
 typedef void		( * RANSEEDJUMPFUN)(uint64_t, uint64_t);
 
+typedef struct RANSTATE RANSTATE;
+
+typedef double 		( * DRANFUN_R)(RANSTATE *);
+typedef uint32_t 	( * U32RANFUN_R)(RANSTATE *);
+typedef void   		( * RANSETSEEDFUN_R)(RANSTATE *, uint64_t);
+typedef void   		( * RANJUMPFUN_R)(RANSTATE *, uint64_t);
+typedef void		( * RANSEEDJUMPFUN_R)(RANSTATE *, uint64_t, uint64_t);
+typedef uint64_t 	( * U64RANFUN_R)(RANSTATE *);
+typedef void		( * DRANVECFUN_R)(RANSTATE *, double *, size_t);
+typedef void		( * U32RANVECFUN_R)(RANSTATE *, uint32_t *, size_t);
+typedef void		( * U64RANVECFUN_R)(RANSTATE *, uint64_t *, size_t);
+typedef void		( * FRANVECFUN_R)(RANSTATE *, float *, size_t);
+
 void    RanSetRan(const char *sRan);
 void    RanSetRanExt(DRANFUN DRanFun, U32RANFUN U32RanFun, 
 		             RANSETSEEDFUN RanSetSeedFun, RANJUMPFUN RanJumpFun,
@@ -66,17 +113,172 @@ void    RanSetRanExt(DRANFUN DRanFun, U32RANFUN U32RanFun,
 void    RanSetSeed(uint64_t uSeed);
 void    RanJumpRan(uint64_t uJumpsize);
 void	RanSeedJump(uint64_t uSeed, uint64_t uJumpsize);
+void    RanAdvanceRan(uint64_t uSteps);
 double  DRanU(void);
 uint32_t  U32RanU(void);
+uint64_t  U64RanU(void);
 
 double  DRanNormalZig(void);
 
+/* Exponentially distributed random numbers (mean 1), see section F */
+double  DRanExpZig(void);
+
+/* Single precision: uniform floats with 24-bit resolution and normally
+   distributed floats, using both 32-bit halves of each 64-bit number */
+float   FRanU(void);
+float   FRanNormalZig(void);
+
+/* Selection of the normal (ziggurat) algorithm used by DRanNormalZig and
+   DRanNormalZigVec, see section F. Bit 0 selects the single 64-bit draw
+   per candidate, bit 1 the wedge test with precomputed densities, bit 2
+   the tail sampler based on the exponential ziggurat. */
+#define RANZIG_ZIGNOR	0	/* Doornik's ZIGNOR (default) */
+#define RANZIG_ZIGNOR1	1	/* ZIGNOR with a single 64-bit draw per candidate */
+#define RANZIG_ZIGNORW	2	/* ZIGNOR with table-driven wedge test */
+#define RANZIG_ZIGNOR1W	3	/* ZIGNOR1 with table-driven wedge test */
+#define RANZIG_ZIGNORX	4	/* ZIGNOR with exponential-ziggurat tail */
+#define RANZIG_ZIGNOR1WX 7	/* all of the above */
+#define RANZIG_MCFARLAND 8	/* McFarland's modified ziggurat */
+
+void    RanSetZig(const char *sZig);
+
+/* Instruction set of the SIMD kernels for bulk generation with the
+   multi-lane Xoshiro256+ engines and Philox4x32-10 (uniform numbers and 
+   batched ziggurat), see sections G and I. The best one supported by the
+   CPU is selected by RanInit. All give identical output. */
+#define RANISA_SCALAR	0	/* generic code (SSE2 on x86-64) */
+#define RANISA_AVX2		1	/* AVX2 */
+#define RANISA_AVX512	2	/* AVX-512 (F, DQ and VL) */
+
+void    RanSetIsa(const char *sIsa);
+const char *RanGetIsa(void);
+
+/* Bulk generation: fill arrays with n numbers, identical to n successive
+   calls of the corresponding scalar function */
+void    DRanUVec(double *pdOut, size_t n);
+void    U32RanUVec(uint32_t *puOut, size_t n);
+void    U64RanUVec(uint64_t *puOut, size_t n);
+void    DRanNormalZigVec(double *pdOut, size_t n);
+void    FRanUVec(float *pfOut, size_t n);
+void    FRanNormalZigVec(float *pfOut, size_t n);
+
+/* Parallel filling of a large array with normal variates, in chunks of
+   nChunk numbers (0: RANFILL_CHUNK), chunk c being generated by the RNG
+   jumped c times. The result does not depend on the number of threads
+   (RanSetThreads, 0: all available), see section G. */
+#define RANFILL_CHUNK	((size_t)1 << 20)
+
+void    RanFillNormalParallel(double *pdOut, size_t n, size_t nChunk);
+void    RanSetThreads(int nThreads);
+
 void  RanInit(const char *sRan, uint64_t uSeed, uint64_t uJumpsize);
 
+/* Counter-based RNG (Philox4x32-10): position the generator at the start
+   of the stream of particle uId (< 2^32) at time step uStep, so that the
+   numbers are a function of (uSeed, uId, uStep) only, see section I.
+   Returns 0, or -1 if the RNG has no stream key (all RNGs other than
+   Philox4x32-10) or uId >= 2^32, in which case the generator is left 
+   unchanged */
+int     RanSetStream(uint64_t uId, uint64_t uStep);
+void    philox4x32_10(const uint32_t *puKey, const uint32_t *puCtr, 
+                      uint32_t *puOut);
+
+/* Reentrant interface: same functions, operating on a caller-owned
+   RANSTATE instead of the single, global default generator */
+void    RanSetRan_r(RANSTATE *pRan, const char *sRan);
+void    RanSetSeed_r(RANSTATE *pRan, uint64_t uSeed);
+void    RanSetZig_r(RANSTATE *pRan, const char *sZig);
+void    RanSetIsa_r(RANSTATE *pRan, const char *sIsa);
+const char *RanGetIsa_r(RANSTATE *pRan);
+void    RanJumpRan_r(RANSTATE *pRan, uint64_t uJumpsize);
+void	RanSeedJump_r(RANSTATE *pRan, uint64_t uSeed, uint64_t uJumpsize);
+void    RanAdvanceRan_r(RANSTATE *pRan, uint64_t uSteps);
+int     RanSetStream_r(RANSTATE *pRan, uint64_t uId, uint64_t uStep);
+double  DRanU_r(RANSTATE *pRan);
+uint32_t  U32RanU_r(RANSTATE *pRan);
+uint64_t  U64RanU_r(RANSTATE *pRan);
+
+double  DRanNormalZig_r(RANSTATE *pRan);
+double  DRanExpZig_r(RANSTATE *pRan);
+float   FRanU_r(RANSTATE *pRan);
+float   FRanNormalZig_r(RANSTATE *pRan);
+
+void    DRanUVec_r(RANSTATE *pRan, double *pdOut, size_t n);
+void    U32RanUVec_r(RANSTATE *pRan, uint32_t *puOut, size_t n);
+void    U64RanUVec_r(RANSTATE *pRan, uint64_t *puOut, size_t n);
+void    DRanNormalZigVec_r(RANSTATE *pRan, double *pdOut, size_t n);
+void    FRanUVec_r(RANSTATE *pRan, float *pfOut, size_t n);
+void    FRanNormalZigVec_r(RANSTATE *pRan, float *pfOut, size_t n);
+void    RanFillNormalParallel_r(RANSTATE *pRan, double *pdOut, size_t n, 
+                                size_t nChunk);
+
+void  RanInit_r(RANSTATE *pRan, const char *sRan, uint64_t uSeed, 
+                uint64_t uJumpsize);
+
+/* Ziggurat instrumentation, see section F. The counters are only kept
+   when compiled with RANDOMMW_ZIGSTATS defined; otherwise they read zero. */
+typedef struct
+{
+	uint64_t uNormals;		// normal variates generated
+	uint64_t uRectAccept;	// accepted in rectangle (fast path)
+	uint64_t uWedgeAccept;	// accepted in wedge test (exp)
+	uint64_t uWedgeReject;	// rejected in wedge test
+	uint64_t uTail;			// variates from the tail (bottom box)
+	uint64_t uTailIter;		// iterations of the tail loop (log)
+	uint64_t uDRan;			// uniform doubles drawn
+	uint64_t uU32Ran;		// uniform 32-bit integers drawn
+	uint64_t uU64Ran;		// uniform 64-bit integers drawn
+	uint64_t uExp;			// exp() evaluations in the wedge test
+	uint64_t uExpZig;		// exponential variates (DRanExpZig, tail)
+} RANZIGSTATS;
+
+void	RanZigStatsGet_r(const RANSTATE *pRan, RANZIGSTATS *pStats);
+void	RanZigStatsReset_r(RANSTATE *pRan);
+void	RanZigStatsGet(RANZIGSTATS *pStats);
+void	RanZigStatsReset(void);
+
+/* Asynchronous mode, see section J: a producer thread generates normal
+   variates (DRanNormalZig) or uniform doubles (DRanU) ahead of demand,
+   into a ring buffer of nDepth numbers (0: RANASYNC_DEPTH), optionally
+   pinned to CPU iCpu (-1: not pinned). Needs POSIX threads (-pthread).
+   Until RanAsyncStop, other draw functions abort the program, and
+   functions that change the generator (RanInit, RanJumpRan, ...) stop 
+   the asynchronous mode first. */
+#define RANASYNC_NORMAL		0
+#define RANASYNC_UNIFORM	1
+#define RANASYNC_DEPTH		4096
+
+typedef struct
+{
+	uint64_t uProduced;		// numbers generated by the producer
+	uint64_t uConsumed;		// numbers read by DRanNormalZig or DRanU
+	uint64_t uStalls;		// producer found the ring buffer full
+	uint64_t uWaits;		// consumer found the ring buffer empty
+	int iCpu;				// CPU of the producer, -1 if not pinned
+} RANASYNCSTATS;
+
+int		RanAsyncStart_r(RANSTATE *pRan, int iKind, size_t nDepth, int iCpu);
+void	RanAsyncStop_r(RANSTATE *pRan, RANASYNCSTATS *pStats);
+void	RanAsyncStats_r(RANSTATE *pRan, RANASYNCSTATS *pStats);
+int		RanAsyncStart(int iKind, size_t nDepth, int iCpu);
+void	RanAsyncStop(RANASYNCSTATS *pStats);
+void	RanAsyncStats(RANASYNCSTATS *pStats);
+
 void 	StartTimer(void);
 void 	StopTimer(void);
 char * GetLapsedTime(void);
 
+typedef struct
+{
+	double		dStart, dStop;		// monotonic clock, in seconds
+	uint64_t	uTscStart, uTscStop;	// time-stamp counter (x86 only)
+} RANTIMER;
+
+void	RanTimerStart(RANTIMER *pTimer);
+void	RanTimerStop(RANTIMER *pTimer);
+double	RanTimerSeconds(const RANTIMER *pTimer);
+uint64_t	RanTimerTicks(const RANTIMER *pTimer);
+
 #define M_RAN_INVM30	9.31322574615478515625e-010			  /* 1.0 / 2^30 */
 #define M_RAN_INVM32	2.32830643653869628906e-010			  /* 1.0 / 2^32 */
 #define M_RAN_INVM48	3.55271367880050092936e-015			  /* 1.0 / 2^48 */
@@ -95,52 +297,236 @@ char * GetLapsedTime(void);
         (int)((iRan2) & 0x000FFFFF) * M_RAN_INVM52)
 
 
+/* Generator state
+
+   All state of a random number stream is contained in a RANSTATE object.
+   The functions without the '_r' suffix (RanInit, DRanU, U32RanU, 
+   DRanNormalZig, ...) operate on a single default RANSTATE. The '_r'
+   functions operate on a RANSTATE supplied by the caller, so that several
+   independent streams may coexist in the same process, e.g. one per thread.
+   
+   The state of all uniform RNGs is kept side by side (not in a union), so
+   that switching RNG with RanSetRan() does not affect the state of the 
+   other RNGs, exactly as when each RNG had its own global state.
+*/
+
+/* sizes of the state arrays of MELG19937-64 and MWC8222, and initial
+   carry of MWC8222 (see sections A and E) */
+#define MELG_NN 311
+#define MWC_R  256
+#define MWC_C  362436
+
+/* maximum number of lanes and size of the output buffer (in 64-bit words)
+   of the multi-lane Xoshiro256+ engines (see section B) */
+#define XOSHIRO256PX_LANES_MAX 8
+#define XOSHIRO256PX_BUF 1024
+
+/* size of the output buffer (in 64-bit words, 2 per block) of 
+   Philox4x32-10, and the number of blocks of its first refill after
+   positioning (see section I) */
+#define PHILOX_BUF 256
+#define PHILOX_REFILL_MIN 4
+
+typedef __uint128_t pcg128_t;
+
+typedef struct {
+  pcg128_t state;
+  pcg128_t inc;
+} pcg_state_setseq_128;
+
+struct melg_state {
+	uint64_t lung;
+	uint64_t melg[MELG_NN];
+	int melgi;
+	uint64_t (*function_p)(struct melg_state *);
+};
+
+struct RANSTATE {
+	/* active uniform RNG */
+	DRANFUN_R			fnDRanu;
+	U32RANFUN_R			fnU32Ranu;
+	RANSETSEEDFUN_R		fnRanSetSeed;
+	RANJUMPFUN_R		fnRanJump;
+	RANSEEDJUMPFUN_R	fnRanSeedJump;
+	U64RANFUN_R			fnU64Ranu;
+	RANJUMPFUN_R		fnRanAdvance;	/* by uSteps 64-bit numbers */
+	
+	/* bulk generation routines of the active uniform RNG (section G) */
+	DRANVECFUN_R		fnDRanuVec;
+	U32RANVECFUN_R		fnU32RanuVec;
+	U64RANVECFUN_R		fnU64RanuVec;
+	DRANVECFUN_R		fnDRanNormalZigVec;
+	FRANVECFUN_R		fnFRanuVec;
+	FRANVECFUN_R		fnFRanNormalZigVec;
+	
+	/* single precision (FRanU, FRanNormalZig): lower 32 bits of the last
+	   64-bit number, if not yet used */
+	uint32_t uiHalf;
+	int bHalf;
+	
+	/* normal algorithm (RANZIG_ZIGNOR, ..., RANZIG_MCFARLAND) */
+	int iZig;
+	
+	/* instruction set of the SIMD kernels (RANISA_SCALAR, ...) */
+	int iIsa;
+	
+	/* MWC8222 */
+	uint32_t uiStateMWC;
+	uint32_t uiCarryMWC;
+	uint32_t auiStateMWC[MWC_R];
+	
+	/* Lehmer64 */
+	__uint128_t lehmer64_state;
+	
+	/* PCG64DXSM */
+	pcg_state_setseq_128 pcg64dxsm_state;
+	
+	/* Xoshiro256+ */
+	uint64_t xoshiro256p_s[4];
+	
+	/* Xoshiro256+x4, Xoshiro256+x8: state word j of lane l is
+	   xoshiro256px_s[j][l]; buffered output, next word at xoshiro256px_bufi */
+	uint64_t xoshiro256px_s[4][XOSHIRO256PX_LANES_MAX];
+	uint64_t xoshiro256px_buf[XOSHIRO256PX_BUF];
+	int xoshiro256px_bufi;
+	int xoshiro256px_lanes;
+	
+	/* MELG19937-64 */
+	struct melg_state melg;
+	
+	/* Philox4x32-10: key, counter of the next block to be generated, and
+	   buffered output, next word at philox_bufi, up to PHILOX_BUF */
+	uint32_t philox_key[2];
+	__uint128_t philox_ctr;
+	uint64_t philox_buf[PHILOX_BUF];
+	int philox_bufi;
+	int philox_nrefill;
+	
+	/* asynchronous mode: producer thread and ring buffer (section J), 
+	   NULL if not active */
+	struct RANASYNC		*pAsync;
+	
+	/* external uniform RNG (see RanSetRanExt) */
+	DRANFUN				fnDRanExt;
+	U32RANFUN			fnU32RanExt;
+	RANSETSEEDFUN		fnRanSetSeedExt;
+	RANJUMPFUN			fnRanJumpExt;
+	RANSEEDJUMPFUN		fnRanSeedJumpExt;
+	
+#ifdef RANDOMMW_ZIGSTATS
+	/* ziggurat instrumentation counters (section F) */
+	RANZIGSTATS zigstats;
+#endif
+};
+
+
 /* static definitions
 
    External interface to PRNG should go via
    RanInit, DranU, U32RanU, DRanNormalZig
+   (or their '_r' counterparts)
    
 */
 
 
 /* MELG19937-64 Harase & Kimoto */
-static void RanSetSeed_MELG19937(uint64_t uSeed);
-static uint32_t U32Ran_MELG19937(void);
-static double DRan_MELG19937(void);
-static void RanJump_MELG19937(uint64_t uJumps);
-static void RanSeedJump_MELG19937(uint64_t uSeed, uint64_t uJumpsize);
+static void RanSetSeed_MELG19937(RANSTATE *pRan, uint64_t uSeed);
+static uint32_t U32Ran_MELG19937(RANSTATE *pRan);
+static uint64_t U64Ran_MELG19937(RANSTATE *pRan);
+static double DRan_MELG19937(RANSTATE *pRan);
+static void RanJump_MELG19937(RANSTATE *pRan, uint64_t uJumps);
+static void RanSeedJump_MELG19937(RANSTATE *pRan, uint64_t uSeed, uint64_t uJumpsize);
 
 /* Xoshiro256+ Blackman & Vigna */
-static void RanSetSeed_xoshiro256p(uint64_t uSeed);
-static uint32_t U32Ran_xoshiro256p(void);
-static double DRan_xoshiro256p(void);
-static void RanJump_xoshiro256p(uint64_t uJumps);
-static void RanSeedJump_xoshiro256p(uint64_t uSeed, uint64_t uJumpsize);
+static void RanSetSeed_xoshiro256p(RANSTATE *pRan, uint64_t uSeed);
+static uint32_t U32Ran_xoshiro256p(RANSTATE *pRan);
+static uint64_t U64Ran_xoshiro256p(RANSTATE *pRan);
+static double DRan_xoshiro256p(RANSTATE *pRan);
+static void RanJump_xoshiro256p(RANSTATE *pRan, uint64_t uJumps);
+static void RanSeedJump_xoshiro256p(RANSTATE *pRan, uint64_t uSeed, uint64_t uJumpsize);
+
+/* Xoshiro256+x4 and Xoshiro256+x8 multi-lane engines */
+static void RanSetSeed_xoshiro256px4(RANSTATE *pRan, uint64_t uSeed);
+static void RanSetSeed_xoshiro256px8(RANSTATE *pRan, uint64_t uSeed);
+static void RanSeedJump_xoshiro256px4(RANSTATE *pRan, uint64_t uSeed, uint64_t uJumpsize);
+static void RanSeedJump_xoshiro256px8(RANSTATE *pRan, uint64_t uSeed, uint64_t uJumpsize);
+static void RanJump_xoshiro256px(RANSTATE *pRan, uint64_t uJumps);
+static uint32_t U32Ran_xoshiro256px(RANSTATE *pRan);
+static uint64_t U64Ran_xoshiro256px(RANSTATE *pRan);
+static double DRan_xoshiro256px(RANSTATE *pRan);
 
 /* Lehmer64 */
-static void RanSetSeed_lehmer64(uint64_t uSeed);
-static uint32_t U32Ran_lehmer64(void);
-static double DRan_lehmer64(void);
-static void RanSeedJump_lehmer64(uint64_t uSeed, uint64_t uJumpsize);
+static void RanSetSeed_lehmer64(RANSTATE *pRan, uint64_t uSeed);
+static uint32_t U32Ran_lehmer64(RANSTATE *pRan);
+static uint64_t U64Ran_lehmer64(RANSTATE *pRan);
+static double DRan_lehmer64(RANSTATE *pRan);
+static void RanJump_lehmer64(RANSTATE *pRan, uint64_t uJumps);
+static void RanSeedJump_lehmer64(RANSTATE *pRan, uint64_t uSeed, uint64_t uJumpsize);
+static void RanAdvance_lehmer64(RANSTATE *pRan, uint64_t uSteps);
 
 /* PCG64DXSM by O'Neill */
-static void RanSetSeed_pcg64dxsm(uint64_t uSeed);
-static uint32_t U32Ran_pcg64dxsm(void);
-static double DRan_pcg64dxsm(void);
-static void RanJump_pcg64dxsm(uint64_t uJumps);
-static void RanSeedJump_pcg64dxsm(uint64_t uSeed, uint64_t uJumpsize);
+static void RanSetSeed_pcg64dxsm(RANSTATE *pRan, uint64_t uSeed);
+static uint32_t U32Ran_pcg64dxsm(RANSTATE *pRan);
+static uint64_t U64Ran_pcg64dxsm(RANSTATE *pRan);
+static double DRan_pcg64dxsm(RANSTATE *pRan);
+static void RanJump_pcg64dxsm(RANSTATE *pRan, uint64_t uJumps);
+static void RanSeedJump_pcg64dxsm(RANSTATE *pRan, uint64_t uSeed, uint64_t uJumpsize);
+static void RanAdvance_pcg64dxsm(RANSTATE *pRan, uint64_t uSteps);
 
 /* MWC8222 George Marsaglia */
-static void RanSetSeed_MWC8222(uint64_t uSeed);
-static uint32_t U32Ran_MWC8222(void);
-static double DRan_MWC8222(void);
-static void RanSeedJump_MWC8222(uint64_t uSeed, uint64_t uJumpsize);
+static void RanSetSeed_MWC8222(RANSTATE *pRan, uint64_t uSeed);
+static uint32_t U32Ran_MWC8222(RANSTATE *pRan);
+static uint64_t U64Ran_MWC8222(RANSTATE *pRan);
+static double DRan_MWC8222(RANSTATE *pRan);
+static void RanJump_MWC8222(RANSTATE *pRan, uint64_t uJumps);
+static void RanSeedJump_MWC8222(RANSTATE *pRan, uint64_t uSeed, uint64_t uJumpsize);
+static void RanAdvance_MWC8222(RANSTATE *pRan, uint64_t uSteps);
+
+/* Philox4x32-10 by Salmon et al. */
+static void RanSetSeed_philox4x32(RANSTATE *pRan, uint64_t uSeed);
+static uint32_t U32Ran_philox4x32(RANSTATE *pRan);
+static uint64_t U64Ran_philox4x32(RANSTATE *pRan);
+static double DRan_philox4x32(RANSTATE *pRan);
+static void RanJump_philox4x32(RANSTATE *pRan, uint64_t uJumps);
+static void RanSeedJump_philox4x32(RANSTATE *pRan, uint64_t uSeed, uint64_t uJumpsize);
+static void RanAdvance_philox4x32(RANSTATE *pRan, uint64_t uSteps);
 
 /* Splitmix64 for internal use */
-static void RanSetSeed_splitmix64(uint64_t uSeed);
-static uint32_t U32Ran_splitmix64(void);
+static void RanSetSeed_splitmix64(uint64_t *pState, uint64_t uSeed);
+static uint32_t U32Ran_splitmix64(uint64_t *pState);
 // static double DRan_splitmix64(void); // not needed
 
+/* Bulk generation routines for each uniform RNG (section G) */
+#define RAN_VEC_PROTOTYPES(name)                                              \
+static void DRanUVec_##name(RANSTATE *pRan, double *pdOut, size_t n);        \
+static void U32RanUVec_##name(RANSTATE *pRan, uint32_t *puOut, size_t n);    \
+static void U64RanUVec_##name(RANSTATE *pRan, uint64_t *puOut, size_t n);    \
+static void DRanNormalZigVec_##name(RANSTATE *pRan, double *pdOut, size_t n);\
+static void FRanUVec_##name(RANSTATE *pRan, float *pfOut, size_t n);         \
+static void FRanNormalZigVec_##name(RANSTATE *pRan, float *pfOut, size_t n);
+
+RAN_VEC_PROTOTYPES(MELG19937)
+RAN_VEC_PROTOTYPES(xoshiro256p)
+RAN_VEC_PROTOTYPES(xoshiro256px)
+RAN_VEC_PROTOTYPES(lehmer64)
+RAN_VEC_PROTOTYPES(pcg64dxsm)
+RAN_VEC_PROTOTYPES(MWC8222)
+RAN_VEC_PROTOTYPES(philox4x32)
+RAN_VEC_PROTOTYPES(ext)
+
+/* Asynchronous mode: consumer side (section J) */
+static inline int RanAsyncIsNormal(const struct RANASYNC *pAsync);
+static inline double RanAsyncRead(struct RANASYNC *pAsync);
+static inline void RanAsyncEnd(RANSTATE *pRan);
+static void RanAsyncEndOwner(RANSTATE *pRan);
+static void RanAsyncMisuse(void);
+
+
+/* Default generator state, used by the non-reentrant interface.
+   RanInit() sets it to the MWC8222 uniform generator if no other
+   generator has been selected. */
+static RANSTATE s_ranDefault;
+
 
 
 /*==========================================================================
@@ -175,7 +561,7 @@ static uint32_t U32Ran_splitmix64(void);
 /*              see Remark 4.1 in the above paper for details.                   */
 /* ***************************************************************************** */
 
-#define NN 311 // N-1
+#define NN MELG_NN // N-1
 #define MM 81 // M
 #define MATRIX_A 0x5c32e06df730fc42ULL
 #define P 33 // W-r
@@ -189,48 +575,50 @@ static uint32_t U32Ran_splitmix64(void);
 #define MASK1 0x6aede6fd97b338ecULL // b
 #define LAG1over 292 // NN-LAG1
 
-static uint64_t melg[NN]; 
-static int melgi;
-static uint64_t lung; //extra state variable
+/* The MELG19937-64 state (lung, melg[NN], melgi and the pointer to the
+   function handling the next case) is kept in a struct melg_state, 
+   which is part of RANSTATE (see top of this file). The functions with
+   the '_r' suffix operate on such a state. The original functions without
+   suffix operate on the state of the default generator. */
 static uint64_t mag01[2]={0ULL, MATRIX_A};
-static uint64_t x;
 
-static uint64_t melg_case_1(void);
-static uint64_t melg_case_2(void);
-static uint64_t melg_case_3(void);
-static uint64_t melg_case_4(void);
-uint64_t (*melg_next_uint64)(void);
-
-struct melg_state{
-	uint64_t lung;
-	uint64_t melg[NN];
-	int melgi;
-	uint64_t (*function_p)(void);
-};
+static uint64_t melg_case_1(struct melg_state *st);
+static uint64_t melg_case_2(struct melg_state *st);
+static uint64_t melg_case_3(struct melg_state *st);
+static uint64_t melg_case_4(struct melg_state *st);
+uint64_t melg_next_uint64(void);
 
 void melg_jump(void); //jump ahead by 2^256 steps
-static void melg_add(struct melg_state *state);
+static void melg_add(struct melg_state *state, const struct melg_state *st);
+
+static inline uint64_t melg_next_uint64_r(struct melg_state *st)
+{
+	return st->function_p(st);
+}
 
 /* initializes melg[NN] and lung with a seed */
-void melg_init_uint64seed(uint64_t seed)
+void melg_init_uint64seed_r(struct melg_state *st, uint64_t seed)
 {
+	uint64_t *melg = st->melg;
+	int melgi;
     melg[0] = seed;
     for (melgi=1; melgi<NN; melgi++) {
         melg[melgi] = (6364136223846793005ULL * (melg[melgi-1] ^ (melg[melgi-1] >> 62)) + melgi);
     }
-    lung = (6364136223846793005ULL * (melg[melgi-1] ^ (melg[melgi-1] >> 62)) + melgi);
-    melgi = 0;
-    melg_next_uint64 = melg_case_1;
+    st->lung = (6364136223846793005ULL * (melg[melgi-1] ^ (melg[melgi-1] >> 62)) + melgi);
+    st->melgi = 0;
+    st->function_p = melg_case_1;
 }
 
 /* initialize by an array with array-length */
 /* init_key is the array for initializing keys */
 /* key_length is its length */
-void melg_init_uint64array(uint64_t init_key[],
+void melg_init_uint64array_r(struct melg_state *st, uint64_t init_key[],
 		     uint64_t key_length)
 {
 	uint64_t i, j, k;
-    melg_init_uint64seed(19650218ULL);
+	uint64_t *melg = st->melg;
+    melg_init_uint64seed_r(st, 19650218ULL);
     i=1; j=0;
     k = (NN>key_length ? NN : key_length);
     for (; k; k--) {
@@ -246,56 +634,84 @@ void melg_init_uint64array(uint64_t init_key[],
         i++;
         if (i>=NN) { melg[0] = melg[NN-1]; i=1; }
     }
-    lung = (lung ^ ((melg[NN-1] ^ (melg[NN-1] >> 62)) * 2862933555777941757ULL))
+    st->lung = (st->lung ^ ((melg[NN-1] ^ (melg[NN-1] >> 62)) * 2862933555777941757ULL))
 	  - NN; /* non linear */
     melg[0] = (melg[0] | (1ULL << 63)); /* MSB is 1; assuring non-zero initial array. Corrected.  */
-    melgi = 0;
+    st->melgi = 0;
 }
 
-static uint64_t melg_case_1(void) {
+static uint64_t melg_case_1(struct melg_state *st) {
+    uint64_t x;
+    uint64_t *melg = st->melg;
+    int melgi = st->melgi;
     x = (melg[melgi] & MASKU) | (melg[melgi+1] & MASKL);
-    lung = (x >> 1) ^ mag01[(int)(x & 1ULL)] ^ melg[melgi+MM] ^ MAT3NEG(23, lung);
-    melg[melgi] = x ^ MAT3POS(33, lung);
+    st->lung = (x >> 1) ^ mag01[(int)(x & 1ULL)] ^ melg[melgi+MM] ^ MAT3NEG(23, st->lung);
+    melg[melgi] = x ^ MAT3POS(33, st->lung);
     x = melg[melgi] ^ (melg[melgi] << SHIFT1);
     x = x ^ (melg[melgi + LAG1] & MASK1);
-    ++melgi;
-    if (melgi == NN - MM) melg_next_uint64 = melg_case_2;
+    st->melgi = ++melgi;
+    if (melgi == NN - MM) st->function_p = melg_case_2;
     return x;
 }
 
-static uint64_t melg_case_2(void) {
+static uint64_t melg_case_2(struct melg_state *st) {
+    uint64_t x;
+    uint64_t *melg = st->melg;
+    int melgi = st->melgi;
     x = (melg[melgi] & MASKU) | (melg[melgi+1] & MASKL);
-    lung = (x >> 1) ^ mag01[(int)(x & 1ULL)] ^ melg[melgi+(MM-NN)] ^ MAT3NEG(23, lung);
-    melg[melgi] = x ^ MAT3POS(33, lung);
+    st->lung = (x >> 1) ^ mag01[(int)(x & 1ULL)] ^ melg[melgi+(MM-NN)] ^ MAT3NEG(23, st->lung);
+    melg[melgi] = x ^ MAT3POS(33, st->lung);
     x = melg[melgi] ^ (melg[melgi] << SHIFT1);
     x = x ^ (melg[melgi + LAG1] & MASK1);
-    ++melgi;
-    if (melgi == LAG1over) melg_next_uint64 = melg_case_3;
+    st->melgi = ++melgi;
+    if (melgi == LAG1over) st->function_p = melg_case_3;
     return x;
 }
 
-static uint64_t melg_case_3(void) {
+static uint64_t melg_case_3(struct melg_state *st) {
+    uint64_t x;
+    uint64_t *melg = st->melg;
+    int melgi = st->melgi;
     x = (melg[melgi] & MASKU) | (melg[melgi+1] & MASKL);
-    lung = (x >> 1) ^ mag01[(int)(x & 1ULL)] ^ melg[melgi+(MM-NN)] ^ MAT3NEG(23, lung);
-    melg[melgi] = x ^ MAT3POS(33, lung);
+    st->lung = (x >> 1) ^ mag01[(int)(x & 1ULL)] ^ melg[melgi+(MM-NN)] ^ MAT3NEG(23, st->lung);
+    melg[melgi] = x ^ MAT3POS(33, st->lung);
     x = melg[melgi] ^ (melg[melgi] << SHIFT1);
     x = x ^ (melg[melgi - LAG1over] & MASK1);
-    ++melgi;
-    if (melgi == NN-1) melg_next_uint64 = melg_case_4;
+    st->melgi = ++melgi;
+    if (melgi == NN-1) st->function_p = melg_case_4;
     return x;
 }
 
-static uint64_t melg_case_4(void) {
+static uint64_t melg_case_4(struct melg_state *st) {
+    uint64_t x;
+    uint64_t *melg = st->melg;
+    int melgi = st->melgi;
     x = (melg[NN-1] & MASKU) | (melg[0] & MASKL);
-    lung = (x >> 1) ^ mag01[(int)(x & 1ULL)] ^ melg[MM-1] ^ MAT3NEG(23, lung);
-    melg[NN-1] = x ^ MAT3POS(33, lung);
+    st->lung = (x >> 1) ^ mag01[(int)(x & 1ULL)] ^ melg[MM-1] ^ MAT3NEG(23, st->lung);
+    melg[NN-1] = x ^ MAT3POS(33, st->lung);
     x = melg[melgi] ^ (melg[melgi] << SHIFT1);
     x = x ^ (melg[melgi - LAG1over] & MASK1);
-    melgi = 0;
-    melg_next_uint64 = melg_case_1;
+    st->melgi = 0;
+    st->function_p = melg_case_1;
     return x;
 }
 
+/* original interface, operating on the default generator state */
+void melg_init_uint64seed(uint64_t seed)
+{
+	melg_init_uint64seed_r(&s_ranDefault.melg, seed);
+}
+
+void melg_init_uint64array(uint64_t init_key[], uint64_t key_length)
+{
+	melg_init_uint64array_r(&s_ranDefault.melg, init_key, key_length);
+}
+
+uint64_t melg_next_uint64(void)
+{
+	return melg_next_uint64_r(&s_ranDefault.melg);
+}
+
 /*----------------------------------------------------------------
   Original melg19337-4.c type conversion functions
   ---------------------------------------------------------------*/
@@ -359,164 +775,1074 @@ double melg_next_res53(void)
  *-----*/
 
 
-/* This is a jump function for the generator. It is equivalent
-   to 2^256 calls to melg_next_uint64(). */
-void melg_jump(void)
+/*------------------------ MELG19937-64 jump-ahead ------------------------
+ *  M. H. V. Werts, 2025
+ *
+ *  MELG19937-64 is F2-linear: a step is a linear map F of the state x over
+ *  GF(2). A jump by d steps is F^d x = phi(F) x, with phi(t) = t^d mod P(t), 
+ *  P(t) the characteristic polynomial of F, of degree MELG_DEG. The jump 
+ *  polynomials for 2^256 * 2^j steps (j < MELG_JUMP_NPOLY) are precomputed
+ *  by genmelgjump.c, and stored as bit arrays (coefficient of t^i in bit 
+ *  i % 64 of word i / 64). The polynomial for 2^256 steps is the one 
+ *  published with MELG19937-64 by Harase & Kimoto.
+ *
+ *  phi(F) x is evaluated with Horner's rule and a sliding window of 
+ *  MELG_JUMP_WINDOW coefficients [H. Haramoto et al., "Efficient jump ahead
+ *  for F2-linear random number generators", INFORMS J. Comput. 2008, 20, 
+ *  385], y = F^l y + h(F) x, where the window polynomial h has lowest
+ *  coefficient 1. The 2^(MELG_JUMP_WINDOW - 1) states h(F) x are computed 
+ *  first. This needs one state addition per window instead of one per 
+ *  nonzero coefficient.
+ *--------------------------------------------------------------------------*/
+#define MELG_DEG			19937
+#define MELG_JUMP_WORDS		((MELG_DEG + 63) / 64)
+#define MELG_JUMP_NPOLY		12
+#define MELG_JUMP_WINDOW	5
+
+/*------------- BEGIN generated by genmelgjump.c, do not edit --------------*/
+/* s_auMELGJump[j]: t^(2^(256 + j)) mod P(t), P(t) the characteristic  */
+/* polynomial of MELG19937-64; coefficient of t^i in bit i % 64 of     */
+/* word i / 64                                                         */
+static const uint64_t s_auMELGJump[MELG_JUMP_NPOLY][MELG_JUMP_WORDS] __attribute__((aligned(64))) = {
 {
-	struct melg_state *melg_state_init;
-	int i, j;
-	int bits, mask;
-	
-	//jump size 2^256
-	char jump_string[] = 
-        "1510de5f1aeb1b349b7d2f3dc278bf1e6358d09c083c53b2b5"
-        "2b0b37aa42ec96ae92d9199e5ddb4f8f19419a1ae8d41d208c"
-        "c209439db14c17bc032c1aa482b589174bb3ac3964a128c742"
-        "017ff511a9ddd720f397969f0c4dc862608725d5465dd0d257"
-        "99d29ff579515657f3b7f58f5f6090d3c2c283b9e1cc517b48"
-        "d4df4f03db955624557939ba23ff0b68b195a7a7413dcb3029"
-        "25711acc4fbc5554193ddcf43bfd9deeda0e3a684770ef6b11"
-        "b8129f937e0c41e8c7c435bb76c6ca0518d6cd8809410c33a5"
-        "f5f39573f7ed9479abe9a5ee7bf09e189b1737f6fe53897026"
-        "d792327de7e2c9ca050fa66f23eab9a0a83b67a9e6d54d70ce"
-        "46664dbc4af7cee88756fc50f16b841b76167c66613ef43b00"
-        "b775aeed0e260fde67da03f6051ba11dbfa2070447f3aba151"
-        "e001404a11d3049e53f177ee4c275cffcf4c6e5c7b8a1e8db0"
-        "86731abb01ea50ec8440bc45fdd3c23679a68b29b2457d0013"
-        "878d8a7f1dccc595f99e656b64da2715a392eb68a517989be2"
-        "4c663dcbfb663ff38c567fa6b5fe8bdccbd30163524a9a1d63"
-        "cf609eb93a1fe3cca5e1220bd05e4dcb611a459d6ee70bbf57"
-        "86d6fb887aea96e70e78af7f50dcbc638664ac28efcab6356d"
-        "ed959bb79355c5bc5e189a20bb8f64e5fcb444c2f29c57fce7"
-        "a70208115da1b8a663c8062cbc98e353526b1d72371c07fb0c"
-        "ad50a923eef2c5c865d733be91978e1279cc45ea20f534e428"
-        "422f72c30957e7fab79da909526d097b4a3a790c2b3cae28ef"
-        "52e5eb4302858110e1bcc31187bdbf79012e770ff95126a7a0"
-        "4b4059e2a9f9f885a6af3d5d067148e05bdd01bdc8f7a33b47"
-        "5631f89a08e92e61a25618846b55a2f42ab42c56ce3d3948fd"
-        "f515b90b344f726bfe8543a93367cd5d95b08d4da0bcc7b2fc"
-        "65384a51eb16766ee2ee3bdf82b6cf24c7a81e826d2e9f81e8"
-        "1917ead9c3ca2b0ea0a2395cf4804080dd0cbf4698e412b7a2"
-        "49ddc89bc939e34857437be5fc1586f932a0a10c48121eb5e8"
-        "3a1d4e4bd682d9674d6d42f8ec190dada2ba9c4c0c25392b1c"
-        "fc32916c9f7dd5978badc53796d2c2843880adfaff7d83b73c"
-        "5959b9a7424715d2f7a47e1c0363c7d3f60c332c8bb39b8656"
-        "08c1035c2773f53a0edc2582182a5cffaa5acd15820daeff16"
-        "58c64ac4b579f8134fd1db297c1d4d4dd03b4f063a293a2cbd"
-        "a3aaf381e6cf54a0cd949e5ed2473852484566db89de18654d"
-        "8efa020ed963c9d26dbba50a3de5f0c3b6e72b477c8f26284d"
-        "cf561c3df5780cef6197039cc076391022a0d57845e992e3b5"
-        "2189c95e92172461838b14f014f452ab24460be82113d41f31"
-        "47e210c03f8430b223836d1efe5ef96bf56708dbad033d57fa"
-        "74beb1314c1abf1b328b4145c359bc4b6befc94c6bec8762f5"
-        "feaa4f14f309e5e51415479d1f16821528b707599eb530a898"
-        "6b751ccce0d17055894116cd032af55860af016dff76fa14ce"
-        "b606c4b277f5968f897d91b544db7cf0de9fb237d599000751"
-        "7e0aab7a73866d498e76f772006d3bf2387c552ba3d72e3a6a"
-        "a324edeea5989a45b0468ec514127156141de06e22c78347d6"
-        "dc48c07dd42b1a9c543deed9006daa8ae676dc328f7dbc5d90"
-        "02d2f481f9cc4c7b9a433377bf61d0d75eae143ff8c7e7e0f0"
-        "9a805ee12e187c02724a9c5e6789dd2a5300753bdfcc1c964c"
-        "818d2a45e13e4ba89ea90fdd45b40a1b76079cbcbfc717162e"
-        "b27d7a902f213646ed65e7f00e5fbc0cd74bb099e00ed350b4"
-        "93225e88e5693d999244b8d0f1f9bbfad03e5223416fd790bc"
-        "c6e047abd1523245c6a46d397f63b38ecebaf79234b53b9b02"
-        "374cdf7bcaa9558043e1018eb14ec31b1fb56a7e6aa6730108"
-        "12cf5abc0ed2ec1df75a615632f59968a92de6cc183c4c1555"
-        "3fe5ca263cf3cffd1342e60975ac2de843f5b5a6314e382dd6"
-        "a6887b87e29f9b31b0d7a2dc31e9f07212fa0c2e69db50d30b"
-        "d676460a94a9822f5aaf5af01bc566136da7138ba69554577a"
-        "2ef2f5d91051ec7ee3645a0df47bbea49e2a47c1279e3510e0"
-        "8c89c9d5b20966125b582469b13d99308119423dab451f29b8"
-        "b4f6ebeff94a06c74d9f6e040c269c39b1c5942cd96f812b35"
-        "b047357ddb08863649a13cb38a4e10d047b8aa84a81870de3c"
-        "d774a4b6174291bc3731437aefa7dbbf2af9c497dec0a90a36"
-        "55395944fc6a0c3e46326a10d905fbd5cd90ccd46baac32cff"
-        "4f6e48936de047e3eb24cf7e7e64ac7616ed8fe0ad751daee7"
-        "bc8e09ab4447718355e92fbd583a3165466d722c4fb0f904d8"
-        "65b77b99053db2709ae3c721b714ae8bbdac87fc0b81a5c5dd"
-        "c2e042e3155801276efc14e508e5fff27ad21ff1c975657373"
-        "20b1344df216188bb3872a28c11ecc1aabce8cdf9749b6bc67"
-        "39628e3f35b531a32dac218196becb2945904b35079ce2bbd9"
-        "7f811fb71c2fa1d9cc5ea65a9d88ee77ab2a52e48e8aaf4e4d"
-        "91679618ffe441b8c319bf6c6589e118f3abd0f8c22fc930af"
-        "64e1b0e4616c1f5f94c50ea240ea8cdd7d57f9b7ee11c3516f"
-        "16115bc995e586f3483ca5be4bbf1c1fe4578934f77c03e307"
-        "f6096854e9a93d28cd7331ce91371a2f50ae608d1f0348f8ce"
-        "3ce48eaaf83f7195ea7b3fbcf4b331d4a2c7f21843b745164e"
-        "4b71678b8ea41580feef7db43f090915ec7edae77eb058d37f"
-        "a04571f4bad32d08d364301a7f0fc633fdfe3f9695f0edf8de"
-        "2187dee171988c47da64da030fcbcfd8fc3b77a59943d46927"
-        "c869e6065b237a0d9e32a72cf0e15ae969b0672a5f5835cdba"
-        "88ce9173abe094d95ae7acee85e176fb826b9ffe01ca860f95"
-        "06540e6f415a9c5ba8ad9a8dd306188fc1973dcd33f75c4b58"
-        "f5d6a6df6a5ed88f4514690dee844b77c5fc6bb2090d5b6364"
-        "fc31b0ec50e29cca44752024bc3270f553570ac196066eb1f0"
-        "4e09be04b7301a915080ebeaea4c749c04f2d4cf79c5805d08"
-        "beb34b966fbc5e153f80a00101883c93861bbee60c52470053"
-        "546aeb57e487092b60884ab20f738f87c9ab6bca2a3370ffaf"
-        "745ccbc44bae13befd29deacddb38d0124e02ef8aa656a87f7"
-        "47e0deac35e7fe2f191ed119a6908a909222deffb028e5e12f"
-        "ea7c3be122fb684ebf83f8adcba142affa7753e27370b493fe"
-        "d258a4db5068042a9e4db38d160f388f4064dfd13b3bbfe95b"
-        "cd6176ce99fef56573fc8141bc4a290202b2437df2886f2dcf"
-        "b693d3110b78220a7007b695bfda744a356cbce15814d2eaf7"
-        "1e322e9542d4933c7051e83f5a1636c72bda12822d803ca4da"
-        "a66e5baa793271a6b301d1ec7a818a4b5ddca7d1141d830883"
-        "cd1586b50b0cdee0f4d445752b2716b5cc44d8b2e1149b4ec4"
-        "ca06f87fa7be9b4aad509804b64f3edebba10fc687f20d238a"
-        "39f3b219c2e8f8f6f3533671843a521a457df1dbccc54b624b"
-        "a0609fed10acfb9b3442bbf93f5689415d4243a06f53958e06"
-        "f28b7b4e5d08ea178bc92eee27adb94f002b7d0bbc0da40075"
-        "2421ab4edcce592d9996d2472b967043d20";
-	
-	/*allocates melg_state_init*/
-	melg_state_init = (struct melg_state *)malloc(sizeof(struct melg_state));
-	
-	/*initializes melg_state_init*/
-	melg_state_init->lung = 0ULL;
-	for(i = 0; i < NN; i++) melg_state_init->melg[i] = 0ULL;
-	melg_state_init->melgi = melgi;
-	melg_state_init->function_p = melg_next_uint64;
-	
-	for (i = 0; i < ceil((double)(NN*W+P)/4); i++) {
-	bits = jump_string[i];
-	if (bits >= 'a' && bits <= 'f') {
-	    bits = bits - 'a' + 10;
-	} else {
-	    bits = bits - '0';
-	}
-	bits = bits & 0x0f;
-	mask = 0x08;
-	for (j = 0; j < 4; j++) {
-	    if ((bits & mask) != 0) {
-			melg_add(melg_state_init);
-			}
-			melg_next_uint64();
-			mask = mask >> 1;
+	0x2cd8d758fa7b08a8, 0x78fd1e43bcf4bed9, 0x4dca3c10390b1ac6, 0x69374255ecd0d4ad,
+	0xf2dbba79989b4975, 0xb82b1758598298f1, 0x328db9c290433104, 0xad41255834c03de8,
+	0x85269c35cdd2e891, 0x9588affe8042e314, 0x30f969e9cf04ebbb, 0x62aba4e1064613b2,
+	0xaff94b99ea4b0bba, 0xf1afedcfea6a8a9e, 0x9dc14343cb0906fa, 0xf2fb2b12de8a3387,
+	0x9c9eaa246aa9dbc0, 0xe5a98d16d0ffc45d, 0x8ea4940cd3bc82e5, 0xbc982aaa3df23358,
+	0x705b77b9bfdc2f3b, 0x1d88d6f70ee2165c, 0xe31782307ec9f948, 0x18a053636eddac23,
+	0xa5cc30829011b36b, 0x9e29b7efcea9cfaf, 0x18790fde77a597d5, 0x0e91ca7f6fece8d9,
+	0x9347e7be4c49eb64, 0x9d57c4f665f0a053, 0xb2ab6795e6dc1505, 0xef523db26662730e,
+	0xd68f0a3f6ae11773, 0x7c86663e686ed821, 0x70b775aeed00dc2f, 0xa06fc05be67bf064,
+	0xe220e045fdb885d8, 0x520280078a85d5cf, 0x77ee8fca7920cb88, 0x3a7632f3ff3ae432,
+	0x58ce610db17851de, 0x3d0221370a5780dd, 0xd1659e6c43cbbfa2, 0xb1e1c800bea24d94,
+	0x799fa9a333b8fe51, 0x49c5a8e45b26d6a6, 0x3247d919e8a516d7, 0x31cffc66dfd3bc66,
+	0xd33bd17fad65fe6a, 0xc6b859524ac680cb, 0x33c7f85c9d7906f3, 0xd3b27a0bd04487a5,
+	0xfdd0e776b9a25886, 0x69575e11df6b61ea, 0x3d3b0afef51e70e7, 0x6d53f714352661c6,
+	0xaac9edd9a9b7b6ac, 0xf1dd0459187a3da3, 0x394f43222d3fa726, 0xba881040e5e73fea,
+	0x3d346013c6651d85, 0xec4eb8d64acac719, 0xc4950ab530dfe038, 0x7dcceba613a34f77,
+	0x57a2339e4871e989, 0x4ef44214272caf04, 0x95b9ed5fe7ea90c3, 0x9e5c52de90b64a90,
+	0xa74af714753cd430, 0x3d870881a140c2d7, 0x74809efdbde188c3, 0xd205e5648a9ff0ee,
+	0x65a11f9f95479a02, 0xda07128e60babcf5, 0xe2dcc5ef13bd80bb, 0x86749710591f8c6a,
+	0x2f45aad621186a45, 0x129cbc736a342d54, 0x4ef22cd09da8afbf, 0xb3e6cc95c2a17fd6,
+	0xe33d05b2b10da9ba, 0x68d78a521ca63f4d, 0x6d41fbdc7747766e, 0x74b6417815e324f3,
+	0xc39b57e8981781f9, 0x2f3a9c450570d453, 0x1962fd30bb010201, 0xd913bb9245ed4827,
+	0xa7dec2ea12c79c93, 0x3085054c9f61a83f, 0x72b85c17ad784812, 0x42b6b2e69b416bd2,
+	0x395d45b5b098371f, 0x4c3f38d49ca43032, 0xb5d1e9abbef93689, 0x011c21434b69eca3,
+	0x9a3cedc1beff5fb5, 0xef4ba8e242e59d9a, 0x6fcbe3c6c0387e25, 0x6a61d9cdd134cc30,
+	0x5cafcee43ac08310, 0xff3a541841a43b70, 0xff75b041a8b35a55, 0x1f9ead2352631a68,
+	0xb2b83e94db8bf2c8, 0x5c945c60f2dc0bb2, 0xf36781cf55c5bd34, 0xe24b7a7929b3052a,
+	0x7b91db66a2124a1c, 0x9b70405f71b2a618, 0xbc50a5ddb64b93c6, 0x3ee2d4e76dc30fa7,
+	0xbc386af3b21464f1, 0x39c0e986f7301eaf, 0x1eab0544089c6e03, 0x939184adc74997a2,
+	0x28d1c18624e8497a, 0xd06224d54a2f280f, 0x47e28cf82bc88417, 0xc1c44d0c21fc0308,
+	0xe6afd69f7a7f78b6, 0x2e5feabcc0b5db10, 0x4cd8fd58328c8d7d, 0xd6d23d9ac3a282d1,
+	0xaf46e137d63293f7, 0xa7a790cf28f2557f, 0xa84168f8b9e2a828, 0x150cad799ae0ed14,
+	0x0e8b073338aed619, 0xaf54c0b3688291aa, 0x5f6effb680f5061a, 0xafee4d23606d7328,
+	0xdb22ad89be91f169, 0x99abec4df97b0f3e, 0xce5ed5507e8ae000, 0x004eef6e7192b661,
+	0xc5d4aa3e1c4fdcb6, 0x77b724c5565c74eb, 0xa371620da25919a5, 0x7607b8286a8e4828,
+	0x03123b6be2c1e344, 0x77bc2a3958d42bbe, 0x3b6e675155b6009b, 0x4b4009ba3dbef14c,
+	0xc259de32339f812f, 0x757aeb0b86fdeecc, 0x590f07e7e31ffc28, 0x4e403e1874877a01,
+	0xca54bb91e67a3952, 0x32693833fbdcae00, 0x15d27c87a254b181, 0xd8502da2bbf09579,
+	0x68e8e3fd3d39e06e, 0x6c84f4095ebe4d74, 0x3dfa700fe7a6b762, 0xcb7007990dd2eb30,
+	0x96a7117a44c92d0a, 0x9f8f0b1d224999bc, 0xf682c44a7c0b5fdd, 0x8bd5e207633d09eb,
+	0xfe9cb62563a24c4a, 0x2c49ef5d7371cdc6, 0xdefb32ec40d9dcad, 0x718087c201aa9553,
+	0x7e56adf8d8c3728d, 0x5af3481080ce6556, 0x865aefb8374b703d, 0x67b4951699af4c6a,
+	0xa7fcaaa8323c1833, 0x42c8bff3cf3c6453, 0xafc217b435ae9067, 0x656bb41c728c65ad,
+	0x0d8cd9f947e1de11, 0x484e0f978c3b45eb, 0xd0cb0adb9674305f, 0xf441952950626e6b,
+	0xc866a3d80f5af55a, 0xea2aa965d1c8e5b6, 0x378a089baf4f745e, 0x7dde2fb05a26c77e,
+	0xac79e483e2547925, 0x904dab9391310708, 0xbc8d96241ada4866, 0xa2d5bc4298810c99,
+	0x9ff7d76f2d1d94f8, 0x302076f9b2e36052, 0x9b3429a38d9c3964, 0xbeace20dacd481f6,
+	0xcd3c85926c6110db, 0x21551de20b087251, 0x252eeb3c7b0e1815, 0xc28cec3d8942e86d,
+	0x239f54fddbe5f75e, 0x9caa6c5095037be9, 0x4c627c30563f229a, 0x09b3abdfa09b0856,
+	0xf2ff34c355d62b33, 0xd7c7e207b6c91276, 0x686e35267e7ef324, 0xe775b8aeb507f1b7,
+	0xc18ee222d590713d, 0xa68c5c1abdf497aa, 0x209f0df2344eb662, 0x4dbca099deeda61b,
+	0x7528ed84e3c7590e, 0xa581d03fe135bdd1, 0x1aa8c7420743bba3, 0xa710a7283f76e480,
+	0xae938ff84b5e4fff, 0x4fb22c8d04cecea6, 0x831454e1cdd11868, 0xe9fb3173d5583378,
+	0xfc71469ce63d6d92, 0x818435b4c58cadac, 0xacd209a294d37d69, 0xf881fe9bdd4739e0,
+	0x657a339b85f438ed, 0x4a54d5ee7711b95a, 0xe689b272f5517127, 0x98c31d8227ff1869,
+	0xd5cf188791a636fd, 0x26f50c93f4431f0b, 0x29faf83686270d87, 0xbebb3157024570a3,
+	0xf68ac38877ed9fea, 0xcf61a7a993da8868, 0xf838fdd27da53c12, 0xc7c03eef2c91ea27,
+	0xbc95972a16906fe0, 0x58ec89738cceb314, 0x12c0f8b106750af4, 0xfc1f5571273c731f,
+	0xcd2f3dfcde57a98e, 0xedc2184fe3452b8c, 0x71d1e68ed27268a2, 0xfc2dbef77f01a825,
+	0x7ee75b7e37a89090, 0x2f8ea205fecb1a0d, 0x580c26cb10b4cb5d, 0x69fc7fbfcc63f0fe,
+	0x7be1847b1fb70fa9, 0x5b265be231198e87, 0xeedc3f1bf3d3f0c0, 0x9613e4962bc299a5,
+	0x4c79b05ec4da6067, 0x0d96975a870f34e5, 0x115db3ac1afa54e6, 0x5a9b2907d5ce8973,
+	0x41df6e87a17735e7, 0xa9f06153807ff9d6, 0xda395a82f6702a60, 0xf11860cbb159b515,
+	0xd23aefccb3bce983, 0x1b7a56fb656baf1a, 0xd22177b09628a2f1, 0xdab0904dd63fa3ee,
+	0x470a370d8c3f26c6, 0x4c3d2404ae225339, 0x60698350eacaaf0e, 0xed207d90720f8d76,
+	0x5757d7010a89580c, 0x9ef32b4f20392e32, 0x69d2cd7d10ba01a3, 0x800501fca87a3df6,
+	0x677dd861c93c1180, 0xd7562aca00e24a30, 0x521106d490e127ea, 0xd6d593e1f1cef04d,
+	0x3a2ef5ff0ecc5453, 0x94bf7dc875d223d3, 0x072480b1cdbb357b, 0xe2efe156a6551f74,
+	0x98f47fe7ac357b07, 0x4909510965988b78, 0xf487a7140dff7b44, 0x7216df4487dc3e57,
+	0xf54285d3b51fc1fd, 0xc92d0ece47caee5f, 0x20160adb251a4b7f, 0x1cf068b1cdb27954,
+	0xfddcdc8bfb2602f1, 0x7f99736e86b3da97, 0x523d82813fcea6af, 0x114fbec24d404094,
+	0xd088cbc96df3b4f6, 0xfda96de00e50441e, 0x1a873d36ac522e5b, 0xa9744c78ef574b28,
+	0xfc178a0e3cc92b42, 0x41485bd4e36c685a, 0xda76655b253c01b4, 0x8b80cd658e4c9e55,
+	0xe53bbad251815e37, 0xa8b3c110c1b8288b, 0x2b2f077b30d0ad61, 0x2233ad68e4d4aea2,
+	0x532372d928874d1b, 0xb552d97de5fe1f60, 0xdd7b7cf26d20190a, 0x51c4b04fe163f085,
+	0x6f1f1743984dcf9c, 0x584a5c218e6ccacf, 0x46d2a333db8fbea2, 0xdf3508b7f90605d2,
+	0x916afc9fdd422cd9, 0xa9caf605c242ba82, 0x10ba72ded14f6071, 0xb5e4777493d1e857,
+	0xb03dd0bed400f29d, 0x3b72d58424ae0025, 0xd4e24b6999b49a73, 0x000000004bc20e69
+},
+{
+	0x30fd18099e3e390c, 0x25ea06f85ca9b819, 0x0143f6124e29ad5c, 0x2d20af1fb8405b70,
+	0x1f4b4dfd388a7831, 0x39a40cfa35ca88bc, 0x3c37d49b5c360b5e, 0x48f5575b052e699e,
+	0x16004c8ddb49d871, 0x229f49aa811d92c1, 0x5ae35833aaa82145, 0xbc66c148ac19ff50,
+	0x7f984d8438b0d9a2, 0x6e9d20c22ded88e8, 0x31cfbcee67e0606c, 0x5212ed83b02ed54f,
+	0xbbe5ae43f8a34a7e, 0x5337fc747559e12f, 0x304f1b0f7f8e1604, 0xb6b0dd3b1a0e4179,
+	0x9fb254b601d2ec5e, 0x6ec90d6a2460aca0, 0x8cf5fde5f3b86e2f, 0x65a0be4d61eb0838,
+	0x236a01100d354d7d, 0x753a94d84da77192, 0x750fbb75dba72672, 0xa1d4c1ac91b57845,
+	0x57b4ee1f7239b092, 0xfb16e3665255eb26, 0xb1a6b11458830ca5, 0xa58e0f36bbc97c7a,
+	0x9559bb3eabba4bf9, 0x3962f053e989a2e7, 0x548e62899cbce3d6, 0x13e557542b4e951d,
+	0x0abb2d0b74798fb8, 0x3031335b3b6902e3, 0x99fab20033228944, 0x13f4f96dd1176fc1,
+	0x74ae4c0c27b618e1, 0x0fe7d07e958139b8, 0xe5b9798739859759, 0x9738ccf8dad1faef,
+	0xb9e42f28eded92be, 0x0c8ae0ddee47f1cb, 0x3e58415164629ab4, 0xf9692929ce7233af,
+	0x026c5eabea44157c, 0x6533c2054d83420d, 0xa015f70b732b420e, 0x01394be56923e02c,
+	0x755151c6da313024, 0xb0f54f7bd858d8d5, 0x4be7174cf2ddd010, 0x3299f0198f4125fc,
+	0x532e3d591f513b56, 0x6c9c186dcb25798f, 0xfc422b97a63bee08, 0x94ac6195b6de8dfb,
+	0x7d3d944569e73807, 0xaa54dfceb7ed51ff, 0x8d2869bec38fa3bb, 0xa472c7f893a9d5de,
+	0x59319bf3d51c0d3c, 0x831de05b75590942, 0x59706241f8e3ee7b, 0x19f8847394ce06cf,
+	0x66e2a909d84c08d3, 0x74e47072f0dec5ae, 0xbb81c1d5ca552b63, 0xb3703d84ca92bfc9,
+	0x9c705e1d1bc0ff84, 0x552a6a85acaa6027, 0xb6b229e34bc704d6, 0x95564f35e12046db,
+	0x44a951e2844257de, 0x91132820b566148b, 0x54a059a6e2fbc05a, 0xbe50e779a0624cc3,
+	0x236a8cd80fb7767f, 0xa1aae75797219893, 0x89a7a66b5dabe539, 0x8bb8f6d56401c927,
+	0x255584c85b3588cb, 0xd1a54f800327737f, 0x114e4b21c6b1a849, 0xc0e2221e5d778321,
+	0x352ccd153f015a55, 0x6a0223ce72ea86bc, 0x7b5a396fd96c3e34, 0x8d7758b6c4a0dd93,
+	0x627de208122489ca, 0xed75e4555b2c33b9, 0xb65792c5b9671b65, 0x82edda0ba98cb344,
+	0x6207a4425ef1fad6, 0x1b6e2a6e1d3c0e93, 0xa03c4501fcb2f4ac, 0x96d98d7f5602cb51,
+	0xdf90b73117b6f921, 0x55ffbf978b66ee14, 0x0c07afa57e11633a, 0x7c6dfda4930565cf,
+	0xb68eb75ca20c3470, 0xe444483c578610bc, 0x74359d873669da53, 0xbb4de53a4f9208cb,
+	0x41d446a42e2cb0f6, 0xb21147134092e79c, 0x74dc36c8c8895192, 0xee0ee97befc1726b,
+	0xbddfe382259bfc49, 0xfa6a0c0e9e312624, 0xe4bdf09d7134f567, 0xccccbaa25dfb8145,
+	0x3b11d26224a3a61e, 0x4134c2ed9f8cc703, 0xebbfee9065181f55, 0x39bd36b3d0bb8c25,
+	0x88f2574a07a0bb23, 0x3fabc631b5a08b65, 0x0826d40307c91b18, 0x21d2be59fd6382d6,
+	0x3e8fc88de5cf7013, 0xdab5a822dc268d5c, 0x380f88fb1ad13c2e, 0xbb235a39dcfbd13b,
+	0x89428cb52a612227, 0x16153d448226fdb0, 0xb64b79dc7be74e1d, 0x4105edefe793a8eb,
+	0xb9a3cc709bf553ae, 0x656c574b94a8f57b, 0xdc2efa966043b00b, 0x42cc73ddf5212616,
+	0x594c93584004a488, 0x1654977d20765512, 0xc41e4a819767345b, 0xef92f56ae4522864,
+	0x57d380406c3e954b, 0x63ec5a9a87c7d132, 0x99572853f535ad8b, 0x9dbca6814c2e6085,
+	0x15706409f8024515, 0x8a66ee4d72c0db3d, 0x80ad285abc5afeab, 0xd8a34a774721b014,
+	0xec41c78c9e506e18, 0x3e5c321b8632bd2b, 0xa821f247c9361c07, 0x71169ad6cd6d4605,
+	0x8332eb8eaf91ac2d, 0x62a4a50a39a5db99, 0x63744bfdf1db2a66, 0xf737c8b8aed22b95,
+	0x13f758bf278ef138, 0x895b31e30150f279, 0x2e263280c0a558d0, 0x2f9b1801daa2c9a1,
+	0xa89ad75f4cd25390, 0x30c25370647d21ab, 0x5e616a198e345622, 0xff5be44a846bc8f6,
+	0xa6f8fe5a0a4c30fb, 0xb66f9ade1c9599e3, 0x4051afe6349fb78c, 0x29758baf123015ac,
+	0x0678627f2b1ff899, 0x1257356aaa6f676a, 0xeeda24abc9697ddb, 0x0dce526d788a38cd,
+	0x4b84d5acabea56e4, 0x9ce3de85f7fdc7e1, 0xaa8586bae1b813ca, 0xda9ed964f8d8ff25,
+	0x316680a683fabf6f, 0x695f7cee5050d341, 0x7f93c15ffa28a55a, 0xaef376c887c0156a,
+	0xb4fd22091ec73272, 0x74c84f8edaa1482b, 0x29fe778730ecf755, 0x4215ef881b8e46a9,
+	0x96e4d18e1a042595, 0xfa77bfb81fac3555, 0x32e0d65232c642ce, 0xc1c66abc92457c92,
+	0x982da8e806394934, 0x2c5454ba03fe2e30, 0x126b1da17316f3b2, 0x22bbe4b928fb5543,
+	0x64a5bf065efc756d, 0x8d3dbd23a14bb860, 0x745458a7bc7b61d4, 0x0b1ef1f6586a7dc5,
+	0xd020f4d0cfbd7799, 0x9d1863d1c1ea2df8, 0x65082acfc8740da2, 0x6277e72c2d8ddd53,
+	0x846ab7ce72b99622, 0x8bed673e935fe02b, 0x1a0ca943db32f75e, 0x7cffa45876b69acb,
+	0x5fdbe0a14f42e547, 0x916dd849bcbf4042, 0xa1049eb7a3821b60, 0x4063dd5479b3069f,
+	0x34af04f876193fdc, 0xb6ce78dd5241b8ac, 0x06504a1c1c699451, 0x5de565e60156f33e,
+	0xd7f4844b06811808, 0x829aa39b0dc050cf, 0x3abf52b4f256559d, 0xe804cd7c08880a8d,
+	0x0b651d094e7f30d1, 0x1c7ffa399cd07af5, 0x49eff9da563aa9e3, 0x29062daedba2150b,
+	0xf9c1965fda7f506a, 0xb23a2fc73aab5ffd, 0xfac8c2ae15e8d96c, 0x9c228ab5a9b6198a,
+	0x8f25425d84f04e9a, 0xfcd3b84cf1da465c, 0x82db912d0072edb4, 0x5ad3242b7c985376,
+	0x1a4e572ea381eb3c, 0xd6ef4c43f956e829, 0xece8c2cc4cede4d2, 0x99b405f488700304,
+	0x629572fe2beeed3c, 0xb4a3029e1cdcafd3, 0x26a04147ed484924, 0x2ed8f5f95a5b1ad1,
+	0x3490715162a685d8, 0x3ad52e3715fbeb6a, 0x5dfb1b538beac24d, 0x561b60189faa5290,
+	0x3e8bd7e3096a4692, 0x8fe505b001403470, 0x7af9d9cde3e7fc51, 0x99b97cf6facd129a,
+	0xbf6112d8a48c3c64, 0x7a01dcce585e6d1d, 0xb6a46bb155b5f8d7, 0xd439daf4e864cfdc,
+	0x7352128dc505d456, 0x6b1b7e60a93868e1, 0xbe4638aa4c71ece8, 0x0b196fbc9abe2ec3,
+	0x331ad323c6af3f4a, 0x8e2a87970219c142, 0xf61ca9e88ada52ec, 0x3b39b5058b584378,
+	0x3bdd3171ec63b2c5, 0xf924e4c6391706cb, 0xbd2fdb7d9e679abd, 0xcd392123fb827a1b,
+	0x2287a99905475b84, 0x5577372b48285ebf, 0x6d9c0debe35742d7, 0xd4927cb39fef35e1,
+	0xf8d0e3699e7cb490, 0xa0510a58a05d844e, 0x53bfbfdc743b3623, 0x678c0cbed75cae5a,
+	0x4b2c4b864fb821b1, 0x71292016f005f98f, 0x8201d45e822fdbbd, 0x287c9a165e9f0b66,
+	0x60d182501ff7234a, 0x32bdbba350bedb48, 0xd8274e369079de52, 0x581b15dd12506dfb,
+	0x326aa30f754e1f41, 0x45c9b56b70f828b7, 0x81341c9ef9c9ff0d, 0x1bf5d89fa71ba159,
+	0xf64613267006066f, 0x325d8181230a0881, 0x882b9431d864ae7c, 0x4defd8b6278c0901,
+	0xfd8ab0522b000d25, 0x3491e6874a667fe5, 0xb5610b0c8b75826a, 0xecca6b1155a16cc9,
+	0x3fa9ccb1357818b3, 0x1dca7d1977f446e2, 0x97f28d5333d834bc, 0xcb06e5e2a3c9e745,
+	0x5501977afab98e14, 0x28f78cc3c28ca25f, 0x1f1d0228b2f30948, 0x66f211f8584236c7,
+	0x1fd0728a5f72799e, 0xb3a61f20363df04d, 0x209f8af68bd18c71, 0x63a9327c3fe03905,
+	0xf9c09d99c78477a3, 0xfc14b20079e0c513, 0x086a9acb043ee8a2, 0x676d43a5c9b410b4,
+	0x3eaf199bc18a0716, 0xdfe3942063ee1077, 0x00f08f7391116678, 0xa12fa43f7f1dfbec,
+	0xf66203fda09cde4e, 0xbb99040c1e901339, 0x06a0359f17ebf0d3, 0x00000001d107a0d4
+},
+{
+	0xb702a7e2c21433ca, 0x3f01703efed322bc, 0x4237186cffbae9f5, 0xc2d323c6596183d1,
+	0xb87ebc4be7787a57, 0x0a1058e77a937819, 0xc3bd48361c32eae2, 0x8a02cf554fc5d2f6,
+	0x4801d6bed326db67, 0x4fafeaed79ec4a58, 0x520674b04f80fc96, 0x158c2a3ced991b49,
+	0x822c20bec9e5e0a0, 0x23f053f5a864e9f5, 0x031a1f471f364f35, 0xaf8ef842a67ecbc0,
+	0x4c092461b26f59cb, 0x66a71a7c750405f0, 0xbb775b8fe20c7993, 0xc55ccfc02b592e28,
+	0x9704ff2d522622a7, 0xafc41420a3b63a6d, 0x8232953be9bbab70, 0x75599d6ee3663a10,
+	0xc2b3c6d849dbe230, 0xfe7555579fb3c766, 0x77326974ea63e924, 0xa2421a82d6b6cd6f,
+	0x1d9e1ad42afcfbee, 0xef367a9d34f84e70, 0xd599802bada552f0, 0xb4f65863c37664b7,
+	0xa7c3ec2406fe5df3, 0x37a07a398a492612, 0x812a3cd71f91cee5, 0x3aa02540b362c059,
+	0x00bfbee78394685e, 0x0de4ca1e6760e97b, 0x6ee7a83a70388de9, 0x1815f1e6253a6f7b,
+	0xa3c8a6a1015be725, 0x8e03191226d29ca5, 0x88c82fc0603163c9, 0x18afb8f2982cd78d,
+	0x9d8f4c50160b0a2e, 0xb2d61b150e18a3f5, 0x1854f74eb49ac473, 0x39c6e0640046b07e,
+	0xe95693878eceddb4, 0x542acaa508f78eb6, 0xab7771c08a7136c9, 0xadc2593b41737b37,
+	0x067ccb54548c6c14, 0xbff011809b2afc86, 0xb1e4335c66506b06, 0xcffbab228fe07c9c,
+	0x69f94faaef108617, 0xf63fa670bdac4b7b, 0xb1bccd06f85758a6, 0xb822728ab295e963,
+	0x3218a2779513b73e, 0xb5f46ad09c3e4a17, 0x10d530b82e5885d8, 0x4450cec5c37e7bce,
+	0xc962c50535e43756, 0xe7cc548e2ecdaa52, 0xc0eae5e78aa3ecaa, 0x487c99ff4bfe78c1,
+	0xd7906c92ddb70a71, 0x8a63167bc283a53c, 0xf7664f26d2ee1902, 0x07ab665cd0711570,
+	0x6272f70747e7097a, 0x54856d1484e38bc0, 0x4323d82f07ece470, 0x7ca427ab06459a20,
+	0xf32bfc15c75681cd, 0xdea64b5af8c42f28, 0xce7c602263830dda, 0xc21d570d02701786,
+	0x1f66347e9bf0da2a, 0x56cddaa6b9394493, 0x207e06efeff7cdb1, 0x1da830828adaa946,
+	0x1a3a9f8f73b7c622, 0x75cc0aa22e34afe2, 0x1927a389a15d902a, 0x1f5cc7703e8bd5f3,
+	0x1761610f1f2df128, 0x74e86171fbfa5966, 0x5049d19481340e3a, 0x672431e1aea435af,
+	0xfa3fe0bad540bc23, 0xfceb5e5d049e3b01, 0x0678d018a1635273, 0x3c27d21c0c991bc6,
+	0xab18ee0e3e4ce9c0, 0x31c5080e7f04918a, 0xa4e2f074d4a3d192, 0x82d19a31b5ad3175,
+	0xdc63b86f7ee4de44, 0xe3a8f39be24bf098, 0x4ff937577dc9e852, 0xf3c734d512f5026a,
+	0x8957550e679014d3, 0x266cc9df667b6a7c, 0x006d1b389dfa77d6, 0x1bdbc93d84baa696,
+	0xb2f636c31ebbb7cd, 0x8d2cd9be85c3cb23, 0xfd08405e7cc0b577, 0x4b395c3d5e5cf19a,
+	0xc9e7e2a343d7efcd, 0xea0c171594811262, 0xa436a0ced6e739b0, 0x15036e52d2d04481,
+	0x7c33d1dfffe49566, 0x7ca3af22056960ec, 0xb7fab586503f0c67, 0xbde42c2f2acceb48,
+	0xbd99c6510a5c2b1c, 0xd42cafe216816ef5, 0x1effa87f62928cd1, 0x4da9841d391bad81,
+	0x0cb03a0a8867790f, 0x77dfc08e9f090a7a, 0x32de8596b83fc1f2, 0x9ae969a0ec3e84b9,
+	0x100c65e2e28705ca, 0x68b02946d7dc37a4, 0xe4ff7be4032b053d, 0x1a4cf4f41e9f3473,
+	0x34f3736aff7df889, 0xa8077b3124cd78cc, 0xd4302958c9836cf2, 0x0b941d3476d704da,
+	0x049cd969195342cb, 0x76cc5fbe4999f3f9, 0x679330dd19353c72, 0x3076c02c81bf4703,
+	0x3b22e6bacce5931d, 0xc080a887a7e1ea88, 0xf513325e7e8860b2, 0x9765b338e6c01788,
+	0x799e44fe383be0c1, 0xf0b2f4413c0cf32b, 0x343c577ce17d5df4, 0xc8ce86a73d9877cc,
+	0x0faa399b8e3e34a9, 0x918c57c377f9b49a, 0x64a008e3a958c33b, 0x144899b505564b62,
+	0xbf34e2d8638571fa, 0xf7bc602864de8f8b, 0xa84a0ac43e131550, 0xed5c269d82f7b742,
+	0xc7e86435b1d4b2f0, 0x645d12ea29eee894, 0x9f1b940ee866c169, 0x237bd88037198a43,
+	0xf0d40afb223c589c, 0x965805ecb2b64197, 0x8365c7148942af4f, 0x407a47176ebdb24d,
+	0x34670a0a089f13e3, 0xa49d2192bcd7413e, 0xd3442d63246b78a1, 0xd47cc4f0ca09ac5f,
+	0x3193621eb73b4215, 0x0cb929fcfcf9cdc0, 0x038b8d61be0027cf, 0x9fe711f3d86e3973,
+	0x8f8a4cc6b8378b79, 0x793dddbedd9bb8e0, 0xd976355d9f1ebb47, 0x367f17c422e87004,
+	0x435c3229f3a22800, 0xba58462789d6bb8a, 0xa70dba06e0e91a20, 0x4f95a9b5b857ae1f,
+	0x30b32329c1c72b68, 0xf3d4d48eb03ad15d, 0x8da0d92d523d8573, 0x383173b2f5a136d0,
+	0x0517c4ee24fea173, 0x72019722be695e9e, 0x818de7e04daa09b4, 0xc41f8eb36e455691,
+	0x57dabf059c73b1e0, 0x724bd691fb1f5037, 0x7a32231b3715b772, 0x26509bc1bb922b59,
+	0xb2aa7958bd69e89d, 0xd3120ff0df22e544, 0xdcc54c6e16fd7562, 0x0e2f7eea15731f9b,
+	0xbdeec0a1408e3758, 0x3e9a729e0438ae59, 0x65c6b8e8161dc751, 0xe4d0dda2df8e578a,
+	0x9dda3daf5a16c16d, 0xb50851e8e06d1e95, 0x076be4dff212b648, 0xbb34220c3a02d239,
+	0x6b093c3d5ab414db, 0x37f31271ccea4220, 0x5cdfccb5b0cee0b0, 0x937e072c163a33a9,
+	0x579521992ab3c84d, 0xd873e08938dda3cf, 0x5d6c1633c3b7ca32, 0xfe3941364c895759,
+	0xd847849ab678fe50, 0xc40b85c0bf98c490, 0x9246f65b0ede47e4, 0x27fd9475c386e1d3,
+	0x2a1ffac43fc7bd0b, 0x3327da1550834eea, 0xd9b2fe004d23dcbf, 0xcf649271fae1ccf8,
+	0x44a76be62d0db2df, 0x6ba2102db09adb01, 0x4bb6a3a638277955, 0x675581faffef16dd,
+	0xbb9a48d3d3e338d7, 0xc27a823d6b346529, 0xb13b0662c796f1b0, 0xd5c45c442c9db9f9,
+	0xd4a68094f7ee144c, 0x0156edb4e14258a8, 0x92064dec6de3dec0, 0x14971751e9100e4a,
+	0x8c0e29e18898dbff, 0x566d8c0d5c5087fd, 0x606f368882cd2ccd, 0x5cf69fa9f21d7834,
+	0x9dab27cd7f6c43af, 0xd73de9aedbb1679d, 0xdc4670b9134524a1, 0x2ed75899ad1d606e,
+	0x0b9a5e0703ffc202, 0x68d488f90f552759, 0x7f4d15be085a73e1, 0xd2efdef765357f6b,
+	0x6749e3e8819c6144, 0x8610ea899653223b, 0xe0c56640f83bc2dc, 0x95dd08daef1c96df,
+	0x65c9a8ca972c3f00, 0xac8b95580a910c07, 0xdbb5226f06707e64, 0xe7813eb7e4378567,
+	0x4fa76618b530faee, 0x09705bbbcf706baa, 0x7035eb88f1a1d8f4, 0x64e90773dfcdf77d,
+	0x85b6485fc5ff1db3, 0x5c5311ed9a4fdea5, 0xc0f4a892599ef004, 0x837c2de1ce077039,
+	0xaf33de3508b7cf06, 0x09fd8fbfb1ea8cbe, 0x71f2305ccf552655, 0x5306df6a6f8cac75,
+	0x5ae7325c456d68ed, 0xd828266eca262070, 0x35d69ead18df3a4f, 0xfda5874ae0504cf6,
+	0x115609714fd9ab92, 0xaa1509c10a2e8289, 0x21788cecf62b5c37, 0xf4a7498866d347f4,
+	0xc4d4f797217ccb3d, 0x2489ca8357ff74c6, 0x35f59f8ce32852cd, 0x2558697e57e59bac,
+	0x5f74fa860a793b04, 0x115c659b3b39e849, 0x703923279ca1216c, 0xef96a80f52e46f75,
+	0x915480872b5da86f, 0x61ab46561f9a4573, 0x0a1a7c10e618b222, 0x04fc7f99ea4618e5,
+	0xfc44b39d7f13ea22, 0xb992c1c0b0b88b8d, 0x49f4e0bd926a9b5a, 0xda3c28ec932d7bae,
+	0x3edc94ffca2a1edc, 0xf8127dd1ab5b0a5c, 0x13e7f4de09a9311a, 0x00c3c9df39785cbd,
+	0x855b2d28cff5da82, 0x8918cd20b8b9176f, 0x4b7eb7720355b124, 0xad3f3d9fd3215912,
+	0xc4347e2fb77727c2, 0x2ca192601e7640b2, 0x94622b8f5b3c670b, 0xe265952cdcf88968,
+	0xfaf64ee70d9940ba, 0x1b6e3397e9a6b91a, 0xe01857d5071ead37, 0x2c491d12149ad34b,
+	0xb9deabd3a5bb7bd9, 0xdad0bec477fd43a5, 0x40975f9bfa561dcf, 0x9ee804d31d8b3916,
+	0xcc6ba67c0435a9d6, 0xeabd499dbecccc50, 0x91666ab327489d25, 0x0000000059f5ee49
+},
+{
+	0xa0cb5b8ce9b0b60c, 0xdbd94c9e3d1e1334, 0x068719976a624652, 0xcc7d75e0dfb69f90,
+	0x4878183221bff922, 0x438d4d95e00f9dd3, 0xb8e4fd4ce4610af1, 0xb943a8c21d7ba0ae,
+	0x48ed04f2fca742f3, 0xf6bb0c05a6467bbe, 0x4ec10e9448df3585, 0xefa00014306ef09e,
+	0x9807f7dcf2ba87f6, 0xf3b8aac8c9620346, 0x19f8fa83168e8c3e, 0x856f3c372cd0418a,
+	0xd22084d136d01231, 0x62d68703cd847a4b, 0x5fd420b773faee9f, 0x3aaee4d7fd882655,
+	0x9af296e68492031b, 0xfcc8adcf2bff1db2, 0xa28dc2515e5a75a4, 0xd546614bb345e9f3,
+	0x01379a6d14f41fc7, 0x22dc701a610e3979, 0xa924f57de41de948, 0x36cb6fa251a5c70e,
+	0x042051c57a114efa, 0x283493246ff5cd51, 0x87c8b0b4e3e84d79, 0x462e62dab87d238e,
+	0x97e8c0c27efa906e, 0xa3f4bd8ead638e6f, 0x7a213587d93c720c, 0xd0fc97509e8b9259,
+	0xa0e23723e5e4baff, 0xe98c5d48c25cfd60, 0xfb90f29c6553fbe5, 0x56c3b5b152056d42,
+	0x50051dddd7bf96d9, 0xc9b477bd9650cf1f, 0x51bd966d49ce8ce1, 0xdaef1c70c73bad99,
+	0x450e27f3e07d7c9c, 0x60987b2b17ea0cad, 0xff94e1afd57af5ae, 0x34c0d26456f31ac2,
+	0xd42f68490286b902, 0x0989362840ea3976, 0x0e321937c3fd225c, 0x9977cfeaa758a769,
+	0x518b7377e4a3d616, 0x684f53f767b1a88f, 0x1e83e919362584aa, 0xa2236ec789d20fff,
+	0x8c93e5f68903369d, 0x625d0e2d929404ad, 0xd68f84c4b458d945, 0x5a7e9be70c4ce597,
+	0xb3003ad86ed440a9, 0xef8c6991ccff1167, 0xcfbe1219786622e5, 0xb0b85ddb2bccec4a,
+	0x0344d72e69204288, 0xe35200cf86523f7b, 0xcc2f3346c7444b32, 0x081304a9553a0063,
+	0x130cf2f3d73a74c2, 0x4281b85519d98618, 0xdc1b2585f6e8008a, 0x26957761e54254d2,
+	0x0bb3a29ad661e342, 0x7843fecd542cf042, 0x964d70658bcf62e7, 0x3ecf0c6bc352e293,
+	0x65e73c311e70f058, 0x1cbbe5bbdd6dfd6a, 0xb8ccbea5b9600504, 0x0528fbb62a67daa1,
+	0x3a45ac689678056e, 0x711f641c8b1b7acc, 0x8a511439238eb4d5, 0xca0fc9495d64f132,
+	0xa5d335d2b5a9093d, 0x163bf95ad126f70c, 0xa0037295ef54054b, 0x276c68c2d67f9185,
+	0x7036015833e4315d, 0x80493c3450491e4c, 0x972adfec70711c98, 0xbacefcbad9b6b4e7,
+	0x7bf080e55932381c, 0xdda3600168e43ab2, 0xbca106a9b00a56b1, 0x8b354cc9ec184c02,
+	0x6867c789845be1c6, 0xc36709abe0730f19, 0xb97d725f959773d2, 0x4103a098a7bd822e,
+	0xe0a94e124ccca34b, 0x08ae4ea45521652c, 0x106421201c89b3e1, 0x87d9122f3a4b85a6,
+	0x597aeef0371f34e6, 0xb5a54db237251225, 0x3c1dee885085c72e, 0x2ba4125afe00788e,
+	0x278c4ff4ebeed8ab, 0xc241b315086e9eae, 0x2e65a5b216d9529c, 0xf172359b9326d653,
+	0x49601a7ab238213f, 0xfe8d0672e09b4c0d, 0xd1137d78149b9199, 0x1c95cbf8a7b8b7c7,
+	0x876de22d0e3b64ba, 0x7258d0ef22c23399, 0x0bd730970b6960d0, 0x5ac905232b79578c,
+	0xdcb222073fa7f02c, 0x50ac04926859dd4c, 0x5ee7f8c0cafb4703, 0xe39e317e3e212cdd,
+	0x4ec60a93f360b53b, 0x3c5b02449b99b861, 0x4c41232c653fa6f9, 0x7ce40f9d812d490d,
+	0x948aee1e7e673d56, 0x988c93a05bdae55f, 0x763c7e40c7e246a0, 0x1082680739bc5b2b,
+	0x075fe2dbaa9a6f3c, 0xa82161519bd3a91a, 0x354c7aa74fd6ba88, 0xf82f0d24d5ec9868,
+	0xe157e9dcbae44310, 0x7e36bac6387b17df, 0x881e3b025628e471, 0xbad7cc8e8f00bf2f,
+	0x888f0aa1ccc3aaee, 0xb646144eeae48fac, 0x301484cde71d90b6, 0x582d69deceed2ee4,
+	0xc34d563bcd48e8b9, 0xe560cf4b39181008, 0xf93eabe862065cb8, 0x3d6670e8bb16cd45,
+	0xbf3dacf506630fef, 0x3ef01eb24d55594b, 0x314492a0e653da5b, 0xf5d49dc6637ff159,
+	0x8425c85249a81a1c, 0x6d481f17d28e2cfc, 0x5b90db8874e09e84, 0x0ae6d3254279be3b,
+	0x281502b3b43f9984, 0xad6b27a8842b61f9, 0x24279e35bd77150f, 0x62765f35a1aa35e6,
+	0xe96c89fcf7bab427, 0xf1f4c1d4d54fb2de, 0xb7b051ccaf952eb0, 0xaade335ab9b39a81,
+	0x13b1cd1ecc08cce7, 0x952f7e9bfc31ad65, 0x7b5a357f385c31ad, 0x0dd57e342d443be9,
+	0x343d451a5513db40, 0x5a0963a09ea587b9, 0xdb899e76138ded94, 0x65bea9e90c3a18e1,
+	0x287ce057d7a699cd, 0xb126bca862c25fe9, 0x3c0e1fbd26858653, 0xff6e1f78977c3670,
+	0x6b3a4a6820d854a1, 0xef9f4b88ce3e6478, 0x15bae4fbca1d9e9f, 0xd405ba92d5e8af9e,
+	0xb2bc8d99a0d19697, 0xb0ef7fc8cbd90568, 0x7aef831bd7572bd9, 0x67767c6e2ddf0654,
+	0x8a6cf68dfdcb207e, 0x5ab3e2ba5de9d792, 0xa434dfcf0a10d4d1, 0x288aacc29274d16d,
+	0xfd5886f2f49e3b43, 0x298970b894be44c6, 0xe9a7358535c78d4e, 0x4afa97d78884095d,
+	0x24b59852fa30a174, 0x9ffda251589c655e, 0xc0d9e6c0062ca3f6, 0xce54ab0f063209ef,
+	0xfb4d5fdee07c130f, 0xa96f36b54572a22a, 0xd1b7b0782a9a6c08, 0xd51a623bb24ec028,
+	0xda9af1d70030e7c6, 0x7b4175a921de381e, 0x38903165d774cb3e, 0xa218eb0898a734b4,
+	0xfbb35c57f5c28596, 0x5d842697ca36571d, 0x79c84676c4901cb2, 0xa12b34acc0ee972a,
+	0xd05b189a7f99f0ab, 0x84edb056d21b6cba, 0xdcb26f761fba41fa, 0x9d8428dcf1c7f1eb,
+	0x5e3735d09e1a928a, 0x2a6f4795ca2d1598, 0x2c34c2818432a3e1, 0x1151f527ba26c576,
+	0x3e0c7f7afc9fa161, 0xc91577a1b27e372d, 0xa984fb2d7097cf85, 0x3fe60bc5309506ab,
+	0xd48597281ba618e1, 0xd47459b1c533daa3, 0x8b699ab9ad980af8, 0x4c36a39be7c5b274,
+	0xa8f769d316a93bb4, 0xd4dadd95b8258f87, 0x7b4a2f501256da6d, 0xf2bd4157e2699a1d,
+	0xd5854a87b03312fb, 0x1d4cb18b76c4dfce, 0x3bad1ac4991aeebf, 0x198c337134358d43,
+	0x132de333954bd6ac, 0x488578d8b18d28e0, 0x8ae5528647a592c5, 0x9fe892a39fd52cf3,
+	0xb20702eec2e10f21, 0xf0db13eec9d1ec2a, 0x7721a0552cdc1780, 0x917052cbf74a7ebd,
+	0x256dc8c3063f0410, 0xc6542f3cd3adefbd, 0xa724a21cd238296d, 0x870b569747d8fdcb,
+	0x3a7afa5322f8def5, 0xc3c02fd6fb819029, 0x160afae099c7f761, 0xba065051732c98a7,
+	0xae722bef5a5ccb0d, 0xe36eb6762428ead9, 0x5510fe234c3060c2, 0x3f948ac8e41d3ca2,
+	0xef0386b7a7deeadd, 0xcfa70ff2863832cd, 0x83f11d10fc766cad, 0x447ef935df5c21b8,
+	0x03adca4e991bbbec, 0xeb5ac92eb245527c, 0x23e5794a68e8b2ac, 0xf818261ec4f91d9e,
+	0xe491a6a98d6dafe4, 0xa753bb29c6502a33, 0x3d4f8ff32c53731b, 0xbd590401c27ba042,
+	0x73fa14fba4681606, 0x6f3bfbb59574ee8f, 0xe11aac7d0f52d0ba, 0xbbde1ded16624ce2,
+	0x498b62beef5e8e05, 0x6b0511fba6d9b804, 0x5dca17e76a492ed1, 0x16ee1ae3ef590ef2,
+	0x63ed621d3885a13b, 0x07babfe9f5e59792, 0x244f78353c7af3e2, 0xcc425cd9417951b1,
+	0xbdf88b4773f32f80, 0x9c5d47df3ebabca7, 0x05c1f019241f42f4, 0x61a60582345434dc,
+	0xc8bda90758328dd7, 0xc113b4c3570f5212, 0x3e4cced42820ff2a, 0x047a188e7783b3e3,
+	0x576df5258811e663, 0xc9ea05879b936060, 0x611970f86d6fa12b, 0x8ad955106d929589,
+	0x08116d05c4b08265, 0x6cc7726ccbbcafe9, 0x9b49c03e9fc0bd6b, 0xbc505e64143e16c6,
+	0x54115475de8c9077, 0xcb710deb671d5dbc, 0xe53b46ddf6536c52, 0x379aeb80dda21d45,
+	0xe062d34750c118a6, 0x76272741fb9e3e00, 0x35d4851f90c5ba97, 0xb0b550048b471c84,
+	0x3d8efe60a92674ba, 0xa7405755aa65239b, 0x1364cb5a0a63c904, 0xf09eadc79d498bd1,
+	0xa79f6bd61e94dafa, 0xdf5d64cc88ef0482, 0xeb654f18fd20549c, 0xba629bd4852a9b08,
+	0xf26c775d608ca845, 0x710e5fb869ff33c1, 0xe96b336bcd348db4, 0x00000001689e55bb
+},
+{
+	0x8565f8bf9f4534cc, 0x7c5b492e26ad71e1, 0x345292a69de0d9bf, 0x854ba51ed6ffd440,
+	0x08782117f12d1447, 0xdd17199566eb973e, 0xb0d6b524b1036402, 0x9d99991d35e7d94c,
+	0x91bdc9feafc274c3, 0xaeade6fb3f54a5bd, 0x7fa10feefac9fcf6, 0x6ef910d2398110f4,
+	0xbc1fc07bc8a6ed48, 0xb0ad825bdfa464cd, 0x74b12909d9e76392, 0x6b9d364d2b4a7f5a,
+	0x3930a7fbeee3d497, 0x84cc5ce1b018d5f9, 0x6070e0a46f5942be, 0x581b0449a561089c,
+	0xfe8c58fde97cf5c0, 0x78812c8e4b60b164, 0x2a6ff90dffa53b3f, 0xdea6ccb79e2d10c2,
+	0x88b560c27067f88f, 0xe8fca9936edf4f43, 0xef8001987e23d7d3, 0x403af80b907c54bd,
+	0xb67beb36e8b82efc, 0x310fc16aed5912d7, 0x7242ce9bb28d8611, 0x3ef3da4dfa7d4f7d,
+	0xa015bf12e6103f11, 0x0abbfdb536beccc2, 0x194fb6a68599e9b4, 0x4894cc7aa16dc6e3,
+	0x3951abb2c169d7c5, 0x2d8139d7f0d81c32, 0x1486a2604b732f2b, 0xe2dc89404aeb3397,
+	0x78014c24a978ba21, 0xf3cd5a85b20914b7, 0xb689bc17f672cce4, 0x94fbb75357e89a8d,
+	0xf25cae5546b9fc79, 0x34c7041b81ed3c70, 0xfda1910ab27791b5, 0xb0d4fd7f69eaec54,
+	0xdd2a8719f2fa9f38, 0x1bd8fc40f2ffa21f, 0xbf6104702a83d787, 0x7e6a6717a57f806b,
+	0x83ec454dcbae23c3, 0x4c1dc80b24392f13, 0x7eab3cc3652681d5, 0x5ccffc632d715566,
+	0x3f2ab283ffd4da05, 0xd79b7f61bdd72b4d, 0x4dbc7075af06c905, 0xcdd922f05ab8bac6,
+	0x8bc64da7c9aed9cc, 0xcc07a931f20be171, 0xd138ab923a3cb80f, 0x756ca2eedd4a0604,
+	0x1cf4e42da4ca4a36, 0xdd6425b2d9a86614, 0x0d7b2629c9f68391, 0x83d8a513b34fee84,
+	0x0b81534d3852b4ec, 0x69724a64f3b8321a, 0x8c306a4271ce597b, 0x6d91a1a3349f13d0,
+	0x659968aee8cbf577, 0xacdaf3704d196c7f, 0xf0b6b8f36c4b7a32, 0x07ec2c1bd1c05278,
+	0xec97999696a44da3, 0x2f6cee3ee06df459, 0x31d38312d62f737f, 0x5c030ccceaa92c83,
+	0x6b6d1ceabb6252e0, 0x5c221ee185541511, 0x60ba16bd9dd26753, 0x7359eda03656f503,
+	0xbf25d2de6b79ed18, 0xe412bbbdd307a3b4, 0x56ec5034ec4b18c7, 0xdf077c95d9682581,
+	0xadb1ef814f4947df, 0x316baa779d840765, 0x29d45c4cf8c2ad92, 0xaa6f969dad5c4a99,
+	0x3bb33687b8bea332, 0x6f2d17d2b949d826, 0x5734b923a0abd038, 0x29b9c597ae31fc1d,
+	0x79eabcd140aeeb18, 0xe5c9caba0dae4e05, 0x765ee085b6df2d33, 0xac10eb0e94803127,
+	0xcf55312e02da62fd, 0x3a8ab8e0a6b714d1, 0x169c8308ab6753fe, 0x5d167af53342d934,
+	0x5434ccd5a64c3dca, 0xf1df6abbbe027a57, 0x67a1a204280141af, 0x2b88a57f5e1421a2,
+	0x83a2ebb701d85cba, 0x8662dc4ac043d0b4, 0xe6db8c44d41be65e, 0xe283410f19cfced1,
+	0xed3c2ca792f0e9f7, 0x26becdca9ee9ccf2, 0xa0ae9e5e95ae5a84, 0x880000bb629da38f,
+	0x02c8cb80e67081db, 0x1ad0e7377640e826, 0x3cb3869de46a72d1, 0x4411c82d1ab92630,
+	0x87efb65613f60ce5, 0x4d45e223f75002f7, 0xbd1aa07a065ff8dd, 0x26c5381859f22a03,
+	0x91fe88a25a7e2867, 0x33d24acd11d10399, 0x2f76b5a2fb484884, 0x931a9e839b5e3720,
+	0xb0e3b3e6537c40eb, 0x7cb249e2f792221d, 0x445849c7a695c6ca, 0x07885d0bceb2232a,
+	0xe5510a7360b8bb8c, 0x66a8184c28b24a7a, 0xeda7463c6c86a296, 0x1573cd465a8b4f8c,
+	0x1b8b9d8daa16a55d, 0xe6705982f9f45fb3, 0xb77dea0607162d25, 0xd6785bd6ce7b7b24,
+	0x5d60b88c0f7891d5, 0x4d3301c2fbbd6b45, 0x7bc96e608495ebe4, 0x6646b228b2453837,
+	0xbe14a13e759a8da1, 0x4d420a01c42673bf, 0x53fa5ffa2cb35ab8, 0xa5a0b996be617908,
+	0x41c7c11eb7156b2e, 0x7cfaa195db65b430, 0x1fcf8f5221151a82, 0xe1166037fa986981,
+	0xd932f0ff5d2d4c3c, 0x23231a0915a177eb, 0xfb5ab8d8ea5beb5c, 0x86d6aaf43ff1f69e,
+	0xd382e38555510824, 0x92bfbf86f0bec23e, 0x29f4e042c1ed5ae1, 0x489f56161762f1b2,
+	0x5887dfb68c9b678b, 0xfcbc734f1e5db4c2, 0xa5c6563ec9a4b180, 0x77a36fac92413ff6,
+	0x6a0e995008aa3c27, 0xdba7404f32ede627, 0xf7f1a9ef9e527efd, 0xd02513bb9a78a56f,
+	0xb09fe1510a417110, 0x7c14f9690a672d5d, 0xd696a39710a2d19e, 0xcf22e8621dce5c86,
+	0x1d553fa0ceb8ecc3, 0x4e2f3eabd3735d10, 0x52b801eb6eed2949, 0xf8b2efbc6aae8e81,
+	0x3465b79f16a997f1, 0x1a4acbdaa82b4a45, 0x264f892cf660210d, 0xc9d12f0f24f6fdb4,
+	0x4f6c66ca61531d2c, 0xba086f8867c1888d, 0x22ae31e87718b1f4, 0x4ef82b5c7854d5bd,
+	0xb066011369a0f952, 0xffaad2b0d7a118b7, 0xa41f6e921f1c3d2b, 0x8ce13ae29bc5d721,
+	0x12c464b171cb20a8, 0x6ec0b05445549a52, 0x5d849cb2dd0e1739, 0xaaf2e2915f87664d,
+	0x420da9d37e59d1b4, 0xfa0bcfe9cd05dab4, 0x894e65fde4b69ca7, 0xc4800a789df0095b,
+	0x9d471ee4137fbec1, 0xafed4b9d4e3183d8, 0xbd74e91c7871e66e, 0xa78d2e3a7a4cdda4,
+	0xaffdb1036377afc8, 0xeb2bc17856411493, 0xa9735f8e5da5a8e2, 0x1189b292a328e498,
+	0x7ae8893385ecee2c, 0x888785e373921d01, 0xb418320865f4328c, 0xb4331279b5857e9d,
+	0xf7a4403224032580, 0x2241398dac60652e, 0xb9f84adb5925504e, 0xd57e963373eab6cd,
+	0xb1cf0b2f594978fa, 0x9df90006ff78f3e8, 0x89cef12ee57d7197, 0x5f2cf9242b854e7e,
+	0x51d369280c0fe8b0, 0x7d92ee1589e95150, 0x792d69b5c0afe876, 0x5c92f2f8315aca82,
+	0xca05c9e13b64a717, 0x100e957b17b9ee34, 0xc3e4fb748157a613, 0x0aa8bc5f3c2c76e2,
+	0x472d81e94bb8acbb, 0xc43156243dd1a258, 0x3ec0efe9047dfbaf, 0x66251a9082557c0b,
+	0xc49f5cddd4574f66, 0x4fff92c0b4b924ca, 0xf6301306129d1e5d, 0x476e358258b4fbc1,
+	0x6097599f27fc50e0, 0xaf0cbf7050a02c03, 0x483556e3c2f14aaa, 0xeb1c07f059a98eb1,
+	0xd8671ba5544f0f52, 0xa807178e8b5afc0b, 0x52d9b361dc2f4d94, 0x93c5bfdb43a8b122,
+	0x83fc1d9fce2e6f08, 0x5cc6752725dfc9bd, 0x4caf6cd97b234264, 0x05b6b4a56243e716,
+	0x184d5c12a52f22ac, 0xf5faf41532aac05d, 0x91a94666b9bf0160, 0x2d9d3286202928e4,
+	0xe6e7a203c03ed07c, 0x5ef044fad823cadf, 0x1e7b17028cee96c5, 0x64686dc9c018cf4a,
+	0xb33c813859099017, 0xfccbad9c8abf12f0, 0x19652e86d45e8ed8, 0x13c16b70b59063d0,
+	0xfcb6fc8affcee6b2, 0x6225ee44923da34a, 0x9ea75ecfc87e7127, 0x8b8bbf276cbdba25,
+	0x161d1fc8d9619ffa, 0x17e04f03ee7906a9, 0x90cde57513368c0e, 0xd9ef6d3e98fd6588,
+	0xd48d470be4f4a950, 0xf51e80d57cca97be, 0x3f247012aa927aaa, 0xa744c5c5ea410ffe,
+	0x5f1fe07fbc90610e, 0x637b38eddd25e76c, 0x38bebc53eaa1f46c, 0x606e8b05884310e8,
+	0x8dd12a67c157e385, 0xbf9110fcaec96fcd, 0x66fcbec93f4aeaaa, 0xdce1d048ec7e41e4,
+	0x2e7d0162cb1273cc, 0x9f4cbf3094d0469d, 0x15987755016bbc92, 0x2eb81274caa88bd3,
+	0xde66482c67f2bd8e, 0x1e8860980b54af72, 0x0e8abc699124064b, 0x3884553308c4df70,
+	0x16f9482d44fd2e3c, 0x04ff9e8d99d2e05d, 0x87f248191be0660c, 0xf389831e411e7300,
+	0x53697d339c12f9c5, 0x654828426d5f3760, 0xf7f23533a81046ac, 0xbc1a761b42b9e328,
+	0x470483bcee8fcbbd, 0x1586d87193b8e4d9, 0x0320c2066785dd7d, 0xb7f707f800e86b0b,
+	0x44e55f6b8532fb3a, 0x08e1263dbc4a5104, 0x51910ed40ae18ddc, 0xad60cae340184a5d,
+	0x29ce70499998ea13, 0x162617aa8e6a6bb3, 0x2fc988ddbf8c3c57, 0xbd8aac1d0d6def90,
+	0x5d60d973b036e13a, 0x317b56af01b4405a, 0xa0401656393bd429, 0x34fbd58edba2d8f1,
+	0xc2be8298e1dfa3f1, 0xef6c1d17b260bde0, 0x0f33ef3526c31369, 0x000000015754e5f4
+},
+{
+	0xbc439592cf204dff, 0xb6d47081ccb76a43, 0x75da6f07e958052e, 0xa0be41b34525c52e,
+	0x8a1fefb0a5c9a93d, 0x743ba66d52dcc045, 0xd0e52fa7edfbc583, 0x1fdfaca3f71fd292,
+	0xd1a3c4b3b74452d5, 0xa045acb009dee3df, 0x35e6c0ddef36476c, 0x17b53e1afa48ac8b,
+	0xab2e5cb582f13ae6, 0xaaa4e5ca3ea35149, 0x834d115d40e5a057, 0xf5ee7b7e836f95b9,
+	0x8d9b8532959c2a39, 0xc50df1fcf730352c, 0x987df1bc75b6120f, 0x15eda3c8c12c88a6,
+	0x550097c7ec18d46b, 0x79593b5a69595202, 0x807bfbd585d9b5aa, 0x5919f43efd56cb75,
+	0x5a00bf07feb02606, 0x23d976b6932c115f, 0x6d0d8b283075f06c, 0x9632834457fb64aa,
+	0xb61872d229f64b23, 0xf11866d4e14a00b9, 0x5bd1a603d64eb04d, 0x41aad6a9a06f6caf,
+	0x6ef1b36b1af4ed10, 0xf5353aef4035df42, 0x48d905d8e16fe4e6, 0x4c99d26f621f99ae,
+	0x0e5d646a5a810dbb, 0x500eb49080a4764e, 0x0fa6bf8e6b27a7af, 0x53d2db394823d957,
+	0x867917af6afe02dd, 0x666e0236ad7a2e5b, 0x4f191a1619837b43, 0x0877d6fa246169b2,
+	0x9ccfb3e61b4328bd, 0x3736d541d3da4b89, 0xfbbe05c3142468a9, 0xd0db71a931b05502,
+	0x3708fe87b956b18a, 0x3cfb99263b64616b, 0xec7c7a4e5baa06df, 0x1de5eae2f88fc9d0,
+	0xfa88ade72c4a73c8, 0x6dec6c461355b6ee, 0x94f44ca758975815, 0x2bb613a06b614312,
+	0x8a6d05372a69984d, 0x40ff6b4eff6f989b, 0xaa15e46f16acbb3d, 0x398e295e3e99b2f9,
+	0x8e1a6622f3c6d1d5, 0x92af53c5bff42070, 0x1c41febba4964b0b, 0x1e3fe940f1059b95,
+	0x6344a4d3072510e6, 0xa67bcb97d7c02d09, 0x3289ac0b6b9f291d, 0xff7169d2a84751c0,
+	0x230c72c4beb1cc19, 0x92981a44c656de06, 0xa8d0fdf9cd381693, 0x7dc2e58be4577bb3,
+	0x1945384079d3028d, 0x282695f447b090bc, 0x462d262d53d39e50, 0x4d82550e2e52d356,
+	0x8030363b192d801b, 0xbf4e4747886a31ee, 0x18b2e012bd3c37ab, 0x1426f8158a85e53b,
+	0x9e9a05e35d201d02, 0x8a40de4e2897f7f7, 0x51111ebb4eff2505, 0x0023f26ef0548aca,
+	0xc6aae40ca574abb5, 0xe49bc5633e6f1f1d, 0xae03a7d3c6c16e96, 0x7b8f46b838ca5fd8,
+	0x9c0bccd9ea77b48a, 0x54f367ba34620712, 0xb1040a3aa1c20d6c, 0x3b394b76805b9751,
+	0x5a7b37ecb81c21a9, 0xb680f3576fd37651, 0x4db1cbe4e24cdd3f, 0x995aff6f0408fd6b,
+	0x5724779c10fc9653, 0xa6eee745c866f283, 0x8950c90fa94090f2, 0x88327799a072f5a9,
+	0x1f2167416aaaf64e, 0x0d7151b2a7994d11, 0x543c6c8d0f7765bc, 0xc356450e4661e769,
+	0xa61347991e36a536, 0x952d9e56230ecf9b, 0x11505e5e322ecc20, 0xe1d086cd4609444b,
+	0x183a591cad005e6f, 0x8b76a64b5f8da615, 0x23c9f8456310fb49, 0x86c4f7a29b2752c4,
+	0x7ebfa38c07997b26, 0xe4191af8d29a9d4b, 0x164633a21384acc6, 0x6e28a0898ef1bcfa,
+	0xec5d6cc8c8911a68, 0x53c790f72f909cae, 0xcd775423faa256d9, 0x84fe8cad531e5ea0,
+	0x9340138116732fc1, 0xd230da1792bd9628, 0x510bab496ea0e4c4, 0x553bafff41b33319,
+	0x23a9236f8d1a660a, 0x86c38a8b6fbb07b4, 0x5f0b8333afded96b, 0x9c06ae2fabc6213b,
+	0xb04f6e31a427c71f, 0x07834b34fdcb39b2, 0xf691639fe3e77805, 0xf42d8606ac36b6a2,
+	0x41fac3ad1f0e56db, 0x79429af6339ec30e, 0xa40de4ffe8740a5e, 0x88e4eeafec9c1a21,
+	0x810bb37d1d13b527, 0xa24137c8ae212803, 0x4c694e7364f7650e, 0xa5f0ca3088bae96e,
+	0xe73a9736bdd708cd, 0xa502bc34e1ed265f, 0xf3d0c7cb8e1acf6a, 0x1637df6b6dc5ebda,
+	0xc189013504df1a6d, 0xd13e7f9e7f4af28c, 0xbb76b1ea06650b46, 0xd2e912acbd8889bd,
+	0x600c2a019130382f, 0x876dcf763c92f5a5, 0x726937fd0cac9a46, 0x93960c05a1740879,
+	0xf99d6c326cecd490, 0x5b891d4110581f00, 0xc5fece5a56a6776d, 0x5289d29c94f4a646,
+	0xb1b678520b07dcda, 0xbb60c62af8489b3e, 0x2f2cb59b5e860691, 0x0a303de0498c0a4b,
+	0x3793666fe213f286, 0x541d24b9b77859fb, 0x131f9e4acc4b91e5, 0x076f2d78195cbf7a,
+	0x606690441a240319, 0x4cd272bab438b42d, 0x1b850f4f72b56839, 0x57a2792f5698b555,
+	0x745325b5548562d1, 0xf4edaee2bcc47281, 0xaff06a7dd7b5a5a7, 0xcb0a3bd98cd8fa77,
+	0xd71acab72f4e1cf9, 0x60e3a4bdf95566e8, 0x03489605d6b35b42, 0xb6f879153741099b,
+	0xb9f76c74f7a30d2b, 0xf102303a2ebb1cfd, 0xfaf5e6966b226e00, 0x17bd60aedbecd17c,
+	0x28c7ce85f4a42e74, 0x0852bc4fa95d2eb3, 0xdc58dc00af2251a1, 0x3cb285bd3e79bec3,
+	0xea5c4f005f6d4411, 0xc9d23c9059b9150e, 0x6e290f2c914d8356, 0x43e88407446ce4d7,
+	0xccfc53f81b0ec583, 0x51f75fa8d6bf4f89, 0xf6ffc70c279184c7, 0x2a6a23fb057a02a5,
+	0x658976d60b697c78, 0x412f742082148ade, 0x3f12a7c7d4213b9f, 0x70f388f8bb1ed969,
+	0x5fa1aa2e85fc04c5, 0xc6e173bdf39864f1, 0xfca20d05a9f26649, 0x69980eeb40d0fcfd,
+	0xb17e270c3b7204c1, 0x55b0051e47204270, 0x84e9a6e61007370b, 0xa1b41afe4f818fc9,
+	0x7c3eecc7a49cd898, 0x7d428860738e3214, 0x585517d645029a98, 0xfef05510ed3c4f13,
+	0x0e9eb1daf5d48730, 0xb25d8bb3c68462d6, 0xfb38d557fa14c237, 0x3e286ea41dfd2a82,
+	0x8a213e41f67a71b8, 0x643cbda086bda998, 0xa13b81b1eec6c527, 0x4a08f93f134eb7b2,
+	0x0d053da00750f056, 0xddc82a12bb96a312, 0x9548534e5d9091a6, 0x70f0d9f0cf75ed91,
+	0x7e8f50d4e0d586aa, 0xf6d1850774a0809e, 0xe5baede2003431cf, 0xd03bc2e8828d6c77,
+	0xb82ad932f6c5343a, 0x7ca415332dc11d03, 0xb2ec8d922c39f86f, 0x97a425cb95f61ddc,
+	0xc88bfe6fde2a0cf7, 0x28e204c01b199929, 0xa098cec1654fe15b, 0x162f951d78445e0c,
+	0x8147ace2d987d189, 0xdf7ff440451b79a3, 0x39d70385eebe3a0a, 0xcb832c0438a6f6ed,
+	0x2df476a2b4eb1812, 0x4faa6bf32a0cf5ff, 0xce5eac0e9b21efd2, 0x5359756da085b784,
+	0x915aa90777aa68ee, 0xfacfceae481299b8, 0xbd81adf4097773f6, 0xf50419a745342da1,
+	0x3c2176ac25a0c948, 0x6108aa1cff719684, 0x0df8c413209cdd4e, 0x562074e2f9aa4aec,
+	0x8d384b62bdfe416a, 0xad0481c95ee129ad, 0x36ec93da5be8e965, 0x2d8066c9f5876670,
+	0xcef54ef107ccdb12, 0x617ee71301abfba4, 0x05f88d5cdce441ec, 0xaa7969d0ea62f2c1,
+	0x61e50f41b6fddbab, 0x6fc6653125d2d552, 0x3c9ddde6f7feb991, 0x1bfc18ce9800daa7,
+	0x6e92e2d5a9bd8da0, 0x40f5baea711fe047, 0xe8b50ff8a3c0f6a7, 0xd61d85cd4bfd65cf,
+	0x450304b9f2e29cc9, 0x56f2830bd7bcc6c7, 0xab62978c1932adfd, 0x6c2965ccd076bd27,
+	0x9e23d7d45a7f44ce, 0xc99c65f8acc97785, 0x0f07346fb0acbcae, 0xe68d1c68e3cb03a3,
+	0xd145cef6f87ce9e5, 0xf66c3129f221d9a0, 0x878962289a2329af, 0x659bd900151d10f3,
+	0x93660bc7a49641b3, 0x0b1875c83789bd14, 0xa66ab994c7e5c8bf, 0x96d32cc8c4dda7cc,
+	0xa324b3c510d16c67, 0x624c6d01a2adadf8, 0x119b143c7ba3a194, 0xf00587046f2e8651,
+	0x7cf79941b54bb82b, 0xdf7a3b1cccccb367, 0xa84302525d1daac0, 0x0f1ee903a8699d96,
+	0x7042cb6cfbde6b11, 0x083c1b9190365a89, 0x8e54d2a5d9898563, 0xe2e2f63523a7a5ae,
+	0xcbf584705b2b5bae, 0xec95ca33d071699a, 0x8c5daa601ed99fb8, 0x1211bf3b828e778b,
+	0x2a1ae11c63b34664, 0xf93aa07227a0f4f6, 0x3dd2a80ead172572, 0xcb094fb4673fa33d,
+	0xe14f672ca9578494, 0x8a80db78bf09f05b, 0x47d53b3faf765525, 0xf0d6858c1024c64b,
+	0x42999f0f9a5b73be, 0x0835f9c265f716e0, 0x07a3007b49c0c59f, 0x67d53bc02920459e,
+	0x7df7e02f0638d991, 0xc2e5373649ccfff0, 0x133a900c7497ea60, 0x00000001950ed519
+},
+{
+	0x9b31f9df1eecd476, 0x22e6d1e9804717f2, 0xb8095a6aa45fa2ad, 0x3c3e5ae068123378,
+	0xa7d2c87149ffa580, 0x22f85dd0bd5db4a0, 0x46f20fc639a9d9a2, 0xdc64592e0662de75,
+	0x8c36e44b5a8eb48b, 0x81739b2f24137384, 0x4e4380d96df88112, 0xfb27a8ae0b9b4913,
+	0x3843f524bf900d4a, 0xb128bd9a83afce90, 0x81877ca02e1d9489, 0xe39c0b7aeec81ddb,
+	0x801de0b3721e10f0, 0xca899550a0681da0, 0x03dc9285cb97fb6c, 0x42e3a99ebaa6bea4,
+	0xeb69cb68e9c5caa6, 0x240b3756946642ba, 0xef6fdfabf261e507, 0x7d2897fac97bf245,
+	0xde289e1c30d16f05, 0xec7f9ffd7aa87b34, 0x2be03050a666331f, 0x16a3fb64ec2c2993,
+	0xb3bda7a1e22928c9, 0xda6feb4085cb63dc, 0xa6c82ba5eff0c80d, 0x952c3c993086ba5a,
+	0xce4c4a94b5cb0e4f, 0xef54b88ebaaac8af, 0x2d6ca1d66b975794, 0x35df9b53f4007e7f,
+	0x1ad441995f0f5abe, 0xd9e33ca51a281fa6, 0x304b5db3aa9f670b, 0x6f39c3c15b14e83f,
+	0xb3ce792aac58cf5f, 0xc1cd6999a2fe591f, 0x5a1bf8fe751fba6a, 0xa7f7fa337220446c,
+	0x66233c34c811892b, 0x2dbe3da6d899e025, 0x3422614474302dc7, 0x6b7a29709aa3b820,
+	0xdf0cf8e49ef8d4b1, 0xbd54b22b077dfa5f, 0x0fd148cebe1c6fcf, 0x7524560fc639fe36,
+	0x7c7c0796e2decb8e, 0x928f195c4d74ae65, 0xfdfbdaf03e91a2d0, 0xc29261c41a332782,
+	0x4af736394792ef0c, 0xc3d2cf54b3010f5e, 0x6742c7cb01ae063b, 0x2b28c4bbb0f673db,
+	0x8cc776cc42a5d648, 0x7d7003a688eae004, 0x5a155349a0f2457f, 0x90a1c62f9eec82b0,
+	0x62fced5ba3e19884, 0x37d62869e9beba27, 0x71d0a4f14fede8e8, 0x2ec70e98af59aa14,
+	0x4e2c4ed0058794a5, 0x5f20d01f0b61f4aa, 0xdd431f2f22cf5c4a, 0xa02bf0ce21d6073d,
+	0x1d5bbfae22eca520, 0x809d1b17b1d26edd, 0x27fdbb3227e805aa, 0xe402c601a0d4c7c7,
+	0x098075c74526d5cf, 0x37606de6a94a6cdf, 0x5d04af3358addde4, 0x3dba8c5f37f62d52,
+	0x11335347c50c8ca1, 0xe553efae3cae2d68, 0x9874e3c8d8b9f0b7, 0x5421362413d042f6,
+	0xd332611f655ed39c, 0x7062103e72650696, 0xfa5bccf495d0eef5, 0x9b5d2bccebdd97e0,
+	0xab12cc7b684d7c0f, 0x05d8cb6b26528987, 0x4c2e12e39edb2a4f, 0x6dbf900b37b915a3,
+	0x7836419181734044, 0x3c1b14cdad5e9f63, 0x8f6427dfe29d8669, 0x182be5530d737481,
+	0x1ebea3aa14aecc80, 0x64c21033cd12e3f7, 0x97aabc64745af95f, 0x7bb0e8c2c1482841,
+	0xcf91adf9831a3bbb, 0xbd5ada02cdbb8388, 0x910c1e5c9d7d485f, 0x134ef2636ab186da,
+	0x82fb386f9e834417, 0x86f483bd1e110055, 0xcce99f1a66cf8999, 0xc2bd7149da262988,
+	0x38a4b749d8f5e95b, 0x32919c71657313db, 0xd6351a7e69f4a066, 0xc6923654f798d2a5,
+	0x9c45c1daca394c29, 0xd9729f90648b4b42, 0xd1829821d0f407ee, 0xfde001b89d92e9dd,
+	0x3d9481b8a0eb16ad, 0xef45adefd4c71e95, 0xa618524e7246f88b, 0xc78598cdfefeb678,
+	0xf2a18aac08d0498c, 0x7276563831349122, 0x878895c8fb184510, 0x07e931f0c76e6b1d,
+	0x9e4d1b9e60a273b9, 0x505e6a82fb7ffb1e, 0xbbd463af25e7cfc8, 0xf0738beca34b53ea,
+	0xb5cec526331f7ed0, 0xa92023e17b2627e3, 0x1e3b22bc7d8687b1, 0xed2970b4e000210d,
+	0x187350513150f8f0, 0x598622e75a646883, 0x5047f3af360accc3, 0x81626b5951ca8383,
+	0x221a5d8364d39545, 0x5038de10d27dd6b5, 0x2b2db89d24d2de4b, 0xdc6d3f226f2f1a8b,
+	0x59247105d8e755ab, 0xd29b1527e1676717, 0xb840e899dd827bff, 0x9fa5d87814eb9888,
+	0x11380bb9b320753b, 0x90e1b457356e9377, 0x6651c1f174a076b2, 0x1300d3f422c0a5d3,
+	0xf3d7f1fbcf90b997, 0xfd575725a78b527d, 0xce1e9a6c0b280bb4, 0x7f7031c57b3b4715,
+	0x86f56a26c4b458e8, 0x29af36c23682dfe7, 0x2ee9e39e45bfd156, 0x77644a2a17637abe,
+	0xd34930d35ee35281, 0xd28e6e2357067c3c, 0xe6cf01bc844d723e, 0xdc8e1e01625d1bd6,
+	0x296b52d79c49dcc1, 0x402f36e27000e5be, 0x0d9181b17f3cc294, 0x84ffc2b7b6df095b,
+	0xbecb02ec6e51d9be, 0x71885317adde4d20, 0x8a3d79d9ba07a624, 0x56866f8392b343ab,
+	0x4338322a393a7feb, 0xe274c2e8f50c20a3, 0x7d9810695690378a, 0xff4e40d12f386529,
+	0xd872f43fe6eaa077, 0x5fe54eacc01c3efa, 0xe02910c7a98569a2, 0xb9d2d2655749ed62,
+	0xceba74611f5d1fdc, 0x867bee80a16c5d60, 0xa07d02a22889a308, 0xa1e36b0c4529e988,
+	0xc4f968742959ea5e, 0x2ab6df1c5f9ef3bb, 0xcfb605485399bc51, 0x3c88fb1b07470eee,
+	0x31ebb6c630d5615c, 0xbaedaf4fbd1daaac, 0x8ff66ff4130d4cb0, 0x73922c62571da0e8,
+	0x11507203c8fda2d3, 0xd6f46c063652b8ab, 0xb3c3f7755e549856, 0xaacc619addd3d129,
+	0xa8c2157770247fa5, 0x37d7c1f9de8f4cfe, 0xddf6c69923e3a17c, 0xa01186943b379028,
+	0x331a027b72effa63, 0x2bf9f92fc8781db2, 0x50704a187eb2be37, 0x1eae843b1c514c7e,
+	0xc89f86fd6adafd82, 0xaa592b297025a43c, 0xff59be16a1477950, 0x2442ce92cd061469,
+	0x03bb1bbf971ef2ab, 0x234cfa0d2f247b74, 0x90b5570294935cef, 0x6f709649389180ee,
+	0x05bd54fb2be27200, 0xf0ff6a14e6814647, 0x46113f7b493b05d5, 0x432414a73c8c1a10,
+	0xdec1161ec34427f6, 0x95a8d7a845ef38ee, 0x9252628b0da1b48b, 0xe965e5f70fc4c36e,
+	0xc127da2d2a5ca63e, 0x24950e086dc91ad8, 0x9de89cfa53cf1cc3, 0x7f84e9852b953bc8,
+	0x1eb5eb2f8c5c404d, 0xba8fe1905094290c, 0x2f45b22c12deb17f, 0x77380dd60fe96a26,
+	0xa2d603769fff5e03, 0x036f4de6379b1775, 0xaf0016dd8486c21b, 0x3c060d1a0d35a88f,
+	0xeacbdbd1dbc04725, 0xd17d3c4bf625267e, 0xac83c2374e254884, 0x2b43bc73959b7ad1,
+	0xe2a727594c1ebbd0, 0x93e19ea69671b112, 0xe701aea39c71f296, 0x2defd380badee2ed,
+	0xaba12df09231be8c, 0xb86a9df5578bc471, 0x0ae4b6bd79a7b874, 0xa99208c6cf34439a,
+	0xc66eb4a37cafb7f6, 0xd54e4e5e4b6f638c, 0xb19b5ba05ea79f5c, 0xec63e27c24dc732f,
+	0xfd6a29bdd0b905a4, 0xeeebd982dc72919e, 0xfebcd09ecc125ac4, 0x1c8af344639fbc5d,
+	0x48018291f1cddf82, 0x0328f5085508ac04, 0x6624e885741ed355, 0x018320d4eef37eca,
+	0xa31fc0f6f988be65, 0x58924f0b3bb2a2c9, 0x456bb833d2a4933b, 0xd4a96fc4e8c3c121,
+	0x5d35586e28a9d178, 0x19c0b2ba97d8a6e0, 0xb5eca7e865b123ab, 0xedeaf67d1f33f535,
+	0x72837377ff5cfba2, 0x4404ead38a9bc8af, 0x74f59cf9fbb6407e, 0xcb80950b2d373534,
+	0x495dc54a20bba9e5, 0xcbc236c8ef9b5f0a, 0xdd294cc9dea262b1, 0x32761afafc341183,
+	0x003687ad3c4a56f5, 0x2f04eb85c5b66da3, 0x2b78da3a70870e86, 0x136bbc63cca58a73,
+	0xfb0adaa3b6d1c2cd, 0x26ad2e4be61a7445, 0xe1364af140281e89, 0x14af5759d51291f5,
+	0xeea2ad9f2d4e1893, 0xa6abccef783ef82e, 0x7c916e25ebe552b8, 0xe04e56b447220e2a,
+	0x19b46de629f344cb, 0x6f5c57ba1414ca01, 0x0480e4c18eae75ae, 0x516493f43edd6354,
+	0xc1a1d77064c531ec, 0xf2577b3bb6e62241, 0xde9caeec03a8e73e, 0xee8b03ed790b17e3,
+	0x4baacb522510676b, 0x685f7e1153eaf662, 0xd6a1661a51082584, 0x4ee43b29b7dbbdee,
+	0xf4a32cd8f79056e8, 0x9c3915021f800256, 0x0546b695466eea31, 0xe184c0569b21747d,
+	0x6c82ec7e6d2c0b12, 0xdbffecc2f27ba39c, 0x3c4829e87735afbb, 0xe0dc3a8c9b25bcc7,
+	0xb946ac36aadc97c9, 0x158f031c50d9184a, 0xbdbb9f32cc800185, 0xca9741001552a96f,
+	0x6fe78bb81f38b67b, 0x303e39bbfbdd2b9a, 0xf824bb4f82e27a65, 0x2b888e421eecb634,
+	0x3f0dba743e818567, 0xd26acb9206775a16, 0x27271e88e7d2f302, 0x00000001a0f6e894
+},
+{
+	0x43c41996699bfad5, 0x74b9ab3fbacc72db, 0xf9aab7e443728f70, 0x3ab1866ce8eea09c,
+	0x327ad023e91fd619, 0x778914cedf593e6a, 0xca71dc61479f676b, 0xf1f4266bdcc5797a,
+	0x9872d55df21522ca, 0x0412e5b98262f73b, 0x237a00c404e0faee, 0x5c5fbcb86e6ef863,
+	0x545526066e5c6c11, 0xa4af69c2db704d14, 0x9b9ccdbb8fb28c26, 0xeaf1dde59bd9509c,
+	0x46ad869691b12093, 0x2c8b647560888a08, 0x7289fec09b15a4d4, 0xc9b1e36420cec8e3,
+	0xefda00356782dc5f, 0x397a80fd0f5eea83, 0x95285c1010b832b2, 0x652e4263dfe9a1ab,
+	0x6a3316a40128ebd1, 0xdee6d553e3ff1061, 0x3c64065ccb864460, 0xbd11108c71265776,
+	0xa72ef600c5d9c395, 0x05affd6657f0cb73, 0xeea95c52d69dced0, 0x3770de569a84a64e,
+	0x89bd405d7b9c0420, 0xb38e8da9f10f4f75, 0xf6296efbcf7d5de1, 0x1c6b57d9a6ccd652,
+	0xbe8d4da552583a58, 0xa138bb70727b67b2, 0x75085be11b67c86a, 0x327bd3d1fc23e626,
+	0x974afa111472eeda, 0x87709ec1f2723597, 0xe473fe96380a27cb, 0x0ff340a6db960a21,
+	0x8bdd97a4fcd2b32e, 0x30b6d00aeb2a3593, 0xb94b9ba7cfd7cb99, 0xc399b849e4e284b2,
+	0x136be567a2966250, 0xf2a0b33c51dae1b1, 0xd70e472c7f900a86, 0x289884aace5a306a,
+	0x33617b93011df994, 0x292f707bea7bbb78, 0x8b01d6fe2e10077d, 0x3acdd039fb91985a,
+	0x1bfa504b04831fc1, 0x46360cdc370f4137, 0xebc5e4234ac3983a, 0x9b99b55de4851f42,
+	0x883679c72d99135b, 0x2ee07d6c1980242c, 0xeb16e85204a75a5e, 0xb0b65861ed343719,
+	0x0dd24794350de9b8, 0x984e7acbba44f469, 0xd7ac9067f8b8f596, 0xfabf7883859b8cc0,
+	0x4d9095fa0488b754, 0xe55eabaebb7c6861, 0x40860dc22a7da58e, 0x8d28024214428274,
+	0x83d69edd7e3fcbf4, 0x5d1ac5c0080b3a0a, 0x3763ce13843e93a2, 0xd6ca5aeec6f52114,
+	0xe38565a5e816e777, 0x7b509dc35a1310a6, 0xbf1b2669009b457a, 0x8f10755508bd9f2d,
+	0xd2cc8b0c342564a1, 0x7062d5c59c3cc44c, 0x634d839ad4bf1c23, 0xd942fe9a43d575f5,
+	0xeb24122f7a40f4e4, 0x58598ba679b11f7f, 0x6e947405868b0318, 0x058c80e252998d9c,
+	0x156f3e4e8fd225d0, 0xa771186cc20cd446, 0x10b2cc2dddbf9bd8, 0x4f5cba73f3b545b6,
+	0x649426ce3a93458a, 0x86de76c6539ddf92, 0x43a081ae261ffdef, 0x1481a08a5c16eba4,
+	0x46f02842831fab1b, 0xacec1cf823e20a7a, 0x55d9cd63096bfb3e, 0xe8a501b234806e33,
+	0x72814311c5b4aa1a, 0xa4ad2d5b9ad871d3, 0x90408578e2e1aa41, 0xaac1b3fef05a6257,
+	0x764e964f60419004, 0x19ddb433d02b3466, 0xa170e78ee5f7636e, 0x095ea32ed19aeb58,
+	0xdd01b1b3105b73c1, 0x4484653d5ceb1ddd, 0x6b51c721b82723a3, 0xcef444714929d82f,
+	0x60589e4ffb362e42, 0xa3e2dc64f8530e15, 0xc2f1584fbff053ff, 0xc0b32fbb8fa67953,
+	0x69080336bce59bfc, 0xa490b3a22ac5f3cf, 0x820762994ee74b12, 0x32558b85f7a98e7e,
+	0xf712060c3b64ed81, 0x8e423957cbe58612, 0xd3a1df2cf540f6fd, 0x17fd6aa27497951d,
+	0x61be3274f848c28e, 0x13cb24460bb6f0be, 0x94cc6ab1177530c7, 0x8d14c4db9c209480,
+	0xb0e4993019ae12b2, 0xa3b8779abfb67b0b, 0x5435b95f19e8ed4d, 0x9a555e448637f452,
+	0x2918aaf15d897d8b, 0x8044ed9982d4259d, 0x2bf1ca41c8549626, 0xf5e11ac567e81157,
+	0xc0ff5815a98b931f, 0xb0eedb021eb0e174, 0xed94b6f4184d33ff, 0x84ad499426a1185e,
+	0xcfbfde7b935dd4df, 0x7e2199c90df89358, 0xee2edea2b504cd7e, 0x1cfdce178b263f07,
+	0x12624341f68c7b0f, 0xb1029a2e4ebd648c, 0x3bf54dd90162032f, 0x3cd1a256ce779861,
+	0x0b44cda839898587, 0x793ade64b82eaf78, 0xeeb8ae13654c2dbd, 0x340c611739129679,
+	0xeed4da2c807a06cd, 0x6aff2795589f44ef, 0xd40451d08df680b6, 0x8de52209d61663cc,
+	0xccd168c22416c6e2, 0x79372884ee148384, 0x60fdd2f44d617823, 0x8b65dffd4c93387a,
+	0xf22289d6fd8378a9, 0x6fcbe56ad6a4b9c5, 0x6d1087b444028da1, 0xe5297b213ad0760e,
+	0x37ee94a007e12379, 0x6583c7e54f90a20a, 0xff4c66b0c8c322a4, 0xf35adcc95e2392b6,
+	0x49c2d83fb0082ad0, 0x1a3d713c25326ef8, 0x353244fea7fb14ee, 0x370d4537074e6733,
+	0x608a9b8090e9ee4c, 0x28bca9b25c5eaf21, 0x2ba21ba99719b157, 0xda4aa9d0fe628057,
+	0x100c491ba6aff28b, 0xe6469b59ebf72285, 0xde58a835b0893007, 0x16cd14b6d40c3cc9,
+	0xa5e1bb4defa20aa0, 0x4d2c31c755e633ad, 0xdcb2da8e67fa421b, 0xbff04d594e442587,
+	0xccf7777a57d58e7a, 0x99f4d015d2605aeb, 0x60ecac9bb2942c4b, 0xb60480bcf99098a6,
+	0x6d67b2d4f2fe84cf, 0xc45c105cf2816aa0, 0x1a815a4a9f5838fb, 0x9c491dc7e30f0d20,
+	0x3c00f5f555d38d0e, 0xc0dd239cf55bc049, 0x5653d36b72779508, 0xf3c5d5c44d9d7121,
+	0xddc172f40477691f, 0x329b2c939ab1f5ec, 0xcfd0243d3a4ef68a, 0x048f3807d14fd3bc,
+	0x80191903b227c50c, 0xb8e824d073e38432, 0x93366b904b2de365, 0xfcc8e1214e67231c,
+	0x62bf4b26a9ac78a9, 0x27ec80281254ca73, 0x9ce4a1efb4474ec1, 0x9201e9068a316e83,
+	0x0aa5cfa37f2f0a39, 0x4a9d256680c14301, 0x91aa74e677d52ac4, 0x26df28499304548a,
+	0x61de6eba839d16e6, 0xd6fa65ff360db6ad, 0xc0acce775c7f4517, 0xdcf1488053f08ae0,
+	0xd4e98c5f559febf1, 0x35f64733b893e4cd, 0x3e4fbb2cbb6032b4, 0xaf8ad09263e5a010,
+	0x10f679bc6774c506, 0xe250b4bf1946f8e2, 0xa3adb8a1be49cc36, 0xd367ca3f52c84aaa,
+	0x53ac9739962d379c, 0x04dbead4fc106605, 0x1f6e9b6323148836, 0xc076a81d67e56061,
+	0x8c8fc8f94016bb6e, 0xc71d63210117c61e, 0xea103404cbd3de8f, 0x846a9f0929e7f8f2,
+	0x503dab9652c9b110, 0x84b9ec38d86709ef, 0x66d72051c3dc7f93, 0xf7050a284063c4b9,
+	0x4e248606703cd567, 0x0262cdc0a38fd3ee, 0xd273e130bdf0e103, 0x60a78b35cddc2f3d,
+	0xc04a9a8d538e7a35, 0x6ffd7cbd3977880c, 0xe678a6d1e83f65f9, 0xc432a59190912a5f,
+	0xc16c66efa12f02ac, 0x1b9210cbb75a0106, 0x48b069eee37a36aa, 0xa5e88bfcb9e873a3,
+	0x3e568a122a3a8587, 0x62d7b946eb3fc8dd, 0x4d424f46d5436e18, 0xc4a79a81accda2ad,
+	0xa2cb094c43c2db87, 0x0eb52c06d2e65f0a, 0x253c445297a425b9, 0xb722032ae80fbb98,
+	0x2472878922544032, 0xf12e25ae3ae3c4cc, 0x78f4b6cf687f1901, 0x4bc4d88c04484f33,
+	0x7f5a38f884d1f293, 0x84617f6b5da6e466, 0xe0211d93680e849e, 0x0c951019cca85446,
+	0x563bbe0c23862343, 0xb94cfeb0a1d5147b, 0x33f97b5d8ea55b09, 0x0b15a2787a908b6d,
+	0x4255db04c142bf19, 0xa8789f869b933bfc, 0x808455102256bcae, 0x8d719c5a5985ed59,
+	0x067e5164a1fc34d3, 0x423630a4d3eb5b0d, 0xf29f81d5f2e81a5a, 0x810d6c38edbc0ac2,
+	0x052220363bae33b8, 0xfffd27bfec0fd5f3, 0x62af19ff548c4495, 0x13bb23ca27ca4f86,
+	0x4d55b92c7a964ac5, 0xff49a3cbc8664d92, 0x1d51c0252226d4d7, 0x615264db54b6007c,
+	0x9e359770fa3cf177, 0xe9b4da9e61561401, 0x91a0afadb33a4260, 0x47a127d0db0cde2d,
+	0xe4ed7ed75649cad5, 0xbab4a263bc650fd4, 0x52897102d82d7496, 0xb0b393c097992e5e,
+	0x46117fbbdfd8ba68, 0x3791c17a082e6852, 0x4422e66807a04dce, 0xf5808064efd0a147,
+	0x944d25f73b11edff, 0x95e2f3847cdd91d6, 0x40528d1566fb22b7, 0x0973fe0a6e2c879a,
+	0xe8bf570511ce558c, 0xade48b44f330908d, 0x0f4d63805bc4241a, 0xe24b94cd17801de4,
+	0x5c9d6055fc4803e9, 0x9c09603709d0a6e2, 0xd6b21f050cfcb75b, 0x94cc78e5352a2842,
+	0xa1ca9daed07a1b40, 0x1c506c05494f912c, 0x731e3eae28ce0dcd, 0x000000015594f929
+},
+{
+	0xfc5ea4b6b18f4bac, 0x01cbba33eaae43ee, 0x537d0f47b32b092f, 0x7d6ed67d0dbfb0bc,
+	0xbf83fa26f39fdca4, 0x898f35adc570229f, 0x6d8cf5a85c8c2242, 0x943449e5d7a53dea,
+	0x95015b4d8907b2bf, 0x9ec92c2c5a5a78ef, 0x94a65d9430e9b113, 0x579e58014caaff7d,
+	0xcba69b3d3d676bfc, 0x266aad57474819a0, 0x23c33e6227a851fa, 0x999cb96822c20827,
+	0xe078cadcf26d4a19, 0xfc390af9981a4481, 0x430f6b2e6e3acefd, 0x4e3ab0c4573034c4,
+	0x43aaefa662916fbe, 0x8c6202264d5d02ac, 0x4a584147198df0f7, 0xd59291ca17bf91e9,
+	0x23e5c0ff76b92e61, 0xa28b1a34d1557776, 0x6d3cd49e700fff98, 0x0d870fa5690b97cf,
+	0xd13ec14bc9bf3a08, 0x33cece65418e78ed, 0x275c62864185a4b6, 0x7fa2939d015828d2,
+	0xb78bc21337bc0133, 0x4b4f9f6624e58922, 0x3efec0a5d64848b0, 0x5c70ff695a7f07f5,
+	0x80ab53d2767e0ac8, 0x3f4946277d47eace, 0xb89ac99873f263c4, 0xa86130b5e07f3eec,
+	0xf7f30829bf9cec93, 0xe34daf68e9dff98e, 0x5a4a00c94c7b8a52, 0xf1022ef91d2194c0,
+	0x83948c5103c50fdf, 0x8f2edcf6849c3283, 0x0a507c1386493357, 0x07152b5295ed412d,
+	0x6d188527c551227b, 0x1b6747839415dc63, 0x7e26c6de3174d4c0, 0xcf0e583d39d99686,
+	0x56a6d383592f8692, 0x73deac6daa13a754, 0x1a253da23320adbe, 0x8ccb5ddcab42deff,
+	0x75fcd6b0b4bb09a4, 0x20600bdf7d2a68fc, 0x250e3a86a410b398, 0x8e4efaa7400594a7,
+	0xe3c8622a30aca53c, 0xccdbc8b09feefa86, 0x1e6270560ad54f95, 0xc978ec116d8ab5fe,
+	0xdd73e66e68e885d6, 0xff135d3e7bd5df72, 0x0665c1f3d4a88f74, 0xd690e630e54e9082,
+	0x24fe1578fcb9a0ea, 0x23b232c44289ba16, 0x1f185a3d368abdfc, 0x105f847ef4a6f89d,
+	0x1197fb1a78e97783, 0x19f7a9999b294737, 0xd7866c0b82219e74, 0x805d5302b468e5cb,
+	0x731cce168b53448b, 0x72c302a51dd4e05c, 0x256b8474f8ce3338, 0xd5c93beaa72d852c,
+	0x32c04bb0b3d3a1ae, 0x0109414c700ed80c, 0x7b029faff05b2935, 0x07f4ea078a5f6593,
+	0xb8e8eaf651e6e302, 0x7d4da6b0b4f09fc4, 0x7bc232541b9a6f21, 0x4e460e49223677f4,
+	0xb0c68c88c136c93f, 0xb59fce8e0c29aadc, 0x2b8acef6f4936e42, 0xae7cf33d43c6029e,
+	0x8c89087d4a5508c6, 0x98c99eee326d546e, 0x7135b4b94e6a6f7c, 0xba6bc3ecbb8958f2,
+	0xdb52a2eaf693d1bc, 0x6d5fb5366e995ffa, 0x3fad2d3b98bf2d03, 0x6a1a97e9b4836667,
+	0xdfe9b6a0fbef6db5, 0xb5daa74245fcf438, 0x25a0cfa29abf282d, 0xab8575cf6cda7f79,
+	0x38dc3f28a89bd254, 0x6e345c27b675c137, 0x1db271a6fd1b9463, 0x3186d0b4fc51df4a,
+	0x26f6b1b309038f10, 0x14588d39bdb9bad4, 0x5b7f965ea9525811, 0x6c0b862a1b10731b,
+	0x9038e52282cd80b5, 0xd9ae47174cd3e337, 0x315d36cdc958bd0b, 0xac4a6a08cd601c66,
+	0xa9ce318f4d59675c, 0x69cc94c167811abe, 0xdce1cb0734553993, 0x6365c66be78afc85,
+	0x04a542a742b19202, 0x175e76dc43061704, 0xa7fb5cb1794354ce, 0x71d3e880db80f185,
+	0x9dbf680f7f7a47a3, 0x064858b234cbf2ed, 0x898d9442607ac040, 0xc1c0e2c9ff892671,
+	0xfb7e5c6002177936, 0x5bcf9fc2e4f4e26f, 0xfd000c4524e7c1df, 0xd607520a7c64e87b,
+	0x14385412e7d5bd87, 0x80fa46662625ae74, 0x57430e2fe3729752, 0xf47a9f42fca34b9b,
+	0x171cc7506c1adc79, 0xd029bcd364638e36, 0x2bb444632469d74d, 0x446a13bbfa505126,
+	0x3097cd684988c2e1, 0xfabc2b0601229bcd, 0x79cd1f773c5da998, 0xd158f426e5f5e7a4,
+	0xd3f876fac20262ad, 0xce076a7d6b36d1ea, 0x17bcc1254da2aa57, 0xcaf7b10c05e07202,
+	0x58de578d63cc91e1, 0x9467a2213a21ba98, 0x7954f08aa1bfef14, 0xc1a81d609c11cb55,
+	0xc70d7f0d0372c56e, 0x4cf6790c9aa01a76, 0xbc78665b25241438, 0x4b6b89358f18b4d7,
+	0x205f483e1945c2ec, 0x4ab5cee9c0ee77d1, 0x6f1209b47da7845b, 0x5ebef3763eeb1d64,
+	0x2142f846434a844f, 0x2c1f5b8e5a672cf0, 0x08678016d5834933, 0x93fdcef5f2f4360b,
+	0x0c8908d42d831beb, 0x5d86342c2ab152e2, 0x14dda091c506eb35, 0x58899f6f6cd82277,
+	0x7f33a69947236cf3, 0x413bc097b7d863b6, 0x5458dcba4b55bb7a, 0xd46630d3792eaf6e,
+	0x8b1d0ee7f1afbe80, 0x5217684df8b716d2, 0x0c22412d8e6e9cf5, 0x799d2548fbe3b2eb,
+	0x16cd0704ba9b66c0, 0x23b894fab5a45d87, 0x77f5bbfa076f0cfa, 0x8e04fd21c352487a,
+	0xd32384568c2fa4c3, 0x0c39838527b03836, 0xd809ca1051980fdd, 0xa60806f57151c651,
+	0x20c613bdc861cd66, 0xad0e8eea4d8aec7d, 0x224a0fa0616cb16e, 0x1c01083d33635387,
+	0x2d3fae825737dc8b, 0xbf540e4b4815a91d, 0x313681b4c24b6c54, 0x89ec0ca147064ad5,
+	0x248650c598ddd234, 0x9d433e510a889eb6, 0xabbefb8582243b30, 0x4179a40d628cbe9a,
+	0x4ec809a37da9d999, 0xd17a09115a82877b, 0xb32a74f895a9dd35, 0xba6a3a5b13a488b7,
+	0xb48b847dec449102, 0x150552a593c428e3, 0x44cb84f642750e04, 0x2f509a69f879333b,
+	0x8fce76fabb565cef, 0xca4e2f403567bdc5, 0xdeb2175b82eb1437, 0xe57b59f8bf690d97,
+	0x4a30560a7df98aee, 0x777d4735cf9785f1, 0x5882016ed2954183, 0x263d8f537ed7fe33,
+	0x9c532d5f2dd02c43, 0x3ddcba9da4138b4c, 0x9d7a90838448153c, 0x36f438ec8c8d9e4e,
+	0xc516110123f77d81, 0xad8dda3f808fc295, 0x9876b722607a8140, 0x1d453fefa035e369,
+	0x2f7015b1885c088d, 0xc439cd7f240db32b, 0x43accc80795f2af3, 0x9555a7bcb745febd,
+	0x3e244aef44a1a9a9, 0xb47f66054e18f3ad, 0x6b3c6bba11eeff4c, 0x285bd92fa473eb4a,
+	0x47d778a57824fd78, 0xe974e7c6659c7e96, 0x8e7aebd1031b0613, 0x372675608a212309,
+	0x086e632ee6399226, 0x32021f1e46044a31, 0x6b25a439a65a48a3, 0x827ef4383bf6cfae,
+	0xfbec94c1a91746f5, 0x194dd5e6bb8a92a2, 0x22b76fa53ef0c7eb, 0xe7dbc3cd03bb9907,
+	0xb01745bd48ae4164, 0xc2d169d5b650468f, 0x327414f558d5eef7, 0xc193d8a494cdf25e,
+	0x4ef0ad5ec5e9f1ae, 0xd7a4d74a874dda4d, 0xd0115319a707aa76, 0xc279b64ca9dbd0f7,
+	0xdb6c229c5c1d8db5, 0xf9d2f19840e6cfbe, 0x0a601b03c82bef9d, 0xd80ceee7ff4dfebd,
+	0x45f3e9abd5d427b8, 0xc294630e7f690c5d, 0xb81fdc6822aa406b, 0x14571de02189008d,
+	0xd615648076c4bc8e, 0x7f2ad610fb21c718, 0x6d8a3b619f5be4fb, 0xb17e484250681daa,
+	0x6e0a297ef3055fac, 0x212df72a8c469ce3, 0xe79ab8662e8c2812, 0x92084b6a0a580018,
+	0x2b64bcc840e03fa7, 0xc0a4471f5a4e3278, 0x56815f69c8346bfd, 0x11f78acbd8107881,
+	0x79a91f68d3f725bc, 0x270916656b6b49bf, 0xd695570eee9fd99b, 0x5b73f4fd60544c3f,
+	0x813fb957509a81e5, 0x999d180490c119b3, 0x308da6ce4031aaea, 0x0da1ff33bae8ccf5,
+	0xe0972eaa3ba24bed, 0xb94f6618e4a911ae, 0xee725d585ccfac78, 0xb18cb51ff6601554,
+	0x588c08a51a38ae1b, 0x2643b242a35f1987, 0x32fb4ecdb576cef9, 0xa31662e711b7f551,
+	0xde07498095094507, 0x5a7da394f676ac66, 0x41f41bcff995b470, 0xe50cffaf0af100cf,
+	0xce8697a585ffe303, 0x44c515f37684409c, 0x3a4799ad334508e8, 0xedcd849c98cf354b,
+	0xcba9d9b30e3a6ba9, 0x35d47b5d3e58058b, 0x3ca182f76fffea71, 0x94aa1ff5d89c22dc,
+	0x30a8bf0458cbe9fa, 0xbc550dcf717dc833, 0xb7ce4f2d8d005a01, 0xc4e83963330e22b5,
+	0x5d0d2032642787f9, 0x564311a5d37e5852, 0x35d967c86440ceee, 0x7ef8b10707d7a58e,
+	0xc4a4f263e7d5a9d3, 0x5d170cbbc3a1e5dd, 0xf30e3b3aa0a0c7f4, 0x6816bcfdd19f3ff0,
+	0xb12fac486ce12bb7, 0x363d61338111c75b, 0x48b4ba6a4ee9cee3, 0x0000000135cfac35
+},
+{
+	0xd6698cf9a3635d33, 0xea03635fbed3c982, 0x890e00363bd3ffb2, 0x572fdfb5dedf320c,
+	0x08893c4cd574e5a7, 0x9e46f58875dceb70, 0xa354ad353cb6580e, 0xc598077d47ea8a00,
+	0xc7b21ef0406b10f7, 0x3cf34d24de7f14b9, 0xe69943c8e550dbb3, 0xc19fc2629500ec18,
+	0x579408c86f1885e3, 0x5f5ff6f26d516506, 0xb6dc0204fa4fa514, 0x26c9add10d72046d,
+	0xff38b271c1a29948, 0x9f82b27ed259438e, 0xff26bcf0c9f044ae, 0x6ffb8fee51412aab,
+	0x3859387e06c00f55, 0x4ba581e74a9ea927, 0x0aa324a843ad7ba7, 0xd6d0cec5b1e1b942,
+	0x5f9ec85cc9647778, 0x9ffe435f24a8e8eb, 0x8c9ad3e6a9850a03, 0xb3035a6f737fc63b,
+	0xf2216568f8abcbc8, 0xcf0f2ccf16f57f49, 0xfa059ecf7f0d269f, 0x0785a1dada895012,
+	0x022ec4a217196936, 0x5942e1f0a8c7b8cb, 0xa302cbb0611385c7, 0xd63db3c2f81247a9,
+	0x2aca5fbd8e2fa322, 0xe82f741b52f43cbb, 0xc2b531921f89ca61, 0x1aab2aef0f7b0529,
+	0xafddf0daa64d86c0, 0xe04a6f22a57cddaa, 0x2ee2ce081f6d2b04, 0xefb4aa364331fe91,
+	0x4b6deb216cff6013, 0x346e44f39c065a3f, 0x63ca3b1371b0b5cb, 0x53a862becc89cfe3,
+	0x77bfc1b785ac00dd, 0xd3b480cd65412f1c, 0x7cc8173c9279c0e9, 0xc0eabfcd740ff6b9,
+	0x98bce5025132f9e5, 0x75143a07817a1bb8, 0x07e81c0242eda8ae, 0x7394d3d9a20b87d0,
+	0xf3a5883349fb86d8, 0x68094db1c117659f, 0xa5fcfee66bf88216, 0x72842159f3559853,
+	0xc65b763aa57d52ea, 0x5283e62551f396be, 0x4c19c2d583b2fe52, 0x12868f0d7fb72e25,
+	0x20b310473691158b, 0x81db500b6f46c339, 0xe0c604ee039e8c97, 0x8d4b206067a3c9b6,
+	0x662823b418075793, 0x28efa465d2cbb559, 0x2e36e7259110c2da, 0x7066b12133d4e2e7,
+	0x847dd6ecdb5f25fa, 0xd94df7b979bcb2dc, 0x4d04f6ee861fcd5a, 0xa544eb518093f2d4,
+	0xacbc5180fa0b4293, 0x85c2f35006c11f07, 0xcaf9627b0032e7de, 0x3361dacae6f7be46,
+	0x3be8b8743eac6e58, 0x4ae7af2228614453, 0x2decb6284d8596bd, 0x78c789df44d1813f,
+	0x30d311ec794129e0, 0x7474eadfa0fea68d, 0x46863703ed675bc2, 0x5e93d8fdbf390342,
+	0xc0277672e02c9ea0, 0xf090a92e3a366ab6, 0xc3653fb27d24ef71, 0xb61b61df87b7fb5e,
+	0xb206e7ae2a1ecc4f, 0xea9501535cc5fe1a, 0x7c3938b4b0b819b1, 0x14879b9c6d3c43ec,
+	0xc2dfb2ed6a4ce0a6, 0x6c52156e61c35e81, 0x759fe1acb86650fb, 0xf9fcfe46e29f9650,
+	0x7a35c46b855f5156, 0x464fec2a7231b550, 0x353792a4f78e0002, 0x84f24a701f80ee67,
+	0x4d39143a045a5751, 0xd7f537e5431a3359, 0xd94b25d3397b1eea, 0x03a6ea8e88761bd8,
+	0xb5e0d0102f68bb00, 0xd68834ddadd631b2, 0x6964ea8684e25622, 0x6fb10e042b5ead5e,
+	0xd258ec00c5322c0d, 0xf2af3a803f839e8c, 0xeb708f6bec1fd34e, 0xa101e4bceebfff13,
+	0x546f21ff5449c9bc, 0xd5a77650a426aeb5, 0x8235d00caafa2fc1, 0x60e6c1722ecaf798,
+	0xe482fe1e0c4d7cad, 0x20f11ec7c81956c3, 0x78993e04024b9165, 0x8be1920c3df3f4b5,
+	0xb18ea14d863803d4, 0xaf2aabe6983467a5, 0xa5e79b1b096296b3, 0xccff436016117b0a,
+	0xa066854c433caeee, 0x1b13232e88de3ff3, 0xd5c61f09bd02a4d7, 0x60caa2859e7ac06e,
+	0xdec4478c9e6bedd8, 0x27827108fa922d77, 0x40101f281600fab9, 0xa4044139dcfc38a2,
+	0x34aa9f8b205bbb2b, 0xb0ea609f756469af, 0x2e5dd98e1af9865c, 0x307e6aecf1ea0c89,
+	0xbdb403b18e00e207, 0x14fa5b26fe8f9690, 0xbf4185fef4025590, 0x73b94a0bddae4f22,
+	0xd9bf885e0592f415, 0x8be47a213b6ab25e, 0x3dab97824df4ff0a, 0x696dd9be5177a761,
+	0x79beca784094b53e, 0xe824cb3c2980a130, 0xaae91d3ced57b514, 0xcdcd349121dcad08,
+	0x37074d56a37336aa, 0x99df3312f1bdccf5, 0x7ecb8472a79ff3fa, 0x1078b91e78df5f8c,
+	0x16f4856d23d091d5, 0xd0e5848d6ababa8b, 0xb10a64fee63e322a, 0xe6e479e575d3c4c9,
+	0xad615f4c30f97e4b, 0x8a628cda17c4cbd4, 0xd3dbc6af6c7b5eb6, 0x68327c9bf4a96a16,
+	0x9bf618a058f0d3e1, 0x6863c2e94dacc5a3, 0x8de1a3d2d962be67, 0x4d635e9516be6f41,
+	0x56ffb28a3ab333ac, 0x1d6c9df4751e4a50, 0x9f50f4f7a2c2f115, 0xb5437752d1d4f145,
+	0x927b04cbfbf587ee, 0x186f9e6615300cf5, 0xfae10d105519889a, 0xa2e29a83b03e9e6a,
+	0x13decf8b12458328, 0xe9d6e1dbda58dd07, 0xeaf83af879910f0e, 0xe208eb17f1ce32ab,
+	0xccbbd30d367e01b6, 0x8f60733a57ac046d, 0x8c6afd4814449444, 0x2196e380c7e89161,
+	0x56e60d880b0fc0c8, 0x7696aab4243222ac, 0x34135869e3a1226d, 0xe1fbef000aa94259,
+	0x7e225cf8c4a7efc9, 0xc50c113af2a39cc2, 0x790a5fbf00f83005, 0xc427441a60ab500c,
+	0x29dbf9848391fe16, 0xec6fe5e7396fa419, 0x906c8deffe8cdb5e, 0xf6b8bc60a4ac9c0d,
+	0xcee0841bade8f7fe, 0x2b53e01529da29b9, 0x70f0c356657cba4b, 0x1ff620bdb2279d27,
+	0xfe73ad036e8b1f4f, 0x7bd5e24cf939c4d0, 0x801e8abdd362e2bc, 0x0d7be972e96b35a2,
+	0x3ed2d38d9519f6e8, 0xdb250c4a6232ad8e, 0xaf7d5f8e9fceef59, 0x9ff433b8375054e4,
+	0xf514d4b1fe50dcb1, 0xc6d848eae7d00ba1, 0xce4ff88673f3ef68, 0x6ec809b395009a88,
+	0xbf91a7273475fc31, 0xae22882b04e51e96, 0x0f165191ed75ba71, 0xbf2c796a79f61b5d,
+	0x7e580100511494ca, 0x78f26bbeaca9c239, 0x20e56718a658761d, 0xcca5219e73c56504,
+	0x15219750478fc550, 0xe4df052c5d5e4dca, 0x84d55a48b872630a, 0xcb4b2c745c500c2f,
+	0x1d3147bed398813d, 0x056a649f8906218c, 0xe76be845d19fcd08, 0xa284f7a1c57e6e72,
+	0xeb00b17e9ebd8152, 0xcfd4e5ea089ae81c, 0x4f0adc2d2fe72462, 0x0a23e4bca42c8abc,
+	0x18387d72855e373a, 0x01c131e8bd9efcec, 0xb305103bdd5897d5, 0xb7aa414ee3bbb10f,
+	0x4b9edc7bbea0204c, 0xd6593d96960497b7, 0x358aeb9761642b1b, 0x5c3690ceacac7144,
+	0x359535c38a0428e2, 0xa954afa572a2a89f, 0x45ab393e812fdca9, 0x8622e1aa0d09d3f1,
+	0x0f1f8799e604349b, 0x18a2ebc60859fa01, 0xeae32820d4fdacd0, 0x4d59950ea9bca950,
+	0x516ddf4ce196cd6a, 0x9d4c007c1edd6557, 0xaac0e666f80d58b6, 0xdd804bd66923bcbc,
+	0x4e4bcbe6baf97c36, 0x61817083b5258cf7, 0x75654a42cb76851e, 0x303349ffb7786584,
+	0x5cec03fbedf6198c, 0x274fe1ede764726e, 0x1062ecd2f4038cb1, 0x56e741dbd01a72a3,
+	0xaca7a52f10c2aeb4, 0x13a1c37138ee2afe, 0x6883751a9be4cf15, 0x4b63c32036674364,
+	0x29ce96e5c8ed74de, 0x09761a84da4f0ee3, 0x3e4ffe5d74d4a880, 0xaff54f7c34a5190c,
+	0xf23c7208eb1aa927, 0x7b5f9976827fad77, 0x0e57031ab6bc0105, 0x6cbb5d952d5893ed,
+	0xd606455c739afa68, 0xcc8f89f4bb10e898, 0x2d7cf9fe30a7638e, 0xefbef2602a137dd1,
+	0xe029625f2af83298, 0x1bb741d3c20536fa, 0xce7b5f80991294b1, 0xb8a9e315f0f60d34,
+	0x8618072414d3befc, 0x2db218e8e13af98c, 0xd8a598334b79fa98, 0x71342a8473e89c16,
+	0x52156c3af1630097, 0x4be24bd6d62f099f, 0xf93d8d0d4b7e8e92, 0xdda2db44af29a3f5,
+	0xfc4b9a72d6af2c5a, 0x9c363c8a1c23daa9, 0x1304821f25bf0584, 0x3159942e5005ea63,
+	0xe48b8dfed4e665df, 0x4bc3ec1777329f5e, 0xf5d2de5f56a0a4d5, 0x6db993f6b9d345ba,
+	0xa61aecee3e11792a, 0x38588b1c87f3f133, 0xdc7b7667cf811e9d, 0xd0f585186e8fcfcc,
+	0x4f640e639d53fd7c, 0x19a7e4d6a53b91ff, 0x7f77b252c41c0a1f, 0x41cd6c57cd88abe1,
+	0xa2de69e678fb682b, 0x71cf8679f9343b54, 0xbd2e2e4413da2d91, 0x7503f2e8aabd39c9,
+	0x558f71d985831302, 0xad1df77c73a7ac32, 0xdf1324f24db915a0, 0x0000000185540ec6
+},
+{
+	0x96e7a6004de5761b, 0x220a299b45952e31, 0xe24ad8622d36c523, 0x83ca299a7050d72c,
+	0xb708cea3aaf0cf49, 0x405ebaab43af96eb, 0xc8b52805389a8c47, 0x66188582a6bda0f4,
+	0x87baa065e2ff13c2, 0xf63d34e62a83cb85, 0x37b0293f308d9311, 0xe54e35fd10a22c57,
+	0x72f4ff3df4eb5085, 0x504bfa38ba7f364f, 0x5717ec5d6bdced0e, 0x563ef6f6a1178b07,
+	0x0b7184e84ed72e5c, 0x5b2e7d53a429bb28, 0x155ab2f7af0bf372, 0x5435cc1c5de35575,
+	0xd2877270efc32bdf, 0x4f0559d248ceac9e, 0x096ab7c1384fc5d8, 0x4c00eaea8c8e1bbd,
+	0x167b25518c0ed04b, 0xd6e1c2cd6e9541f1, 0xe890543dca9e5f03, 0x57cebb85d37348cb,
+	0xa2ee82bf449aeb68, 0xf76fc7463ac2cdcf, 0xdcc62af406d140f3, 0x0a3567135494d014,
+	0xfbb9b39d59897e1d, 0x7e7efcf908dfbd3b, 0x6aa769e4958e1b9f, 0xd2577d361de0df93,
+	0x597f81c68bdb0b21, 0x1ff1ca17626254db, 0x77cb44cbb8cdc1d0, 0xdc3de33eb6b5edb3,
+	0xad919aace5f67b8f, 0x0c3e2424fc43f0c8, 0x2a33db98d2dfb911, 0xb948e371a2fab043,
+	0x00b991c2ef824495, 0x4589eebef7f20b70, 0x83a18f0662235604, 0x3ab90e5242a755e0,
+	0xd60ccd855211bd7b, 0x60f0f1f2530f3967, 0xb283ec8272745bdc, 0xba7bd7d303466abb,
+	0xf87d2d9f91b95dd6, 0x1ce92f138478e625, 0xcec9080c587a92c1, 0xbc28ea5a255a22e1,
+	0xc29d9c272adceb87, 0x8101c8644bf962e1, 0x142f162a585be2a3, 0x02086b4e49aa3339,
+	0x00ce336a703ab715, 0xb3fd0c8ab9f466d4, 0x6ce5830673476d95, 0xf194eae566df59fa,
+	0x39659a341ae34e16, 0xcd15ea4621e1888b, 0x112d96d8bffc611c, 0xe877997be5ee1d61,
+	0x8e87f16c44bd05a6, 0x41c426e07b9be868, 0x14b2009fc228a710, 0xf818eea10ca521ac,
+	0x417eae6ec3d67fcc, 0x2074db98be32b0f3, 0xa5bd6caad7dc4876, 0x5c99cb26b79b3c92,
+	0x54a04613351579f3, 0x447c508572717c21, 0x81b1696ddab69c15, 0xe3b516ff6aece7ad,
+	0x6594e127230dcb0a, 0x116f60aae33c3207, 0x556a2f0a697eb2ef, 0x21a0e0f10e9cf5bd,
+	0x52b12e10729262b1, 0x17ef37e834d79267, 0x60fe05e17090427a, 0x1728e79da16e6441,
+	0x4ab6c9bf00b9498d, 0xdcc08f7d9c6bd1aa, 0x22727c27ef8a1a64, 0xef80d8f1d80be4aa,
+	0xa4972969b436700f, 0x70cb06ffbf4754dd, 0x608b0d4ada765ee2, 0x3e0f35df5b154fd3,
+	0x3f93628349e1c122, 0x91a44a60efca7034, 0x6ab4c55b5c88f18b, 0xfa0e246c446f01d7,
+	0xd047342364a4e314, 0x5afa7a4dbc52f777, 0xa8101ba993eea6e6, 0x192f56eb5d677a66,
+	0xd5d76cbfa0528c5b, 0x75574a8c7aa345d5, 0x5dc1162882c0e877, 0xce57fd8f3559a135,
+	0x6f93f8d7d7d2e8c8, 0xc93ff82c975d7e74, 0xcf18dcf29fb1772e, 0x3ed899e22e960309,
+	0xf610df563d2d4a5d, 0x7f638f73d6b588be, 0xe42db3a0ce38aefa, 0x7b8911fcdfd35314,
+	0x713780461ea4074b, 0x5505f7392587cfdd, 0xe970ffaa090db2ca, 0x0fb22a879e4ec7e6,
+	0x5bdf4603c8fedba7, 0xe654a5853d180c9d, 0xa71af930ab5d7e2a, 0xf59209222964eed5,
+	0x5f22a2801d908c19, 0xcf32a562d7cb26ba, 0xb29525e06180e3eb, 0x0eeb2bb1a82d9e59,
+	0x7021a975c23153a2, 0x1b308f4b65feba59, 0x5367c5dc295c7b0b, 0x0fd06a152679301e,
+	0x66266a9c658d9ec0, 0x4b3745046700319e, 0x5578e9554e2317d6, 0x3caab46ce33979cd,
+	0x415c4db946074b8d, 0xd496c3332ce0d09b, 0xcdbddad714d279d4, 0xbc61cef5d92e95e0,
+	0x35255d35b00ffd21, 0x7b730e9f550bb09e, 0x4c07a1acff607bd4, 0xf10f153390607f2f,
+	0x067a417b4f89ca12, 0x541b7c1826ad7586, 0xa0c8602b0a992d79, 0x632f1b87f62f11c9,
+	0xc328d50833edb08c, 0x3982f4872bd984a5, 0x6c690a4574738f7a, 0x9c1029d83afae595,
+	0xdc9fd66e3b513c9a, 0xf7afbaa896494868, 0xef66d4d9c907a327, 0xa960cf88bb75f281,
+	0x25ed76759b8f9da7, 0xe6c2d6b7ddf65203, 0xf9ea14d5cb25d9ec, 0xb99adcf2c779cf7f,
+	0x241188169b860da5, 0x1ebdcd3fdc9a0a85, 0xeebfe09a087dd4a9, 0xdbfb5d34f7ffa462,
+	0x1ea72f363b66a179, 0x46ea951324024a44, 0x11931efad6a5bb45, 0x226a80ba75d40dcc,
+	0x3817cbec29763b93, 0xd29c961fb704320d, 0x5978d96714e0c952, 0x37e9b1953d932737,
+	0xbadd4d103ae55b10, 0xafac84ad096cfaf5, 0x02ab771b7ae92d27, 0xedca2918884f5b7f,
+	0xe3a76d6e2ee499ce, 0xcaa6acfbcc2a2aff, 0x0deb7b1bc01966d6, 0xada9e639a499bc8a,
+	0xd972ec617b5be027, 0x892ee48c0c248816, 0x5cf521e0b2d7ff1f, 0xe4c6e8917c9f48c9,
+	0x0c965d8e16ebf01a, 0xa9de44002df9f5e2, 0x0717cf0d1098ff50, 0x574f0fa1b747a439,
+	0x8c3f439a83a3c753, 0x4c872ebe77bd18b6, 0x1cc90014112d0284, 0xfe10b09ad6d7e723,
+	0xd09a26749390e189, 0xb77b6046e5c50b8f, 0x06e33b4ebc403791, 0x1dcabe282f2d65fb,
+	0xee4337171ea3361c, 0x64b74100ec6c0fac, 0xc83cfa4846204fe9, 0x7050903e58636012,
+	0x2bfa411c67d21561, 0x2b822f392aee8a4a, 0x00f23a33352c1cac, 0x2cbed2e838fffc7e,
+	0xfb528b4d7b0824e1, 0xaaff8b0f52990b3f, 0x2a8286d743f7aaef, 0xeba6cf7df19f525b,
+	0xf5d57759ddf4a85c, 0x848130a5fdb7aa79, 0xcc5c8aae4cd07d96, 0xc27e149480ad9fe7,
+	0x22c9613ac05861db, 0x07e23035168f4d36, 0x60d480ddbce99868, 0x533380e20e4a608c,
+	0x200c2cef1259cfbe, 0x14e61e9accf27b93, 0x4705bda9c6a28392, 0xd48e9c219ec4ff01,
+	0x0c37f6ad3636b463, 0xa4ce64dd8546f5f8, 0xd02560aac1c54ec9, 0x731ded70275d9780,
+	0x161c69f093d76da0, 0xae6df9c7fa2bf446, 0xd867152c3892a25f, 0x2848d993a2b776f2,
+	0x2e2df1f3d82edae6, 0xd91694a6ab95ab9f, 0x1404c20b96f753ce, 0xca841bfb1d90f850,
+	0x81cf6f0b15f97b2e, 0x6f6b3dd58546b879, 0xdb6f204729b372a6, 0x313b5e9936126aab,
+	0x6bce738c6c5203b8, 0xfaa21bb3c7d61468, 0x8a223df33429b384, 0x0db341a7601c9ea2,
+	0x403555d964d9ebee, 0x78abbe5a34469022, 0xbe0edb1b6de5b1e5, 0x24b917742b63a146,
+	0xaa813527b43cd449, 0xd299c60920157907, 0x7265dbd517db8991, 0x38f14d7179c7e6d5,
+	0x9b66f54441166ee1, 0xa397c0a26f4b5bf6, 0xdf920e62fe131a19, 0x405a1e4faf5afe3f,
+	0x386bc4186a77d146, 0x3e44c9f9368ccdb1, 0x1b02595af1cdc7a8, 0xbdf2669c01037644,
+	0x387a4653c2592175, 0x74c3d035144f18c2, 0x139727e1273483e6, 0xa39074d72ecfd5e5,
+	0x66bec73db7ce8aea, 0xba7a5e6d2b178ae1, 0xaa7b00ca686aa417, 0x4ba082a4fa5a7ea4,
+	0x9df6a5cc1dd1e520, 0x559330fb308ef505, 0x41c4d1ec081d588d, 0x8bbd67c70af04a8e,
+	0x572f3f7c02601a45, 0xe6764adf4f0c16e4, 0xbb22ab93efddc296, 0xbe7b4e35eaddfc7b,
+	0xbd3d482a91437c1f, 0xafb430f4607c15dd, 0x383a6da958235b74, 0xaaf9d84fccb872ab,
+	0xac989162544a456c, 0x9f1347277c7b0719, 0x5ebdfa517937a342, 0x7dc4928cd6312e49,
+	0x61af30a847a21c08, 0xa781e4dc31b937f4, 0xaaad3e5ee43c9fea, 0x3f456518c9ab187b,
+	0xcc528e1b01c14a3e, 0xd86ac320e79521e6, 0x7b20a6dd82e2dcce, 0x54367ebe488204fe,
+	0x21f90791ae2b6256, 0xf2b0a01ab208eee5, 0x2bf09479fd0db0d6, 0xc8add84ceb3a93cd,
+	0x092c734b43611627, 0x8d6cb2fceccf86e5, 0x75a2666e8ba7b25b, 0xef10342e5ce90fad,
+	0x6f3b6a2e547986b2, 0xab34fa8db2bc1da8, 0x03fa7a6236e4e903, 0x9b666d6407908311,
+	0xafb1c0604c63c6e9, 0x7fdd23ba8471111b, 0x19b0890eb27226b8, 0x4ded35611bb00dfb,
+	0x10b05c5ec25bc827, 0x1574c455a3a79d6e, 0x79e128d3b5e63ac3, 0xc89c15330374f81a,
+	0xe90d07be4f5f0d35, 0xdf2b15b1bd106cac, 0xc89f5b96f5f50dd1, 0x00000001490edf94
+},
+{
+	0x16bb7251481c8844, 0xeaf10159f4786862, 0xa6a30aa0d9b20737, 0x52a5bf3052a7133a,
+	0x9afb554b4e00b159, 0x4dee262156bee02a, 0xdb6cb28c64a7309c, 0xf54af3dde50a7a46,
+	0x2b9b612b447c7ec5, 0x6f5ba956e95d8960, 0xac88437d193a3b40, 0xb448284483165ddc,
+	0x4c9fdd8fde5d7f6c, 0xdc178f500c08bb46, 0x74d99dd1c1781eca, 0x64366d423ace129f,
+	0x045af7ed8e6a359f, 0x106136bb06865208, 0x30fa27edfd8de730, 0xf469be0d82b070b8,
+	0x49a00bb5b3d61966, 0x88553b9497dcefa2, 0x7ce39ecbdcf11a51, 0xbc8750fc941563b5,
+	0x46eecd25e4a57bcc, 0x16a3c4cec7954cc0, 0x6222d4194f9276fb, 0x13b52f08cadf1245,
+	0x62a11fed629102a7, 0x346c6cf35d8666c5, 0xd170a5aa5b8a43f2, 0xbba9ff983b4b09d1,
+	0x18ea69d3fb05d9f4, 0x86cf4b3168ab5ada, 0x647980d9792ee7eb, 0x1fb9a49fa9efd7ca,
+	0x38060fcc6180291d, 0xa243c7008698d892, 0x0e83f34cc9468806, 0xecb0ce8831ad52da,
+	0xdff4926b184fd713, 0xe782b181aded7327, 0x4cec57eede5b789a, 0xa9443e84b1d3c78c,
+	0x4a323dbd6d7616a3, 0x0f03c378cf2391cd, 0xa5dd86b2abfe4175, 0xb6f11b80a7c75a5a,
+	0xaa92563a3c775d51, 0x4c0111fc88b45135, 0x3a9b2ed181c8ed93, 0xddf675cec1f42136,
+	0x6eca37c997f79a7e, 0x4c0766dbc7d90fc8, 0x909b93715e4b6f1f, 0x9258f77e1cabbd01,
+	0xc4c6f8c92c29b5b7, 0x1a3adadfd401e870, 0xc4017d10e3af5467, 0x0efeefdf10489454,
+	0x3dc8580b9839bad8, 0xa40e5702ec376ce8, 0x6dca04c0f1b3c97a, 0x3860580a631b5b19,
+	0xd63a4a62834cdf0f, 0x7f62b78a0c1603a8, 0x650e29c53297d8c8, 0xbb2682fefca5b9cb,
+	0x14fc338f90be2ae0, 0x8646e318a848ed2a, 0xcdca8ed25bece9f3, 0xb0b3efecbd949443,
+	0xbf44cca067468c01, 0x1494439d1a66b603, 0x5a72a9b09e5a40a1, 0x6a0248938d2f0966,
+	0x67a00e81cb72ba3c, 0x27c09e5dc8b5841a, 0xaab3a4afe47df353, 0x3353eb8fb84702c8,
+	0x881ca26b1cada018, 0xfe037e1ad5249b63, 0x5224193a0a73a869, 0x2d3bc2c2baf7f83f,
+	0x05d4505bd2a74206, 0x96eee473f9c53596, 0x48b73315ca17900c, 0xec6d10053db071ad,
+	0x6cc924a94dac9069, 0xddf25e026e0c3529, 0x084bac8cdb4d0ef9, 0x507e13e52689ea20,
+	0xacc0b1de8fd00337, 0x9b62a4b4850eb4c0, 0xea434f75fe0452df, 0x6e117fc32c00f150,
+	0xf5847922a68d4075, 0x82ff7f18bc66be9d, 0x2f97cb9dba86ea2f, 0xf906e3c0d730d56e,
+	0x0058181df3fcd0d5, 0x91f2d62ba377986a, 0x9006dd5325e2086f, 0xaaf2e84894639e14,
+	0xe7d50342be563404, 0x698504a942f044fa, 0x6fb0940977e994e4, 0xdebcbb57ce635278,
+	0xa4ca41dc84c31116, 0xdd74e44499016593, 0x35f4ee2e6404a426, 0xcac8f90825092812,
+	0xfba23b973d02d131, 0x76363f0db226b1e7, 0x639ffe238b6612bf, 0x039eee54238bf88b,
+	0x1aa511d4eb30f8cf, 0xe10108ffb458dd35, 0x93c009d700d6dd81, 0xf5afdd53e17747ea,
+	0x135f47d9a99b56e1, 0x12e955d7ad5fa66c, 0x5d7369318a64aa67, 0x9905613318cd1b9e,
+	0xf4e0c16f51956463, 0x0d7009d6b2c91205, 0x1c465254b47cd0e1, 0x2e9dd370e777e32b,
+	0x7e6aa9f76d089048, 0xc2dfd912c7129c42, 0xe3635f88c19fdda8, 0x5bacd4a729077957,
+	0x8ee176854a2f06a0, 0x8922d72b3d09fc42, 0x9cb7914ade8ba353, 0x2c0b6e74806e18b8,
+	0x5745b0b6e6c118d7, 0x937e2b184f2705a6, 0x07ce9fe1489c8780, 0xac8e4f56faa626e3,
+	0x4d8ad9368cf82cd8, 0x10ed02c4cf915439, 0xf2a4b06ceb8f0a82, 0x12a9f13ed8a2e9fc,
+	0x211592b920ea86ef, 0x7edd88d5c1ac6a14, 0xcdc98d4c753a3e83, 0x8eff79a7dbd11360,
+	0xa6fdec691a128901, 0x269a047928bf3114, 0x1931505cfdea5d88, 0x4f1df54041aceeb7,
+	0xbbf528af448e54d9, 0x3d13b8061ca6bda7, 0x71486cc876749de7, 0x5bbc21c7b2570e30,
+	0x24e1e5c49b9fedb3, 0x13a8d9eb63f4a3c8, 0x08cf520590319dc2, 0xbfe42ef072f40212,
+	0xc3de476d091226e1, 0x3aad4f2e1d0c2734, 0x688bbd9adf785ab4, 0x27e40db3f3a2324e,
+	0xa69b3afa450eb2da, 0xc0de659ad19dfca7, 0xedc43426830ac0a5, 0x90c8aa8dce1f2647,
+	0xe23aebe87e3cac52, 0xc0528bca7452cef9, 0x54dbfc65a338ca6a, 0x74d1758c9247b940,
+	0x79f5a24bc40ff9db, 0x7fc8c6a3b8058959, 0x922b95d5df5fd6c9, 0xe6dd5ab16d51fdb0,
+	0x20d306c12349c7e5, 0xa4efdfcdeba7081a, 0x38a374dc9d39a306, 0x3b47b8db9e0b3370,
+	0x0270dd4e5288e35e, 0x533014f03147a293, 0x25de33de612eacf2, 0x1c02597749c9ef6a,
+	0xd5e6a2fbaf5a4b2b, 0x9ed89b31cb52295e, 0xdf1da72f616cebfa, 0x71b00f3e7fa2a680,
+	0xea056dcd64114fe7, 0x7e2136cf45e18c43, 0x06c544cfe9fdd3fa, 0x09fdff7a0ab43996,
+	0x5ed9799e5888460a, 0x01ad070a37897044, 0x459ff0511f3664ac, 0x618d3db31e9ce9c0,
+	0x3aaab9b94cfc0a46, 0xdd8688142d0ed179, 0x57c1506b40d0b754, 0xde6001db91e612c7,
+	0xb0c916c0b39af41f, 0xf0b0275c642c9eec, 0xd03f13574a86a002, 0x679e21d295dca016,
+	0xcae003cb8b4317c2, 0x83917cbbb3703ab7, 0x341695fe013417d2, 0xf7c1805ef221fcdb,
+	0x1d0f65b40af8e14b, 0x58bd78db3a6dbb61, 0xe4a3f3807e36cfc0, 0x39769fc835bf1d38,
+	0x69d33766124f03ec, 0x1237ca1b6192782e, 0xe387ba264ac616a2, 0xd7da6fcb5c4d2310,
+	0x1c941f9c5ffb2d8f, 0xbfa848bde68f4e06, 0x644cb52ae8e575e2, 0x87dc72a8c094e868,
+	0xdae8fa7c1dc63509, 0xda2df1f42a625298, 0xd4d173b050d50423, 0x996f8add13a32f9a,
+	0x151dc2a27971489d, 0xbff00625eb7ad82d, 0x1e5cdafdd2dc8903, 0x27277d4f8f303737,
+	0x06c123f55d930f1d, 0xf45c535245e4395d, 0x132c7dc1f6495f73, 0x33ceafd1b2c04256,
+	0xe208f1920b872a74, 0x9bc0fb0ef8461d9e, 0x1204234c8500f9ea, 0xf844b7f3b06cddcd,
+	0x18e0c20b89c37f0f, 0x37a18e6e094321ef, 0x06e220c3acee0f1f, 0x176557e5d4ca4eef,
+	0xcf08502d526d7721, 0xb5b5fb75dddbc4c3, 0x0777e24d4109de08, 0xf92937b15b18b2a7,
+	0xfac6543161b69092, 0x178df5c813c2d97d, 0x749eeda2166a5d30, 0x87480d76590c3b9d,
+	0x1cebca360109a90c, 0x555dba253027c52d, 0xb164ff0952075db0, 0x0577db6a4e5248ff,
+	0xf991893301485b60, 0xd24ee3f934b7f1a1, 0x384283704e034468, 0x84378a68d49aa3b4,
+	0xefa4baae129ed38f, 0xfcb32801de22864e, 0x15de62f6828752a3, 0xeb19446726c2329c,
+	0x0bd8a64a8477c77e, 0x513c3bed6fb0bd59, 0x2443f83e8d843b6b, 0xb8250cc407f20da3,
+	0x07185753cf1e13f8, 0x2828fe81fabd4e36, 0xfa8adb1c5e387f56, 0xf0c0dd0a3a568add,
+	0xdafc26a3f9dc2cd5, 0x9803fc2ca7c8b623, 0x6ee8d2a11f1acc3d, 0xfb43d053b8371292,
+	0x43176491abcdf047, 0x2de802b66b176a00, 0x609a98ee5c381bfc, 0x6ad5d39b84219c93,
+	0x10b8f0462016f777, 0x8fe9e8b046d7e8bb, 0x1762029ea50fd47c, 0x808503f95889537c,
+	0xe4adcfeaa5105773, 0x5db538638af4bdf2, 0x72bb61cfbc1f6aaa, 0x7839edec1e951b59,
+	0xae4c813e90e36c10, 0x93444c97f86cd377, 0x68564b3b52b10daa, 0xecabbee9df336806,
+	0x8028e349752c59fe, 0xf2080b8d590bec31, 0xb848cd820470ccae, 0x225cd52c63ab7b42,
+	0x95a914a6ed0e10bb, 0x610ff440ecc1bb45, 0x65a6c46ac54deb57, 0xb978be59bcb78f91,
+	0x2062460143d1fe70, 0x4c8f4af00e8cd15c, 0x5966503d1b485005, 0xd4b0f779e43f318b,
+	0x4db8221259aa73ea, 0xb0553167fc504cab, 0x34a18ac5a31bf65e, 0xd4c47294c7e14ec8,
+	0xf5423f8aad5f1be9, 0x0906ae1e194247c5, 0xccfcc6247565ee3f, 0x170f192b98d71345,
+	0xf77b01c9d3a5c562, 0x0ab0883b3b6233d8, 0xc03cb58e500df602, 0x000000009b75de9b
+}
+};
+/*-------------- END generated by genmelgjump.c, do not edit ---------------*/
+
+#define MELG_JUMP_BIT(a, i)	(((a)[(i) / 64] >> ((i) % 64)) & 1)
+
+/* st = phi(F) st, for the jump polynomial phi in auPoly */
+static void melg_jump_poly_r(struct melg_state *st, const uint64_t *auPoly)
+{
+	struct melg_state y, z, atab[1 << (MELG_JUMP_WINDOW - 1)];
+	int i, j, k, h, bZero;
+	
+	// atab[h >> 1] = h(F) x, for odd h of degree < MELG_JUMP_WINDOW
+	atab[0] = *st;
+	z = *st;
+	for (k = 1; k < MELG_JUMP_WINDOW; k++)
+	{
+		melg_next_uint64_r(&z); // z = F^k x
+		for (h = 0; h < (1 << (k - 1)); h++)
+		{
+			atab[(1 << (k - 1)) + h] = atab[h];
+			melg_add(&atab[(1 << (k - 1)) + h], &z);
 		}
 	}
 	
-	/*updates the new initial state*/
-	lung = melg_state_init->lung;
-	for(i = 0; i < NN; i++) melg[i] = melg_state_init->melg[i];
-	melgi = melg_state_init->melgi;
-	melg_next_uint64 = melg_state_init->function_p;
-	
-	free(melg_state_init);
+	// Horner, from the highest coefficient; y = 0 is not stepped
+	memset(&y, 0, sizeof(y));
+	y.melgi = st->melgi;
+	y.function_p = st->function_p;
+	bZero = 1;
+	for (i = MELG_DEG - 1; i >= 0; )
+	{
+		if (!MELG_JUMP_BIT(auPoly, i))
+		{
+			if (!bZero)
+				melg_next_uint64_r(&y);
+			i--;
+			continue;
+		}
+		j = (i >= MELG_JUMP_WINDOW - 1) ? i - (MELG_JUMP_WINDOW - 1) : 0;
+		while (!MELG_JUMP_BIT(auPoly, j))
+			j++;
+		h = 0;
+		for (k = i; k >= j; k--)
+		{
+			h = (h << 1) | (int)MELG_JUMP_BIT(auPoly, k);
+			if (!bZero)
+				melg_next_uint64_r(&y);
+		}
+		melg_add(&y, &atab[h >> 1]);
+		bZero = 0;
+		i = j - 1;
+	}
+	*st = y;
+}
+
+/* This is a jump function for the generator. It is equivalent
+   to 2^256 calls to melg_next_uint64(). */
+void melg_jump_r(struct melg_state *st)
+{
+	melg_jump_poly_r(st, s_auMELGJump[0]);
+}
+
+void melg_jump(void)
+{
+	melg_jump_r(&s_ranDefault.melg);
 }
 
-static void melg_add(struct melg_state *state)
+static void melg_add(struct melg_state *state, const struct melg_state *st)
 {
 	int i;
 	int n1, n2;
 	int diff1, diff2;
+	const uint64_t *melg = st->melg;
 	
 	/*adds the lung*/
-	state->lung ^= lung;
+	state->lung ^= st->lung;
 	
 	n1 = state->melgi;
-	n2 = melgi;
+	n2 = st->melgi;
 
 	/*adds the states*/
 	if(n1 <= n2)
@@ -552,32 +1878,45 @@ static void melg_add(struct melg_state *state)
  * Interface between MELG19937 and zigrandom
  *----------------------------------------------------------------*/
 
-static void RanSetSeed_MELG19937(uint64_t uSeed)
+static void RanSetSeed_MELG19937(RANSTATE *pRan, uint64_t uSeed)
 {
-	melg_init_uint64seed(uSeed);
+	melg_init_uint64seed_r(&pRan->melg, uSeed);
 }
 
-static void RanJump_MELG19937(uint64_t uJumps)
+/* uJumps jumps of 2^256 steps: one precomputed jump polynomial for each
+   bit of uJumps, and (uJumps >> (MELG_JUMP_NPOLY - 1)) times the largest
+   one for the higher bits. */
+static void RanJump_MELG19937(RANSTATE *pRan, uint64_t uJumps)
 {
 	uint64_t i;
-	for (i=0; i<uJumps; i++)
-		melg_jump();
+	int j;
+	
+	for (j = 0; j < MELG_JUMP_NPOLY - 1; j++)
+		if ((uJumps >> j) & 1)
+			melg_jump_poly_r(&pRan->melg, s_auMELGJump[j]);
+	for (i = 0; i < (uJumps >> (MELG_JUMP_NPOLY - 1)); i++)
+		melg_jump_poly_r(&pRan->melg, s_auMELGJump[MELG_JUMP_NPOLY - 1]);
 }
 
-static void RanSeedJump_MELG19937(uint64_t uSeed, uint64_t uJumpsize)
+static void RanSeedJump_MELG19937(RANSTATE *pRan, uint64_t uSeed, uint64_t uJumpsize)
 {
-	RanSetSeed_MELG19937(uSeed);
+	RanSetSeed_MELG19937(pRan, uSeed);
 	if (uJumpsize > 0)
 	{
-		RanJump_MELG19937(uJumpsize);
+		RanJump_MELG19937(pRan, uJumpsize);
 	}
 }
 
 /* The 32-bit unsigned integer U32Ran random routine uses only
    the upper 32 bits of MELG19937. */
-static uint32_t U32Ran_MELG19937(void)
+static uint32_t U32Ran_MELG19937(RANSTATE *pRan)
+{
+	return (uint32_t)(melg_next_uint64_r(&pRan->melg) >> 32);
+}
+
+static uint64_t U64Ran_MELG19937(RANSTATE *pRan)
 {
-	return (uint32_t)(melg_next_uint64() >> 32);
+	return melg_next_uint64_r(&pRan->melg);
 }
 
 /* This is the same uint64 to (0,1) double converter as used
@@ -585,17 +1924,17 @@ static uint32_t U32Ran_MELG19937(void)
    
    We may also test the conversion routines included in the
    MELG code (compare for speed, may be less portable) */ 
-static double DRan_MELG19937(void)
+static double DRan_MELG19937(RANSTATE *pRan)
 {
 	uint64_t xx;
 	
 	/*
 	xx = 0;
 	while (xx == 0)
-		xx = (melg_next_uint64() >> 11);
+		xx = (melg_next_uint64_r(&pRan->melg) >> 11);
 	*/
 	
-	while ((xx = (melg_next_uint64() >> 11)) == 0)
+	while ((xx = (melg_next_uint64_r(&pRan->melg) >> 11)) == 0)
 		;
 	
 	return (xx * 0x1.0p-53);
@@ -663,9 +2002,11 @@ static inline uint64_t rotl(const uint64_t x, int k) {
 }
 
 
-static uint64_t xoshiro256p_s[4];
+/* The state uint64_t s[4] is part of RANSTATE. The functions with the 
+   '_r' suffix operate on a given state, the original functions without
+   suffix on the state of the default generator. */
 
-uint64_t xoshiro256p_next(void) {
+static inline uint64_t xoshiro256p_next_r(uint64_t *xoshiro256p_s) {
 	const uint64_t result = xoshiro256p_s[0] + xoshiro256p_s[3];
 
 	const uint64_t t = xoshiro256p_s[1] << 17;
@@ -682,12 +2023,16 @@ uint64_t xoshiro256p_next(void) {
 	return result;
 }
 
+uint64_t xoshiro256p_next(void) {
+	return xoshiro256p_next_r(s_ranDefault.xoshiro256p_s);
+}
+
 
 /* This is the jump function for the generator. It is equivalent
    to 2^128 calls to next(); it can be used to generate 2^128
    non-overlapping subsequences for parallel computations. */
 
-void xoshiro256p_jump(void) {
+void xoshiro256p_jump_r(uint64_t *xoshiro256p_s) {
 	static const uint64_t JUMP[] = { 0x180ec6d33cfd0aba, 0xd5a61266f0c9392c, 0xa9582618e03fc9aa, 0x39abdc4529b1661c };
 
 	uint64_t s0 = 0;
@@ -702,7 +2047,7 @@ void xoshiro256p_jump(void) {
 				s2 ^= xoshiro256p_s[2];
 				s3 ^= xoshiro256p_s[3];
 			}
-			xoshiro256p_next();	
+			xoshiro256p_next_r(xoshiro256p_s);	
 		}
 		
 	xoshiro256p_s[0] = s0;
@@ -711,13 +2056,17 @@ void xoshiro256p_jump(void) {
 	xoshiro256p_s[3] = s3;
 }
 
+void xoshiro256p_jump(void) {
+	xoshiro256p_jump_r(s_ranDefault.xoshiro256p_s);
+}
+
 
 /* This is the long-jump function for the generator. It is equivalent to
    2^192 calls to next(); it can be used to generate 2^64 starting points,
    from each of which jump() will generate 2^64 non-overlapping
    subsequences for parallel distributed computations. */
 
-void xoshiro256p_long_jump(void) {
+void xoshiro256p_long_jump_r(uint64_t *xoshiro256p_s) {
 	static const uint64_t LONG_JUMP[] = { 0x76e15d3efefdcbbf, 0xc5004e441c522fb3, 0x77710069854ee241, 0x39109bb02acbe635 };
 
 	uint64_t s0 = 0;
@@ -732,7 +2081,7 @@ void xoshiro256p_long_jump(void) {
 				s2 ^= xoshiro256p_s[2];
 				s3 ^= xoshiro256p_s[3];
 			}
-			xoshiro256p_next();	
+			xoshiro256p_next_r(xoshiro256p_s);	
 		}
 		
 	xoshiro256p_s[0] = s0;
@@ -741,6 +2090,10 @@ void xoshiro256p_long_jump(void) {
 	xoshiro256p_s[3] = s3;
 }
 
+void xoshiro256p_long_jump(void) {
+	xoshiro256p_long_jump_r(s_ranDefault.xoshiro256p_s);
+}
+
 
 /*----------------------------------------------------------------
  * splitmix64
@@ -780,64 +2133,429 @@ IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE. */
 
 static uint64_t splitmix64_x; /* The state can be seeded with any value. */
 
-uint64_t splitmix64_next() {
-	uint64_t z = (splitmix64_x += 0x9e3779b97f4a7c15);
+#define SPLITMIX64_GAMMA 0x9e3779b97f4a7c15
+
+/* Splitmix64 is only used for seeding the other generators, with a 
+   local state passed to splitmix64_next_r(). */
+static inline uint64_t splitmix64_next_r(uint64_t *pState) {
+	uint64_t z = (*pState += SPLITMIX64_GAMMA);
 	z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9;
 	z = (z ^ (z >> 27)) * 0x94d049bb133111eb;
 	return z ^ (z >> 31);
 }
 
+uint64_t splitmix64_next() {
+	return splitmix64_next_r(&splitmix64_x);
+}
+
+/* Fast-forward by n steps, equivalent to n calls of splitmix64_next_r().
+   The state is a counter incremented by SPLITMIX64_GAMMA, followed by the
+   mixing of the output, so that this is a single multiply-add (mod 2^64).
+   It is used for the seed-jump streams of MWC8222 and Lehmer64, which
+   forward the initializing Splitmix64 generator (see RanSeedJump_MWC8222
+   and RanSeedJump_lehmer64). */
+static inline void splitmix64_advance_r(uint64_t *pState, uint64_t n) {
+	*pState += n * SPLITMIX64_GAMMA;
+}
+
+void splitmix64_advance(uint64_t n) {
+	splitmix64_advance_r(&splitmix64_x, n);
+}
+
 
 /*----------------------------------------------------------------
  * Interface between xoshiro256+ and zigrandom
  *----------------------------------------------------------------*/
 
-static void RanSetSeed_xoshiro256p(uint64_t uSeed)
+static void RanSetSeed_xoshiro256p(RANSTATE *pRan, uint64_t uSeed)
 {
-	RanSetSeed_splitmix64(uSeed); // seed splitmix
+	uint64_t uSplitmix;
+	
+	RanSetSeed_splitmix64(&uSplitmix, uSeed); // seed splitmix
 	
 	// use splitmix to fully seed xoshiro256p
-	xoshiro256p_s[0] = splitmix64_next();
-	xoshiro256p_s[1] = splitmix64_next();
-	xoshiro256p_s[2] = splitmix64_next();
-	xoshiro256p_s[3] = splitmix64_next();
+	pRan->xoshiro256p_s[0] = splitmix64_next_r(&uSplitmix);
+	pRan->xoshiro256p_s[1] = splitmix64_next_r(&uSplitmix);
+	pRan->xoshiro256p_s[2] = splitmix64_next_r(&uSplitmix);
+	pRan->xoshiro256p_s[3] = splitmix64_next_r(&uSplitmix);
 }
 
-static void RanJump_xoshiro256p(uint64_t uJumps)
+static void RanJump_xoshiro256p(RANSTATE *pRan, uint64_t uJumps)
 {
 	uint64_t i;
 	for (i=0; i<uJumps; i++)
-		xoshiro256p_long_jump();
+		xoshiro256p_long_jump_r(pRan->xoshiro256p_s);
 }
 
-static void RanSeedJump_xoshiro256p(uint64_t uSeed, uint64_t uJumpsize)
+static void RanSeedJump_xoshiro256p(RANSTATE *pRan, uint64_t uSeed, uint64_t uJumpsize)
 {
-	RanSetSeed_xoshiro256p(uSeed);
+	RanSetSeed_xoshiro256p(pRan, uSeed);
 	if (uJumpsize > 0)
 	{
-		RanJump_xoshiro256p(uJumpsize);
+		RanJump_xoshiro256p(pRan, uJumpsize);
 	}
 }
 
 /* The 32-bit unsigned integer U32Ran random routine uses only
    the upper 32 bits of Xoshiro256+, which are of highest
    random quality, and should pass all randomness tests. */
-static uint32_t U32Ran_xoshiro256p(void)
+static uint32_t U32Ran_xoshiro256p(RANSTATE *pRan)
+{
+	return (uint32_t)(xoshiro256p_next_r(pRan->xoshiro256p_s) >> 32);
+}
+
+static uint64_t U64Ran_xoshiro256p(RANSTATE *pRan)
 {
-	return (uint32_t)(xoshiro256p_next() >> 32);
+	return xoshiro256p_next_r(pRan->xoshiro256p_s);
 }
 
-static double DRan_xoshiro256p(void)
+static double DRan_xoshiro256p(RANSTATE *pRan)
 {
 	uint64_t xx;
 	
 	/*
 	xx = 0;
 	while (xx == 0)
-		xx = (xoshiro256p_next() >> 11);
+		xx = (xoshiro256p_next_r(pRan->xoshiro256p_s) >> 11);
 	*/
 	
-	while ((xx = (xoshiro256p_next() >> 11)) == 0)
+	while ((xx = (xoshiro256p_next_r(pRan->xoshiro256p_s) >> 11)) == 0)
+		;
+	
+	return (xx * 0x1.0p-53);
+}
+
+
+/*----------------------------------------------------------------
+ * Multi-lane Xoshiro256+ (Xoshiro256+x4 and Xoshiro256+x8)
+ *
+ * L = 4 or 8 independent Xoshiro256+ generators ('lanes') are run
+ * in parallel, using the GCC vector extensions. These are compiled to
+ * SSE2 instructions, which are not faster than the scalar Xoshiro256+, 
+ * and, on x86-64, also to AVX2 and AVX-512 instructions, of which the 
+ * best supported by the CPU is used (see RanSetIsa).
+ *
+ * Lane layout and jump scheme. Lane 0 is seeded exactly as the scalar 
+ * Xoshiro256+, i.e. with Splitmix64 from uSeed, followed by uJumpsize 
+ * long jumps (2^192 steps). Lane l is lane 0 advanced by l jumps (2^128
+ * steps each) using xoshiro256p_jump(). The lanes therefore are provably
+ * disjoint substreams, and the streams for different uJumpsize remain
+ * disjoint as well. Lane 0 reproduces the scalar Xoshiro256+ sequence.
+ *
+ * Output order. Each step of the engine yields one number from every 
+ * lane: the k-th step gives numbers k*L + 0 ... k*L + (L-1) of the output
+ * stream, from lanes 0 ... L-1, respectively. The output stream is thus
+ * fully determined by uSeed, uJumpsize and the number of lanes L. 
+ * The engine fills an internal buffer from which the scalar functions
+ * draw; the bulk functions generate directly into the output array. Both 
+ * give the same stream.
+ *----------------------------------------------------------------*/
+
+typedef uint64_t xoshiro256p_v4 __attribute__((vector_size(32)));
+typedef double xoshiro256p_v4d __attribute__((vector_size(32)));
+
+/* The engines for L = 4 or 8 lanes perform nsteps steps, writing 
+   nsteps * L numbers to pOut. The lanes are held in vectors of 4, as two
+   separate vectors of 4 give the best code for both AVX2 and AVX-512.
+   
+   xoshiro256pxL_generate() writes the raw 64-bit numbers.
+   
+   xoshiro256pxL_generate_double() writes uniform doubles, as 
+   DRan_xoshiro256px, except that the numbers that are rejected there 
+   (xx == 0) are written as 0.0. The upper 53 bits xx are converted 
+   exactly, by placing their upper and lower parts in the mantissas of 
+   2^84 and 2^52, so that no vector integer to double conversion 
+   instructions are needed. Returns non-zero if a 0.0 was written.
+   
+   State and output are accessed with memcpy, which allows for unaligned
+   vector loads and stores. */
+#define XOSHIRO256PX_LOAD(s0, s1, s2, s3, l)                                  \
+	memcpy(&s0, xs[0] + l, sizeof(s0));                                       \
+	memcpy(&s1, xs[1] + l, sizeof(s1));                                       \
+	memcpy(&s2, xs[2] + l, sizeof(s2));                                       \
+	memcpy(&s3, xs[3] + l, sizeof(s3));
+
+#define XOSHIRO256PX_STORE(s0, s1, s2, s3, l)                                 \
+	memcpy(xs[0] + l, &s0, sizeof(s0));                                       \
+	memcpy(xs[1] + l, &s1, sizeof(s1));                                       \
+	memcpy(xs[2] + l, &s2, sizeof(s2));                                       \
+	memcpy(xs[3] + l, &s3, sizeof(s3));
+
+#define XOSHIRO256PX_STEP(s0, s1, s2, s3)                                     \
+	t = s1 << 17;                                                             \
+	s2 ^= s0;                                                                 \
+	s3 ^= s1;                                                                 \
+	s1 ^= s2;                                                                 \
+	s0 ^= s3;                                                                 \
+	s2 ^= t;                                                                  \
+	s3 = (s3 << 45) | (s3 >> 19);
+
+#define XOSHIRO256PX_DOUBLE(s0, s3, pd)                                       \
+	t = (s0 + s3) >> 11;                                                      \
+	uzero |= t - 1;                            /* bit 63 set if t == 0 */     \
+	uhi = (t >> 32) | 0x4530000000000000ULL;          /* 2^84 + hi * 2^32 */  \
+	ulo = (t & 0xFFFFFFFFULL) | 0x4330000000000000ULL;       /* 2^52 + lo */  \
+	memcpy(&dhi, &uhi, sizeof(dhi));                                          \
+	memcpy(&dlo, &ulo, sizeof(dlo));                                          \
+	dhi = ((dhi - 0x1.0p84) + (dlo - 0x1.0p52)) * 0x1.0p-53;                  \
+	memcpy(pd, &dhi, sizeof(dhi));
+
+static inline __attribute__((always_inline))
+void xoshiro256px4_generate_inline(uint64_t (*xs)[XOSHIRO256PX_LANES_MAX],
+                                   uint64_t *pOut, size_t nsteps)
+{
+	xoshiro256p_v4 s0, s1, s2, s3, t;
+	size_t k;
+	
+	XOSHIRO256PX_LOAD(s0, s1, s2, s3, 0)
+	for (k = 0; k < nsteps; k++)
+	{
+		t = s0 + s3;
+		memcpy(pOut + 4 * k, &t, sizeof(t));
+		XOSHIRO256PX_STEP(s0, s1, s2, s3)
+	}
+	XOSHIRO256PX_STORE(s0, s1, s2, s3, 0)
+}
+
+static inline __attribute__((always_inline))
+void xoshiro256px8_generate_inline(uint64_t (*xs)[XOSHIRO256PX_LANES_MAX],
+                                   uint64_t *pOut, size_t nsteps)
+{
+	xoshiro256p_v4 s0, s1, s2, s3, r0, r1, r2, r3, t;
+	size_t k;
+	
+	XOSHIRO256PX_LOAD(s0, s1, s2, s3, 0)
+	XOSHIRO256PX_LOAD(r0, r1, r2, r3, 4)
+	for (k = 0; k < nsteps; k++)
+	{
+		t = s0 + s3;
+		memcpy(pOut + 8 * k, &t, sizeof(t));
+		t = r0 + r3;
+		memcpy(pOut + 8 * k + 4, &t, sizeof(t));
+		XOSHIRO256PX_STEP(s0, s1, s2, s3)
+		XOSHIRO256PX_STEP(r0, r1, r2, r3)
+	}
+	XOSHIRO256PX_STORE(s0, s1, s2, s3, 0)
+	XOSHIRO256PX_STORE(r0, r1, r2, r3, 4)
+}
+
+static inline __attribute__((always_inline))
+uint64_t xoshiro256px4_generate_double_inline(
+                 uint64_t (*xs)[XOSHIRO256PX_LANES_MAX], double *pOut,
+                 size_t nsteps)
+{
+	xoshiro256p_v4 s0, s1, s2, s3, t, uhi, ulo, uzero = {0};
+	xoshiro256p_v4d dhi, dlo;
+	size_t k;
+	
+	XOSHIRO256PX_LOAD(s0, s1, s2, s3, 0)
+	for (k = 0; k < nsteps; k++)
+	{
+		XOSHIRO256PX_DOUBLE(s0, s3, pOut + 4 * k)
+		XOSHIRO256PX_STEP(s0, s1, s2, s3)
+	}
+	XOSHIRO256PX_STORE(s0, s1, s2, s3, 0)
+	return (uzero[0] | uzero[1] | uzero[2] | uzero[3]) >> 63;
+}
+
+static inline __attribute__((always_inline))
+uint64_t xoshiro256px8_generate_double_inline(
+                 uint64_t (*xs)[XOSHIRO256PX_LANES_MAX], double *pOut,
+                 size_t nsteps)
+{
+	xoshiro256p_v4 s0, s1, s2, s3, r0, r1, r2, r3, t, uhi, ulo, uzero = {0};
+	xoshiro256p_v4d dhi, dlo;
+	size_t k;
+	
+	XOSHIRO256PX_LOAD(s0, s1, s2, s3, 0)
+	XOSHIRO256PX_LOAD(r0, r1, r2, r3, 4)
+	for (k = 0; k < nsteps; k++)
+	{
+		XOSHIRO256PX_DOUBLE(s0, s3, pOut + 8 * k)
+		XOSHIRO256PX_DOUBLE(r0, r3, pOut + 8 * k + 4)
+		XOSHIRO256PX_STEP(s0, s1, s2, s3)
+		XOSHIRO256PX_STEP(r0, r1, r2, r3)
+	}
+	XOSHIRO256PX_STORE(s0, s1, s2, s3, 0)
+	XOSHIRO256PX_STORE(r0, r1, r2, r3, 4)
+	return (uzero[0] | uzero[1] | uzero[2] | uzero[3]) >> 63;
+}
+
+/* The engines are compiled for each instruction set (RANISA_SCALAR, ...),
+   which only changes the vector instructions used: the output is the 
+   same. The instruction set is selected at run time, by pRan->iIsa. */
+#define XOSHIRO256PX_KERNELS(isa, target)                                     \
+target static void xoshiro256px4_generate_##isa(                              \
+                 uint64_t (*xs)[XOSHIRO256PX_LANES_MAX], uint64_t *pOut,      \
+                 size_t nsteps)                                               \
+{                                                                             \
+	xoshiro256px4_generate_inline(xs, pOut, nsteps);                          \
+}                                                                             \
+target static void xoshiro256px8_generate_##isa(                              \
+                 uint64_t (*xs)[XOSHIRO256PX_LANES_MAX], uint64_t *pOut,      \
+                 size_t nsteps)                                               \
+{                                                                             \
+	xoshiro256px8_generate_inline(xs, pOut, nsteps);                          \
+}                                                                             \
+target static uint64_t xoshiro256px4_generate_double_##isa(                   \
+                 uint64_t (*xs)[XOSHIRO256PX_LANES_MAX], double *pOut,        \
+                 size_t nsteps)                                               \
+{                                                                             \
+	return xoshiro256px4_generate_double_inline(xs, pOut, nsteps);            \
+}                                                                             \
+target static uint64_t xoshiro256px8_generate_double_##isa(                   \
+                 uint64_t (*xs)[XOSHIRO256PX_LANES_MAX], double *pOut,        \
+                 size_t nsteps)                                               \
+{                                                                             \
+	return xoshiro256px8_generate_double_inline(xs, pOut, nsteps);            \
+}
+
+XOSHIRO256PX_KERNELS(scalar, )
+#ifdef RANDOMMW_DISPATCH
+XOSHIRO256PX_KERNELS(avx2, RANDOMMW_TARGET_AVX2)
+XOSHIRO256PX_KERNELS(avx512, RANDOMMW_TARGET_AVX512)
+#endif
+
+static void xoshiro256px_generate(RANSTATE *pRan, uint64_t *pOut, size_t nsteps)
+{
+	int b8 = (pRan->xoshiro256px_lanes == 8);
+	
+#ifdef RANDOMMW_DISPATCH
+	if (pRan->iIsa == RANISA_AVX512)
+	{
+		if (b8)
+			xoshiro256px8_generate_avx512(pRan->xoshiro256px_s, pOut, nsteps);
+		else
+			xoshiro256px4_generate_avx512(pRan->xoshiro256px_s, pOut, nsteps);
+		return;
+	}
+	if (pRan->iIsa == RANISA_AVX2)
+	{
+		if (b8)
+			xoshiro256px8_generate_avx2(pRan->xoshiro256px_s, pOut, nsteps);
+		else
+			xoshiro256px4_generate_avx2(pRan->xoshiro256px_s, pOut, nsteps);
+		return;
+	}
+#endif
+	if (b8)
+		xoshiro256px8_generate_scalar(pRan->xoshiro256px_s, pOut, nsteps);
+	else
+		xoshiro256px4_generate_scalar(pRan->xoshiro256px_s, pOut, nsteps);
+}
+
+static uint64_t xoshiro256px_generate_double(RANSTATE *pRan, double *pOut, 
+                                             size_t nsteps)
+{
+	int b8 = (pRan->xoshiro256px_lanes == 8);
+	
+#ifdef RANDOMMW_DISPATCH
+	if (pRan->iIsa == RANISA_AVX512)
+		return b8 ? xoshiro256px8_generate_double_avx512(pRan->xoshiro256px_s,
+		                                                 pOut, nsteps)
+		          : xoshiro256px4_generate_double_avx512(pRan->xoshiro256px_s,
+		                                                 pOut, nsteps);
+	if (pRan->iIsa == RANISA_AVX2)
+		return b8 ? xoshiro256px8_generate_double_avx2(pRan->xoshiro256px_s,
+		                                               pOut, nsteps)
+		          : xoshiro256px4_generate_double_avx2(pRan->xoshiro256px_s,
+		                                               pOut, nsteps);
+#endif
+	return b8 ? xoshiro256px8_generate_double_scalar(pRan->xoshiro256px_s,
+	                                                 pOut, nsteps)
+	          : xoshiro256px4_generate_double_scalar(pRan->xoshiro256px_s,
+	                                                 pOut, nsteps);
+}
+
+static void xoshiro256px_refill(RANSTATE *pRan)
+{
+	xoshiro256px_generate(pRan, pRan->xoshiro256px_buf, 
+	                      XOSHIRO256PX_BUF / pRan->xoshiro256px_lanes);
+	pRan->xoshiro256px_bufi = 0;
+}
+
+/* Seed lane 0 as the scalar Xoshiro256+ (see RanSeedJump_xoshiro256p),
+   and place the other lanes at distances of 2^128 steps. The output
+   buffer is emptied. */
+static void RanSeedJump_xoshiro256px(RANSTATE *pRan, uint64_t uSeed, 
+                                     uint64_t uJumpsize, int iLanes)
+{
+	uint64_t uSplitmix, s[4], i;
+	int j, l;
+	
+	RanSetSeed_splitmix64(&uSplitmix, uSeed);
+	for (j = 0; j < 4; j++)
+		s[j] = splitmix64_next_r(&uSplitmix);
+	for (i = 0; i < uJumpsize; i++)
+		xoshiro256p_long_jump_r(s);
+	
+	memset(pRan->xoshiro256px_s, 0, sizeof(pRan->xoshiro256px_s));
+	for (l = 0; l < iLanes; l++)
+	{
+		for (j = 0; j < 4; j++)
+			pRan->xoshiro256px_s[j][l] = s[j];
+		xoshiro256p_jump_r(s);
+	}
+	pRan->xoshiro256px_lanes = iLanes;
+	pRan->xoshiro256px_bufi = XOSHIRO256PX_BUF;
+}
+
+static void RanSetSeed_xoshiro256px4(RANSTATE *pRan, uint64_t uSeed)
+{
+	RanSeedJump_xoshiro256px(pRan, uSeed, 0, 4);
+}
+
+static void RanSetSeed_xoshiro256px8(RANSTATE *pRan, uint64_t uSeed)
+{
+	RanSeedJump_xoshiro256px(pRan, uSeed, 0, 8);
+}
+
+static void RanSeedJump_xoshiro256px4(RANSTATE *pRan, uint64_t uSeed, uint64_t uJumpsize)
+{
+	RanSeedJump_xoshiro256px(pRan, uSeed, uJumpsize, 4);
+}
+
+static void RanSeedJump_xoshiro256px8(RANSTATE *pRan, uint64_t uSeed, uint64_t uJumpsize)
+{
+	RanSeedJump_xoshiro256px(pRan, uSeed, uJumpsize, 8);
+}
+
+/* Long jump (2^192 steps) of every lane. Numbers remaining in the output
+   buffer are discarded. */
+static void RanJump_xoshiro256px(RANSTATE *pRan, uint64_t uJumps)
+{
+	uint64_t s[4], i;
+	int j, l;
+	
+	for (l = 0; l < pRan->xoshiro256px_lanes; l++)
+	{
+		for (j = 0; j < 4; j++)
+			s[j] = pRan->xoshiro256px_s[j][l];
+		for (i = 0; i < uJumps; i++)
+			xoshiro256p_long_jump_r(s);
+		for (j = 0; j < 4; j++)
+			pRan->xoshiro256px_s[j][l] = s[j];
+	}
+	pRan->xoshiro256px_bufi = XOSHIRO256PX_BUF;
+}
+
+static inline uint64_t U64Ran_xoshiro256px(RANSTATE *pRan)
+{
+	if (pRan->xoshiro256px_bufi >= XOSHIRO256PX_BUF)
+		xoshiro256px_refill(pRan);
+	return pRan->xoshiro256px_buf[pRan->xoshiro256px_bufi++];
+}
+
+static uint32_t U32Ran_xoshiro256px(RANSTATE *pRan)
+{
+	return (uint32_t)(U64Ran_xoshiro256px(pRan) >> 32);
+}
+
+static double DRan_xoshiro256px(RANSTATE *pRan)
+{
+	uint64_t xx;
+	
+	while ((xx = (U64Ran_xoshiro256px(pRan) >> 11)) == 0)
 		;
 	
 	return (xx * 0x1.0p-53);
@@ -848,14 +2566,14 @@ static double DRan_xoshiro256p(void)
  * Interface to splitmix64
  *----------------------------------------------------------------*/
 
-static void RanSetSeed_splitmix64(uint64_t uSeed)
+static void RanSetSeed_splitmix64(uint64_t *pState, uint64_t uSeed)
 {
-	splitmix64_x = uSeed; // seed splitmix
+	*pState = uSeed; // seed splitmix
 }
 
-static uint32_t U32Ran_splitmix64(void)
+static uint32_t U32Ran_splitmix64(uint64_t *pState)
 {
-	return (uint32_t)(splitmix64_next() >> 32);
+	return (uint32_t)(splitmix64_next_r(pState) >> 32);
 }
 
 /*
@@ -890,8 +2608,6 @@ double DRan_splitmix64(void)
   ==========================================================================*/
 
 
-static __uint128_t g_lehmer64_state;
-
 /*
 * D. H. Lehmer, Mathematical methods in large-scale computing units.
 * Proceedings of a Second Symposium on Large Scale Digital Calculating
@@ -917,63 +2633,132 @@ static inline void lehmer64_seed(uint64_t uSeed)
 }
 */
 
-static inline uint64_t lehmer64()
+/* The 128-bit state is part of RANSTATE */
+#define LEHMER64_MULT	UINT64_C(0xda942042e4dd58b5)
+
+static inline uint64_t lehmer64(__uint128_t *g_lehmer64_state)
 {
-	g_lehmer64_state *= UINT64_C(0xda942042e4dd58b5);
-	return g_lehmer64_state >> 64;
+	*g_lehmer64_state *= LEHMER64_MULT;
+	return *g_lehmer64_state >> 64;
 }
 
-
-/*----------------------------------------------------------------
- * Interface between lehmer64 and zigrandom
- *  based on the xoshiro256+ interface
+/* Advance the generator by 'delta' steps at once. Lehmer64 is a purely
+   multiplicative LCG modulo 2^128, so that 'delta' steps are a 
+   multiplication of the state by LEHMER64_MULT^delta (mod 2^128). The
+   power is obtained by square-and-multiply, in at most 128 iterations
+   (cf. pcg_advance_lcg_128 for the PCG64DXSM, with zero increment). 
+   
+   The multiplier is 5 mod 8, which gives a period of 2^126 for odd
+   states. A state that is 2^k times an odd number has period 2^(126-k). */
+static inline void lehmer64_advance(__uint128_t *g_lehmer64_state,
+                                    __uint128_t delta)
+{
+	__uint128_t cur_mult = LEHMER64_MULT;
+	__uint128_t acc_mult = 1u;
+	
+	while (delta > 0)
+	{
+		if (delta & 1)
+			acc_mult *= cur_mult;
+		cur_mult *= cur_mult;
+		delta >>= 1;
+	}
+	*g_lehmer64_state *= acc_mult;
+}
+
+/* Size of a Lehmer64 jump: 2^RANDOMMW_LEHMER64_JUMP_LOG2 steps. The
+   default of 2^64 steps divides the period into 2^62 non-overlapping
+   substreams of 2^64 numbers each. It may be changed at compile time,
+   but this changes the streams obtained with uJumpsize > 0. */
+#ifndef RANDOMMW_LEHMER64_JUMP_LOG2
+#define RANDOMMW_LEHMER64_JUMP_LOG2 64
+#endif
+#if (RANDOMMW_LEHMER64_JUMP_LOG2 < 0) || (RANDOMMW_LEHMER64_JUMP_LOG2 > 125)
+#error "RANDOMMW_LEHMER64_JUMP_LOG2 should be in the range 0...125"
+#endif
+
+
+/*----------------------------------------------------------------
+ * Interface between lehmer64 and zigrandom
+ *  based on the xoshiro256+ interface
  *----------------------------------------------------------------*/
 
-static void RanSetSeed_lehmer64(uint64_t uSeed)
+static void RanSetSeed_lehmer64(RANSTATE *pRan, uint64_t uSeed)
 {
-	RanSeedJump_lehmer64(uSeed, 0);
+	RanSeedJump_lehmer64(pRan, uSeed, 0);
 }
 
-/* Lehmer64 does not support 'jumps'
-
-   Here, we provide a mechanism to obtain a differently 
-   initialized Lehmer64 from the same seed, but using 'uJumpsize'
-   to forward the initializing Splitmix generator.
+/* Jumps of 2^RANDOMMW_LEHMER64_JUMP_LOG2 steps each. Note that 'uJumps'
+   jumps are done in a single advance, not 'uJumps' times a jump. 
    
-   There is a tiny, tiny chance that the different streams are
-   not completely independent. This should still be tested exhaustively,
-   but at present it seems the best method to obtain reproducible
-   independent streams with this generator.
+   The state is first made odd, so that the jumps are taken on the full
+   period of 2^126 (see lehmer64_advance), however the state was seeded:
+   the default seeding below gives an even state for half of the seeds. */
+static void RanJump_lehmer64(RANSTATE *pRan, uint64_t uJumps)
+{
+	if (uJumps == 0)
+		return;
+	pRan->lehmer64_state |= 1;
+	lehmer64_advance(&pRan->lehmer64_state, 
+	                 ((__uint128_t)uJumps) << RANDOMMW_LEHMER64_JUMP_LOG2);
+}
 
-*/
-static void RanSeedJump_lehmer64(uint64_t uSeed, uint64_t uJumpsize)
+/* The 128-bit state is initialized using 2x Splitmix64 from uSeed. 
+   'uJumpsize' forwards the initializing Splitmix64 generator by 2 numbers
+   per jump (in constant time), as in versions before the Lehmer64 jump 
+   was available, so that the streams of RanInit(.., uJumpsize) are 
+   unchanged. These are differently seeded Lehmer64 streams; RanJumpRan
+   gives non-overlapping substreams of the same Lehmer64 sequence instead.
+   
+   When compiled with RANDOMMW_SEEDJUMP_JUMPS defined, the state is 
+   jumped ahead instead, so that RanSeedJump is RanSetSeed followed by 
+   RanJumpRan, as for the other RNGs. */
+static void RanSeedJump_lehmer64(RANSTATE *pRan, uint64_t uSeed, uint64_t uJumpsize)
 {
-	unsigned int i;
+	uint64_t uSplitmix;
 
-	RanSetSeed_splitmix64(uSeed); // seed Splitmix64
+	RanSetSeed_splitmix64(&uSplitmix, uSeed); // seed Splitmix64
+#ifndef RANDOMMW_SEEDJUMP_JUMPS
+	// forward Splitmix64 by 2 numbers per jump
+	splitmix64_advance_r(&uSplitmix, 2 * uJumpsize);
+#endif
 	
-	// forward the Splitmix generator
-	for (i = 0; i < uJumpsize; i++)
+	// initialize the 128-bit state using 2x Splitmix64
+	pRan->lehmer64_state = (((__uint128_t)splitmix64_next_r(&uSplitmix)) << 64);
+	pRan->lehmer64_state += splitmix64_next_r(&uSplitmix);
+	
+#ifdef RANDOMMW_SEEDJUMP_JUMPS
+	// odd state, also without jumps, so that RanSetSeed and RanJumpRan 
+	// give the same stream as RanSeedJump. Not done for the earlier 
+	// streams above, which it would change for half of the seeds.
+	pRan->lehmer64_state |= 1;
+	if (uJumpsize > 0)
 	{
-		splitmix64_next();
-		splitmix64_next();
+		RanJump_lehmer64(pRan, uJumpsize);
 	}
-	
-	// initialize the 128-bit state using 2x Splitmix64
-	g_lehmer64_state = (((__uint128_t)splitmix64_next()) << 64) +
-                          splitmix64_next();
+#endif
+}
+
+static void RanAdvance_lehmer64(RANSTATE *pRan, uint64_t uSteps)
+{
+	lehmer64_advance(&pRan->lehmer64_state, uSteps);
+}
+
+static uint32_t U32Ran_lehmer64(RANSTATE *pRan)
+{
+	return (uint32_t)(lehmer64(&pRan->lehmer64_state) >> 32);
 }
 
-static uint32_t U32Ran_lehmer64(void)
+static uint64_t U64Ran_lehmer64(RANSTATE *pRan)
 {
-	return (uint32_t)(lehmer64() >> 32);
+	return lehmer64(&pRan->lehmer64_state);
 }
 
-static double DRan_lehmer64(void)
+static double DRan_lehmer64(RANSTATE *pRan)
 {
 	uint64_t xx;
 	
-	while ((xx = (lehmer64() >> 11)) == 0)
+	while ((xx = (lehmer64(&pRan->lehmer64_state) >> 11)) == 0)
 		;
 	
 	return (xx * 0x1.0p-53);
@@ -1071,16 +2856,11 @@ static double DRan_lehmer64(void)
 #error Nonstandard GNU inlining semantics. Compile with -std=c99 or better.
 #endif
 
-typedef __uint128_t pcg128_t;
+/* pcg128_t and pcg_state_setseq_128 are defined at the top of this file */
 #define PCG_128BIT_CONSTANT(high, low) (((pcg128_t)(high) << 64) + low)
 
 typedef struct { pcg128_t state; } pcg_state_128;
 
-typedef struct {
-  pcg128_t state;
-  pcg128_t inc;
-} pcg_state_setseq_128;
-
 #define PCG_DEFAULT_MULTIPLIER_HIGH 2549297995355413924ULL
 #define PCG_DEFAULT_MULTIPLIER_LOW 4865540595714422341ULL
 
@@ -1222,28 +3002,25 @@ static void _pcg64dxsm_seed_state(pcg_state_setseq_128 *stateptr, uint64_t *seed
 
 
 /*
-Simple interface, with globally stored state (only single generator possible
-per process)
+Simple interface, using the state of the default generator
 */
 
-// single, globally stored state vector for PCG64DXSM
-pcg_state_setseq_128 pcg64dxsm_state;
-
-
 // Get raw uint64 from PCG64DXSM
 extern uint64_t pcg64dxsm_next()
 {
-	return pcg_cm_random_r(&pcg64dxsm_state);
+	return pcg_cm_random_r(&s_ranDefault.pcg64dxsm_state);
 }
 
 // Get state for PCG64DXSM, for diagnostic purpose
 extern void pcg64dxsm_getstateinc(uint64_t *dataptr)
 {
-	dataptr[0] = (uint64_t)(pcg64dxsm_state.state >> 64);
-	dataptr[1] = (uint64_t)pcg64dxsm_state.state;
+	pcg_state_setseq_128 *pcg64dxsm_state = &s_ranDefault.pcg64dxsm_state;
+	
+	dataptr[0] = (uint64_t)(pcg64dxsm_state->state >> 64);
+	dataptr[1] = (uint64_t)pcg64dxsm_state->state;
 
-	dataptr[2] = (uint64_t)(pcg64dxsm_state.inc >> 64);
-	dataptr[3] = (uint64_t)pcg64dxsm_state.inc;
+	dataptr[2] = (uint64_t)(pcg64dxsm_state->inc >> 64);
+	dataptr[3] = (uint64_t)pcg64dxsm_state->inc;
 }
 
 /*----------------------------------------------------------------
@@ -1283,27 +3060,29 @@ extern void pcg64dxsm_getstateinc(uint64_t *dataptr)
 	as `Pcg64Dxsm::seed_from_u64(53280)` in Rust (rand_pcg v0.10.1). 
 */
 
-static void RanSetSeed_pcg64dxsm(uint64_t uSeed)
+static void RanSetSeed_pcg64dxsm(RANSTATE *pRan, uint64_t uSeed)
 {
 	uint64_t seed[2];
 	uint64_t inc[2];
+	uint64_t uSplitmix;
+	pcg_state_setseq_128 *pcg64dxsm_state = &pRan->pcg64dxsm_state;
 
 	if (uSeed==0)
 	{
 		// For the special case uSeed = 0,
 		// adjust state to match numpy.randomPCG64DXSM(seed = 0)
-		pcg64dxsm_state.state = 
+		pcg64dxsm_state->state = 
 			PCG_128BIT_CONSTANT(0x1aa1b5345996452d, 0x09585eb7a69561e3);
-		pcg64dxsm_state.inc   =
+		pcg64dxsm_state->inc   =
 			PCG_128BIT_CONSTANT(0x418ddadb3af71a82, 0x588133bc447873a9);
 	}
 	else if (uSeed==12345)
 	{
 		// For the special case uSeed = 12345,
 		// adjust state to match numpy.randomPCG64DXSM(seed = 12345)
-		pcg64dxsm_state.state = 
+		pcg64dxsm_state->state = 
 			PCG_128BIT_CONSTANT(0x1905e0335aae9634, 0x9199b0d09775add5);
-		pcg64dxsm_state.inc   =
+		pcg64dxsm_state->inc   =
 			PCG_128BIT_CONSTANT(0xc9c7353e6e2b1f28, 0x7d761f2d4027fae7);
 	}
 	else if (uSeed==53280)
@@ -1311,61 +3090,71 @@ static void RanSetSeed_pcg64dxsm(uint64_t uSeed)
 		// For the special case uSeed = 53280
 		// adjust state to match Rust Pcg64Dxsm::seed_from_u64(53280) 
 		// from crate rand_pcg v0.10.1
-		pcg64dxsm_state.state = 
+		pcg64dxsm_state->state = 
 			PCG_128BIT_CONSTANT(0xc8a42759023c46a4, 0x516c72c8aaf3ef96);
-		pcg64dxsm_state.inc   =
+		pcg64dxsm_state->inc   =
 			PCG_128BIT_CONSTANT(0x9e667d44da4cfdc5, 0xfdcf8d26e0e48015);
 	}
 	else
 	{
-		RanSetSeed_splitmix64(uSeed); // seed splitmix
+		RanSetSeed_splitmix64(&uSplitmix, uSeed); // seed splitmix
 		
 		// use splitmix to fill required seed, inc for PCG64DXSM
 		// Numpy uses a similar initialization, but not using
 		// SplitMix
-		seed[0] = splitmix64_next();
-		seed[1] = splitmix64_next();
-		inc[0]  = splitmix64_next();
-		inc[1]  = splitmix64_next();
+		seed[0] = splitmix64_next_r(&uSplitmix);
+		seed[1] = splitmix64_next_r(&uSplitmix);
+		inc[0]  = splitmix64_next_r(&uSplitmix);
+		inc[1]  = splitmix64_next_r(&uSplitmix);
 
-		_pcg64dxsm_seed_state(&pcg64dxsm_state, seed, inc);
+		_pcg64dxsm_seed_state(pcg64dxsm_state, seed, inc);
 	}
 }
 
-static void RanJump_pcg64dxsm(uint64_t uJumps)
+static void RanJump_pcg64dxsm(RANSTATE *pRan, uint64_t uJumps)
 {
-	_pcg64dxsm_jump(&pcg64dxsm_state, uJumps);
+	_pcg64dxsm_jump(&pRan->pcg64dxsm_state, uJumps);
 }
 
-static void RanSeedJump_pcg64dxsm(uint64_t uSeed, uint64_t uJumpsize)
+static void RanSeedJump_pcg64dxsm(RANSTATE *pRan, uint64_t uSeed, uint64_t uJumpsize)
 {
-	RanSetSeed_pcg64dxsm(uSeed);
+	RanSetSeed_pcg64dxsm(pRan, uSeed);
 	if (uJumpsize > 0)
 	{
-		RanJump_pcg64dxsm(uJumpsize);
+		RanJump_pcg64dxsm(pRan, uJumpsize);
 	}
 }
 
+static void RanAdvance_pcg64dxsm(RANSTATE *pRan, uint64_t uSteps)
+{
+	pcg_cm_advance_r(&pRan->pcg64dxsm_state, uSteps);
+}
+
 
 /* The 32-bit unsigned integer U32Ran random routine uses only
    the upper 32 bits of PCG64DXSM,, and should pass randomness
    tests. */
-static uint32_t U32Ran_pcg64dxsm(void)
+static uint32_t U32Ran_pcg64dxsm(RANSTATE *pRan)
+{
+	return (uint32_t)(pcg_cm_random_r(&pRan->pcg64dxsm_state) >> 32);
+}
+
+static uint64_t U64Ran_pcg64dxsm(RANSTATE *pRan)
 {
-	return (uint32_t)(pcg_cm_random_r(&pcg64dxsm_state) >> 32);
+	return pcg_cm_random_r(&pRan->pcg64dxsm_state);
 }
 
-static double DRan_pcg64dxsm(void)
+static double DRan_pcg64dxsm(RANSTATE *pRan)
 {
 	uint64_t xx;
 	
 	/*
 	xx = 0;
 	while (xx == 0)
-		xx = (pcg_cm_random_r(&pcg64dxsm_state) >> 11);
+		xx = (pcg_cm_random_r(&pRan->pcg64dxsm_state) >> 11);
 	*/
 	
-	while ((xx = (pcg_cm_random_r(&pcg64dxsm_state) >> 11)) == 0)
+	while ((xx = (pcg_cm_random_r(&pRan->pcg64dxsm_state) >> 11)) == 0)
 		;
 	
 	return (xx * 0x1.0p-53);
@@ -1403,13 +3192,188 @@ static double DRan_pcg64dxsm(void)
 
 
 /*------------------------ George Marsaglia MWC ----------------------------*/
-#define MWC_R  256
+/* MWC_R and MWC_C are defined at the top of this file. The state 
+   (uiStateMWC, uiCarryMWC, auiStateMWC[MWC_R]) is part of RANSTATE */
 #define MWC_A  809430660ull // unsigned long long is 64 bits
 #define MWC_AI 809430660
-#define MWC_C  362436
-static uint32_t s_uiStateMWC = MWC_R - 1;
-static uint32_t s_uiCarryMWC = MWC_C;
-static uint32_t s_auiStateMWC[MWC_R];
+
+
+/*------------------------ MWC8222 jump-ahead ------------------------------
+ *  M. H. V. Werts, 2025
+ *
+ *  The lag-r multiply-with-carry generator with base b = 2^32,
+ *      x_n = (a x_{n-r} + c_{n-1}) mod b,  c_n = (a x_{n-r} + c_{n-1}) div b,
+ *  is equivalent to a multiplicative LCG modulo the prime m = a b^r - 1
+ *  (Couture & L'Ecuyer, Math. Comp. 1997, 66, 591). The state 
+ *  (x_{n-r+1}, ..., x_n; c_n) corresponds to
+ *      Z_n = c_n + a (x_{n-r+1} + x_{n-r+2} b + ... + x_n b^(r-1)),
+ *  with Z_{n+1} = b^-1 Z_n (mod m), where b^-1 = a b^(r-1) (mod m). As 
+ *  0 <= c_n < a, the state is recovered from Z_n: c_n = Z_n mod a, and the
+ *  x are the base-b digits of Z_n div a. Advancing by k steps (32-bit 
+ *  outputs) is thus a multiplication of Z_n by b^-k mod m, by square-and-
+ *  multiply. The numbers have MWC_JUMP_LIMBS 64-bit limbs, least 
+ *  significant first. Reduction modulo m is cheap, because a b^r = 1.
+ *--------------------------------------------------------------------------*/
+#define MWC_JUMP_LIMBS	(MWC_R / 2 + 1)
+
+/* b^-(2^256) mod m: a jump of 2^256 steps. Computed with Python as
+   pow(a * b**(r-1), 2**256, a * b**r - 1), for a = MWC_A, b = 2**32 and
+   r = MWC_R. test_advance.c checks it by 256 squarings of b^-1. */
+static const uint64_t s_auMWCJump[MWC_JUMP_LIMBS] = {
+	0x089e9969574c74b0, 0xe051d1d988dc4685, 0x3cb1839cc901130b, 0xbf0eb3e3f0a47327,
+	0x4b91973508b3f06f, 0x43eeb29f3f646643, 0x0e278ab2e277cc73, 0xe2beffc6a7b3543d,
+	0x6f62c8fd33c7007f, 0x6ba10a21f55c5670, 0x8068a37d6f8c2ef7, 0x8adb022a19bc4d4c,
+	0x6dda4f49ec0c49d2, 0x3f1ab4c2ab7ccdda, 0x531f1a5f89ea497c, 0x5225f45d5156e616,
+	0xf275357c1867fb05, 0x444239db8266df4b, 0x20cf350669041cc2, 0xaf08ebb811c9f7a3,
+	0x999ba92d741f1350, 0x0226a0aee32906a5, 0x33c68b5771ca3bd8, 0xe83a163a56889793,
+	0x587a4a02cc3e58d6, 0x613bb8ad3ca7d5f3, 0x06eaaf2a58bf599a, 0xa5e6284da2c5db39,
+	0x113a6aae2ac940f8, 0xe0c3ca2b1375b55e, 0x097e96d950234c4f, 0x032c11e165e0977c,
+	0xf24c77ff8cff19e9, 0x818032e4031d6fd1, 0x8028db35bddf4c94, 0x2ab3854a1468a439,
+	0x6a0a14d9002807c0, 0xd94f5066f5a0bc86, 0x510937fc06a9e915, 0xa2c4b37959d9ef3d,
+	0xc5377239b65a5cb4, 0xbbe93e12b60f7ada, 0xc4f91db912573549, 0x47f9a47f9e4ad2f0,
+	0x8dc9bfccf22b8ff9, 0x9026f62b232ff472, 0x50edb22bd27cbd9e, 0x491bc78b452159a3,
+	0x6b23f46c75e04302, 0x6a355f0585ba013d, 0x36482985266d725b, 0xf2986515ad414e81,
+	0x0732b311e4c8d6b1, 0x4dc03bb75f2fe509, 0xd4cc64878dea5080, 0x31cff999e2b4f68b,
+	0x66617fa6dc21cfee, 0x458e0a1d3819cca3, 0xaa2a057fe87f5705, 0x54f7aa7a13731378,
+	0x154631825a668a74, 0x04797ac142f126a4, 0x8486f4e73139357a, 0x0032d40b72b652ee,
+	0x8cc924c4dfdd90ed, 0x95a8b0fb5ba73ed4, 0x758cde5f46f15555, 0xf3e2686f8379511d,
+	0xd5013177c2205c20, 0xfca73efa81d8c449, 0x5e6e03bb4f1f89f5, 0xa7c1b6bf9d3e05d8,
+	0x9b64cad62120b5a5, 0x61fe42767c354b52, 0x2b01bcfb4be92984, 0x14f529c25998633b,
+	0x3901fe69a01d95d1, 0xdacc3a90ead5d3c8, 0xb236346ed97a23d4, 0xf8600c269b6d86f9,
+	0xdd4dbaeb2a11059c, 0x7c546f18df55b3c5, 0x2c700ba0b8613a36, 0x70f5ab1d1d6f9f06,
+	0xeda708b6a2ae063e, 0xf481a438bd7e154c, 0xf5f1239ec974bb6f, 0x86e70943f87c59c6,
+	0xce025c9adeafc816, 0xeef3b1f642d48bf0, 0x9590292a0f9b6d43, 0x840029b3f55ce8f8,
+	0xd210ee12f03dc81c, 0xacbdc0d1c50485d8, 0x66762c16a7841ea3, 0xc64bd3048c9dc6c6,
+	0x8e07de6e6467822a, 0x951838540b399f2f, 0x8a7ad9e86133ba4d, 0xf7157017d64b679c,
+	0x130dcaa5fb03cbd9, 0x4cc8029fb3252828, 0x53f83e63b4cf776a, 0xe027314fb8fa7c58,
+	0x358ab290943657a7, 0xc11921e01ab19ae4, 0x3b262313a5f2a064, 0xf1299072f184f354,
+	0x63647ecdb380340a, 0xe70ba30ddb8bbaab, 0xa98849bb3c9c54f1, 0x68a466a9fe39591d,
+	0x53beeecada39e7ff, 0x49c9cddf4d3dff4b, 0xf3e1373bd6799897, 0x33b82a884a4b5e48,
+	0x6c58990a37ff5b16, 0xb2735347832f342f, 0xb09aef6d662d7ea2, 0xf89fcd41fcd38bf9,
+	0x7c6bf96312cb4871, 0xffe32189b45f8b5f, 0xf558566da4c3d06e, 0x19eb410c9840ad98,
+	0xef403840be23e068, 0xbccf253b28d428b2, 0x9b80269bfc82fd2b, 0xb5205b753acefeeb,
+	0x000000000cf55cd6
+};
+
+/* z >= m ? */
+static int mwc_mp_geq_m(const uint64_t *z)
+{
+	int i;
+	
+	if (z[MWC_JUMP_LIMBS - 1] != MWC_A - 1)
+		return (z[MWC_JUMP_LIMBS - 1] > MWC_A - 1);
+	for (i = 0; i < MWC_JUMP_LIMBS - 1; i++)
+		if (z[i] != UINT64_MAX)
+			return 0;
+	return 1;
+}
+
+/* z = z * y mod m, for z, y < m (z and y may be the same array) */
+static void mwc_mp_mulmod(uint64_t *z, const uint64_t *y)
+{
+	uint64_t p[2 * MWC_JUMP_LIMBS], q[MWC_JUMP_LIMBS + 1];
+	uint64_t carry, r, qh, ql;
+	__uint128_t t;
+	int i, j;
+	
+	memset(p, 0, sizeof(p));
+	for (i = 0; i < MWC_JUMP_LIMBS; i++)
+	{
+		carry = 0;
+		for (j = 0; j < MWC_JUMP_LIMBS; j++)
+		{
+			t = (__uint128_t)z[i] * y[j] + p[i + j] + carry;
+			p[i + j] = (uint64_t)t;
+			carry = (uint64_t)(t >> 64);
+		}
+		p[i + MWC_JUMP_LIMBS] = carry;
+	}
+	
+	// p = H b^r + L = (q a + h) b^r + L = q + h b^r + L (mod m),
+	// dividing H = p[MWC_JUMP_LIMBS - 1 ...] by a in 32-bit digits
+	r = 0;
+	for (i = 2 * MWC_JUMP_LIMBS - 1; i >= MWC_JUMP_LIMBS - 1; i--)
+	{
+		r = (r << 32) | (p[i] >> 32);
+		qh = r / MWC_A;
+		r -= qh * MWC_A;
+		r = (r << 32) | (uint32_t)p[i];
+		ql = r / MWC_A;
+		r -= ql * MWC_A;
+		q[i - (MWC_JUMP_LIMBS - 1)] = (qh << 32) | ql;
+	}
+	memcpy(z, p, (MWC_JUMP_LIMBS - 1) * sizeof(uint64_t));
+	z[MWC_JUMP_LIMBS - 1] = r;
+	
+	// z + q < 2 m, which fits, and is reduced by subtracting m
+	carry = 0;
+	for (i = 0; i < MWC_JUMP_LIMBS; i++)
+	{
+		t = (__uint128_t)z[i] + q[i] + carry;
+		z[i] = (uint64_t)t;
+		carry = (uint64_t)(t >> 64);
+	}
+	while (mwc_mp_geq_m(z))
+	{
+		// z - m = z + 1 - a b^r
+		for (i = 0; i < MWC_JUMP_LIMBS; i++)
+			if (++z[i] != 0)
+				break;
+		z[MWC_JUMP_LIMBS - 1] -= MWC_A;
+	}
+}
+
+/* Advance MWC8222 by e steps: Z = Z * base^e mod m, where base is b^-1
+   for single steps, or s_auMWCJump for jumps. The state is left with 
+   uiStateMWC = MWC_R - 1, as after seeding. */
+static void mwc_advance(RANSTATE *pRan, const uint64_t *auBase, __uint128_t e)
+{
+	uint64_t z[MWC_JUMP_LIMBS], base[MWC_JUMP_LIMBS];
+	uint64_t r, x, carry;
+	__uint128_t t;
+	unsigned int i0, k;
+	int i;
+	
+	// Z = c + a X, with the oldest x_{n-r+1} (next to be replaced) in the
+	// least significant digit of X
+	i0 = pRan->uiStateMWC + 1;
+	carry = pRan->uiCarryMWC;
+	for (k = 0; k < MWC_R / 2; k++)
+	{
+		x = pRan->auiStateMWC[(i0 + 2 * k) & (MWC_R - 1)] |
+		    ((uint64_t)pRan->auiStateMWC[(i0 + 2 * k + 1) & (MWC_R - 1)] << 32);
+		t = (__uint128_t)MWC_A * x + carry;
+		z[k] = (uint64_t)t;
+		carry = (uint64_t)(t >> 64);
+	}
+	z[MWC_JUMP_LIMBS - 1] = carry;
+	
+	memcpy(base, auBase, sizeof(base));
+	while (e > 0)
+	{
+		if (e & 1)
+			mwc_mp_mulmod(z, base);
+		e >>= 1;
+		if (e > 0)
+			mwc_mp_mulmod(base, base);
+	}
+	
+	// X = Z div a, c = Z mod a (the upper two digits of X are zero)
+	r = 0;
+	for (i = MWC_JUMP_LIMBS - 1; i >= 0; i--)
+	{
+		r = (r << 32) | (z[i] >> 32);
+		if (i < MWC_R / 2)
+			pRan->auiStateMWC[2 * i + 1] = (uint32_t)(r / MWC_A);
+		r %= MWC_A;
+		r = (r << 32) | (uint32_t)z[i];
+		if (i < MWC_R / 2)
+			pRan->auiStateMWC[2 * i] = (uint32_t)(r / MWC_A);
+		r %= MWC_A;
+	}
+	pRan->uiCarryMWC = (uint32_t)r;
+	pRan->uiStateMWC = MWC_R - 1;
+}
 
 
 /* New-style RanSetSeed interface (single unsigned 64-bit integer seed)
@@ -1417,76 +3381,104 @@ static uint32_t s_auiStateMWC[MWC_R];
    MWC8222 needs to be initialized with 256 unsigned 32-bit integers.
    These are obtained from SplitMix64.
 */
-static void RanSetSeed_MWC8222(uint64_t uSeed)
+static void RanSetSeed_MWC8222(RANSTATE *pRan, uint64_t uSeed)
 {
-	RanSeedJump_MWC8222(uSeed, 0);
+	RanSeedJump_MWC8222(pRan, uSeed, 0);
 }
 
-/* MWC8222 does not support 'jumps'
+/* Jumps of 2^256 steps (32-bit outputs) each, see mwc_advance. The
+   'uJumps' jumps take at most 64 squarings and 64 multiplications. */
+static void RanJump_MWC8222(RANSTATE *pRan, uint64_t uJumps)
+{
+	mwc_advance(pRan, s_auMWCJump, uJumps);
+}
 
-   Here, we provide a mechanism to obtain a (radically) differently 
-   initialized MWC8222 from the same seed, but using 'uJumpsize'
-   to forward the initializing Splitmix generator.
+/* MWC8222 is seeded from SplitMix64. 'uJumpsize' forwards the 
+   initializing Splitmix64 generator by a full initialization, i.e. MWC_R
+   numbers, per jump (in constant time), as in versions before the 
+   MWC8222 jump was available, so that the streams of RanInit(.., 
+   uJumpsize) are unchanged. RanJumpRan gives non-overlapping substreams
+   of the same MWC8222 sequence instead.
    
-   There is a tiny, tiny chance that the different streams are
-   not completely independent. This should still be tested exhaustively,
-   but at present it seems the best method to obtain reproducible
-   independent streams with this generator.
-
-*/
-static void RanSeedJump_MWC8222(uint64_t uSeed, uint64_t uJumpsize)
+   When compiled with RANDOMMW_SEEDJUMP_JUMPS defined, the state is 
+   jumped ahead instead, so that RanSeedJump is RanSetSeed followed by 
+   RanJumpRan, as for the other RNGs. */
+static void RanSeedJump_MWC8222(RANSTATE *pRan, uint64_t uSeed, uint64_t uJumpsize)
 {
-	unsigned int i, j;
+	unsigned int i;
+	uint64_t uSplitmix;
 	
 	// Do not forget to (re-)initialize all state variables.
-	s_uiStateMWC = MWC_R - 1;
-	s_uiCarryMWC = MWC_C;
+	pRan->uiStateMWC = MWC_R - 1;
+	pRan->uiCarryMWC = MWC_C;
 
 	// Initialize Splitmix using uSeed
-	RanSetSeed_splitmix64(uSeed);
+	RanSetSeed_splitmix64(&uSplitmix, uSeed);
+#ifndef RANDOMMW_SEEDJUMP_JUMPS
+	// forward Splitmix64 by a full initialization, i.e. MWC_R numbers, 
+	// per jump
+	splitmix64_advance_r(&uSplitmix, MWC_R * uJumpsize);
+#endif
 	
-	// Forward Splitmix64 'uJumpsize' times a full initialization,
-	// i.e. MWC_R * uJumpsize
-	for (j = 0; j < uJumpsize; j++)
+	// Use SplitMix64 to generate the initial state for MWC8222
+	for (i = 0; i < MWC_R; ++i)
 	{
-		for (i = 0; i < MWC_R; i++)
-		{
-			U32Ran_splitmix64(); // use this for consistency
-		}
+		// get uint32 from splitmix64
+		pRan->auiStateMWC[i] = U32Ran_splitmix64(&uSplitmix);
 	}
-
-	// Use the forwarded SplitMix64 to generate the initial state for MWC8222
-	for (i = 0; i < MWC_R; ++i)
+	
+#ifdef RANDOMMW_SEEDJUMP_JUMPS
+	if (uJumpsize > 0)
 	{
-		s_auiStateMWC[i] = U32Ran_splitmix64(); // get uint32 from splitmix64
+		RanJump_MWC8222(pRan, uJumpsize);
 	}
+#endif
+}
+
+/* One 64-bit number is two steps of MWC8222 */
+static void RanAdvance_MWC8222(RANSTATE *pRan, uint64_t uSteps)
+{
+	uint64_t binv[MWC_JUMP_LIMBS] = {0};
+	
+	binv[MWC_R / 2 - 1] = MWC_A << 32;	// b^-1 = a b^(r-1)
+	mwc_advance(pRan, binv, 2 * (__uint128_t)uSteps);
 }
 
-static uint32_t U32Ran_MWC8222(void)
+static uint32_t U32Ran_MWC8222(RANSTATE *pRan)
 {
 	uint64_t t;
 
-	s_uiStateMWC = (s_uiStateMWC + 1) & (MWC_R - 1);
-	t = MWC_A * s_auiStateMWC[s_uiStateMWC] + s_uiCarryMWC;
-	s_uiCarryMWC = (uint32_t)(t >> 32);
-	s_auiStateMWC[s_uiStateMWC] = (uint32_t)t;
+	pRan->uiStateMWC = (pRan->uiStateMWC + 1) & (MWC_R - 1);
+	t = MWC_A * pRan->auiStateMWC[pRan->uiStateMWC] + pRan->uiCarryMWC;
+	pRan->uiCarryMWC = (uint32_t)(t >> 32);
+	pRan->auiStateMWC[pRan->uiStateMWC] = (uint32_t)t;
     return (uint32_t)t;
 }
 
-static double DRan_MWC8222(void)
+/* 64-bit unsigned integers from two successive 32-bit outputs of MWC8222,
+   the first one giving the upper 32 bits */
+static uint64_t U64Ran_MWC8222(RANSTATE *pRan)
+{
+	uint64_t t1;
+	
+	t1 = U32Ran_MWC8222(pRan);
+	return (t1 << 32) | U32Ran_MWC8222(pRan);
+}
+
+static double DRan_MWC8222(RANSTATE *pRan)
 /* Generate random doubles with full-precision 52-bit mantissa using MWC8222 */
 {
 	uint64_t t1, t2;
 
-	s_uiStateMWC = (s_uiStateMWC + 1) & (MWC_R - 1);
-	t1 = MWC_A * s_auiStateMWC[s_uiStateMWC] + s_uiCarryMWC;
-	s_uiCarryMWC = (uint32_t)(t1 >> 32);
-	s_auiStateMWC[s_uiStateMWC] = (uint32_t)t1;
+	pRan->uiStateMWC = (pRan->uiStateMWC + 1) & (MWC_R - 1);
+	t1 = MWC_A * pRan->auiStateMWC[pRan->uiStateMWC] + pRan->uiCarryMWC;
+	pRan->uiCarryMWC = (uint32_t)(t1 >> 32);
+	pRan->auiStateMWC[pRan->uiStateMWC] = (uint32_t)t1;
 	
-	s_uiStateMWC = (s_uiStateMWC + 1) & (MWC_R - 1);
-	t2 = MWC_A * s_auiStateMWC[s_uiStateMWC] + s_uiCarryMWC;
-	s_uiCarryMWC = (uint32_t)(t2 >> 32);
-	s_auiStateMWC[s_uiStateMWC] = (uint32_t)t2;
+	pRan->uiStateMWC = (pRan->uiStateMWC + 1) & (MWC_R - 1);
+	t2 = MWC_A * pRan->auiStateMWC[pRan->uiStateMWC] + pRan->uiCarryMWC;
+	pRan->uiCarryMWC = (uint32_t)(t2 >> 32);
+	pRan->auiStateMWC[pRan->uiStateMWC] = (uint32_t)t2;
 	
 	return RANDBL_52new(t1, t2);
 }
@@ -1495,103 +3487,347 @@ static double DRan_MWC8222(void)
 
 /*------------------- uniform random number generators ----------------------*/
 
-/* Set default to MWC8222 uniform generator 
-   (doubles with 52 bits mantissa randomness) */
-static DRANFUN s_fnDRanu = DRan_MWC8222;
-static U32RANFUN s_fnU32Ranu = U32Ran_MWC8222;
-static RANSETSEEDFUN s_fnRanSetSeed = RanSetSeed_MWC8222;
-static RANJUMPFUN s_fnRanJump = NULL;
-static RANSEEDJUMPFUN s_fnRanSeedJump = RanSeedJump_MWC8222;
+/* External uniform RNG, set by RanSetRanExt (default generator only) */
+static double DRan_ext(RANSTATE *pRan)
+{
+	return (*pRan->fnDRanExt)();
+}
 
-double  DRanU(void)
+static uint32_t U32Ran_ext(RANSTATE *pRan)
 {
-    return (*s_fnDRanu)();
+	return (*pRan->fnU32RanExt)();
 }
 
-uint32_t U32RanU(void)
+static uint64_t U64Ran_ext(RANSTATE *pRan)
+{
+	uint64_t t1;
+	
+	t1 = (*pRan->fnU32RanExt)();
+	return (t1 << 32) | (*pRan->fnU32RanExt)();
+}
+
+static void RanSetSeed_ext(RANSTATE *pRan, uint64_t uSeed)
 {
-    return (*s_fnU32Ranu)();
+	(*pRan->fnRanSetSeedExt)(uSeed);
 }
 
-void    RanSetSeed(uint64_t uSeed)
+static void RanJump_ext(RANSTATE *pRan, uint64_t uJumpsize)
 {
-	(*s_fnRanSetSeed)(uSeed);
+	(*pRan->fnRanJumpExt)(uJumpsize);
 }
 
-/* Direct jumps currently only supported by Xoshiro256+ and MELG19937.
+static void RanSeedJump_ext(RANSTATE *pRan, uint64_t uSeed, uint64_t uJumpsize)
+{
+	(*pRan->fnRanSeedJumpExt)(uSeed, uJumpsize);
+}
 
-   Calling RanJumpRan for other generators will crash your program!
-*/
-void    RanJumpRan(uint64_t uJumpsize)
+
+double  DRanU_r(RANSTATE *pRan)
+{
+    return (*pRan->fnDRanu)(pRan);
+}
+
+uint32_t U32RanU_r(RANSTATE *pRan)
+{
+    return (*pRan->fnU32Ranu)(pRan);
+}
+
+uint64_t U64RanU_r(RANSTATE *pRan)
+{
+    return (*pRan->fnU64Ranu)(pRan);
+}
+
+/* Single precision uses both halves of each 64-bit number of fnU64Ran: 
+   the upper 32 bits first, then the lower 32 bits, which are kept in the
+   generator state until the next call. For MWC8222, these are two 
+   successive 32-bit outputs. */
+static inline __attribute__((always_inline)) 
+uint32_t U32RanHalf_inline(RANSTATE *pRan, U64RANFUN_R fnU64Ran)
+{
+	uint64_t w;
+	
+	if (pRan->bHalf)
+	{
+		pRan->bHalf = 0;
+		return pRan->uiHalf;
+	}
+	w = fnU64Ran(pRan);
+	pRan->uiHalf = (uint32_t)w;
+	pRan->bHalf = 1;
+	return (uint32_t)(w >> 32);
+}
+
+/* Uniform float in (0, 1), from the upper 24 bits of a 32-bit half */
+static inline __attribute__((always_inline)) 
+float   FRan_inline(RANSTATE *pRan, U64RANFUN_R fnU64Ran)
 {
-	(*s_fnRanJump)(uJumpsize);
+	uint32_t xx;
+	
+	while ((xx = (U32RanHalf_inline(pRan, fnU64Ran) >> 8)) == 0)
+		;
+	
+	return (xx * 0x1.0p-24f);
+}
+
+float   FRanU_r(RANSTATE *pRan)
+{
+	return FRan_inline(pRan, pRan->fnU64Ranu);
+}
+
+void    RanSetSeed_r(RANSTATE *pRan, uint64_t uSeed)
+{
+	RanAsyncEnd(pRan);
+	pRan->bHalf = 0;
+	(*pRan->fnRanSetSeed)(pRan, uSeed);
+}
+
+/* Direct jumps are supported by all built-in RNGs. For an external RNG
+   (RanSetRanExt), the RanJumpFun provided by the user is called. */
+void    RanJumpRan_r(RANSTATE *pRan, uint64_t uJumpsize)
+{
+	RanAsyncEnd(pRan);
+	pRan->bHalf = 0;
+	(*pRan->fnRanJump)(pRan, uJumpsize);
 }
 
 /* Combined setting of random seed and 'jumping'
 
-   This provides a way to emulate jumps for PRNG that do not support
-   RanJumpRan, by initializing the PRNG using numbers further on
-   in the sequence of initialization random numbers from
-   Splitmix64.
+   For the built-in RNGs, this is RanSetSeed followed by RanJumpRan, 
+   except for MWC8222 and Lehmer64, which keep the streams of earlier 
+   versions by forwarding their initializing Splitmix64 generator, unless
+   compiled with RANDOMMW_SEEDJUMP_JUMPS defined. An external RNG 
+   (RanSetRanExt) may emulate jumps in its RanSeedJumpFun, e.g. by 
+   initializing the RNG using numbers further on in the sequence of 
+   initialization random numbers.
 */
-void	RanSeedJump(uint64_t uSeed, uint64_t uJumpsize)
+void	RanSeedJump_r(RANSTATE *pRan, uint64_t uSeed, uint64_t uJumpsize)
+{
+	RanAsyncEnd(pRan);
+	pRan->bHalf = 0;
+	(*pRan->fnRanSeedJump)(pRan, uSeed, uJumpsize);
+}
+
+/* Generic advance, for RNGs without an algorithmic one: discard uSteps
+   64-bit numbers, which takes a time proportional to uSteps */
+static void RanAdvance_discard(RANSTATE *pRan, uint64_t uSteps)
 {
-	(*s_fnRanSeedJump)(uSeed, uJumpsize);
+	uint64_t i;
+	
+	for (i = 0; i < uSteps; i++)
+		(*pRan->fnU64Ranu)(pRan);
+}
+
+/* Advance the generator by uSteps steps, i.e. to the state obtained 
+   after uSteps calls of U64RanU. This is done in O(log(uSteps)) time
+   for MWC8222, Lehmer64 and PCG64DXSM, in O(1) for Philox4x32-10, and by
+   discarding numbers for the other RNGs. A pending 32-bit half (FRanU, FRanNormalZig) is discarded. */
+void    RanAdvanceRan_r(RANSTATE *pRan, uint64_t uSteps)
+{
+	RanAsyncEnd(pRan);
+	pRan->bHalf = 0;
+	(*pRan->fnRanAdvance)(pRan, uSteps);
 }
 
 
-void    RanSetRan(const char *sRan)
+/* Select the uniform RNG. May be called on an uninitialized RANSTATE, 
+   before RanSetSeed_r (as RanInit_r). */
+void    RanSetRan_r(RANSTATE *pRan, const char *sRan)
 {
+	RanAsyncEndOwner(pRan);
 	/* BEGIN if ... else if ... else block */
 	if (strcmp(sRan, "MWC8222") == 0)
 	{
-		s_fnDRanu = DRan_MWC8222;
-		s_fnU32Ranu = U32Ran_MWC8222;
-		s_fnRanSetSeed = RanSetSeed_MWC8222;
-		s_fnRanJump = NULL;
-		s_fnRanSeedJump = RanSeedJump_MWC8222;
+		pRan->fnDRanu = DRan_MWC8222;
+		pRan->fnU32Ranu = U32Ran_MWC8222;
+		pRan->fnRanSetSeed = RanSetSeed_MWC8222;
+		pRan->fnRanJump = RanJump_MWC8222;
+		pRan->fnRanSeedJump = RanSeedJump_MWC8222;
+		pRan->fnU64Ranu = U64Ran_MWC8222;
+		pRan->fnRanAdvance = RanAdvance_MWC8222;
+		pRan->fnDRanuVec = DRanUVec_MWC8222;
+		pRan->fnU32RanuVec = U32RanUVec_MWC8222;
+		pRan->fnU64RanuVec = U64RanUVec_MWC8222;
+		pRan->fnDRanNormalZigVec = DRanNormalZigVec_MWC8222;
+		pRan->fnFRanuVec = FRanUVec_MWC8222;
+		pRan->fnFRanNormalZigVec = FRanNormalZigVec_MWC8222;
 	}
 	else if (strcmp(sRan, "Lehmer64") == 0)
 	{
-		s_fnDRanu = DRan_lehmer64;
-		s_fnU32Ranu = U32Ran_lehmer64;
-		s_fnRanSetSeed = RanSetSeed_lehmer64;
-		s_fnRanJump = NULL;
-		s_fnRanSeedJump = RanSeedJump_lehmer64;
+		pRan->fnDRanu = DRan_lehmer64;
+		pRan->fnU32Ranu = U32Ran_lehmer64;
+		pRan->fnRanSetSeed = RanSetSeed_lehmer64;
+		pRan->fnRanJump = RanJump_lehmer64;
+		pRan->fnRanSeedJump = RanSeedJump_lehmer64;
+		pRan->fnU64Ranu = U64Ran_lehmer64;
+		pRan->fnRanAdvance = RanAdvance_lehmer64;
+		pRan->fnDRanuVec = DRanUVec_lehmer64;
+		pRan->fnU32RanuVec = U32RanUVec_lehmer64;
+		pRan->fnU64RanuVec = U64RanUVec_lehmer64;
+		pRan->fnDRanNormalZigVec = DRanNormalZigVec_lehmer64;
+		pRan->fnFRanuVec = FRanUVec_lehmer64;
+		pRan->fnFRanNormalZigVec = FRanNormalZigVec_lehmer64;
 	}
 	else if (strcmp(sRan, "PCG64DXSM") == 0)
 	{
-		s_fnDRanu = DRan_pcg64dxsm;
-		s_fnU32Ranu = U32Ran_pcg64dxsm;
-		s_fnRanSetSeed = RanSetSeed_pcg64dxsm;
-		s_fnRanJump = RanJump_pcg64dxsm;
-		s_fnRanSeedJump = RanSeedJump_pcg64dxsm;
+		pRan->fnDRanu = DRan_pcg64dxsm;
+		pRan->fnU32Ranu = U32Ran_pcg64dxsm;
+		pRan->fnRanSetSeed = RanSetSeed_pcg64dxsm;
+		pRan->fnRanJump = RanJump_pcg64dxsm;
+		pRan->fnRanSeedJump = RanSeedJump_pcg64dxsm;
+		pRan->fnU64Ranu = U64Ran_pcg64dxsm;
+		pRan->fnRanAdvance = RanAdvance_pcg64dxsm;
+		pRan->fnDRanuVec = DRanUVec_pcg64dxsm;
+		pRan->fnU32RanuVec = U32RanUVec_pcg64dxsm;
+		pRan->fnU64RanuVec = U64RanUVec_pcg64dxsm;
+		pRan->fnDRanNormalZigVec = DRanNormalZigVec_pcg64dxsm;
+		pRan->fnFRanuVec = FRanUVec_pcg64dxsm;
+		pRan->fnFRanNormalZigVec = FRanNormalZigVec_pcg64dxsm;
 	}
 	else if (strcmp(sRan, "Xoshiro256+") == 0)
 	{
-		s_fnDRanu = DRan_xoshiro256p;
-		s_fnU32Ranu = U32Ran_xoshiro256p;
-		s_fnRanSetSeed = RanSetSeed_xoshiro256p;
-		s_fnRanJump = RanJump_xoshiro256p;
-		s_fnRanSeedJump = RanSeedJump_xoshiro256p;
+		pRan->fnDRanu = DRan_xoshiro256p;
+		pRan->fnU32Ranu = U32Ran_xoshiro256p;
+		pRan->fnRanSetSeed = RanSetSeed_xoshiro256p;
+		pRan->fnRanJump = RanJump_xoshiro256p;
+		pRan->fnRanSeedJump = RanSeedJump_xoshiro256p;
+		pRan->fnU64Ranu = U64Ran_xoshiro256p;
+		pRan->fnRanAdvance = RanAdvance_discard;
+		pRan->fnDRanuVec = DRanUVec_xoshiro256p;
+		pRan->fnU32RanuVec = U32RanUVec_xoshiro256p;
+		pRan->fnU64RanuVec = U64RanUVec_xoshiro256p;
+		pRan->fnDRanNormalZigVec = DRanNormalZigVec_xoshiro256p;
+		pRan->fnFRanuVec = FRanUVec_xoshiro256p;
+		pRan->fnFRanNormalZigVec = FRanNormalZigVec_xoshiro256p;
+	}
+	else if (strcmp(sRan, "Xoshiro256+x4") == 0)
+	{
+		pRan->fnDRanu = DRan_xoshiro256px;
+		pRan->fnU32Ranu = U32Ran_xoshiro256px;
+		pRan->fnRanSetSeed = RanSetSeed_xoshiro256px4;
+		pRan->fnRanJump = RanJump_xoshiro256px;
+		pRan->fnRanSeedJump = RanSeedJump_xoshiro256px4;
+		pRan->fnU64Ranu = U64Ran_xoshiro256px;
+		pRan->fnRanAdvance = RanAdvance_discard;
+		pRan->fnDRanuVec = DRanUVec_xoshiro256px;
+		pRan->fnU32RanuVec = U32RanUVec_xoshiro256px;
+		pRan->fnU64RanuVec = U64RanUVec_xoshiro256px;
+		pRan->fnDRanNormalZigVec = DRanNormalZigVec_xoshiro256px;
+		pRan->fnFRanuVec = FRanUVec_xoshiro256px;
+		pRan->fnFRanNormalZigVec = FRanNormalZigVec_xoshiro256px;
+	}
+	else if (strcmp(sRan, "Xoshiro256+x8") == 0)
+	{
+		pRan->fnDRanu = DRan_xoshiro256px;
+		pRan->fnU32Ranu = U32Ran_xoshiro256px;
+		pRan->fnRanSetSeed = RanSetSeed_xoshiro256px8;
+		pRan->fnRanJump = RanJump_xoshiro256px;
+		pRan->fnRanSeedJump = RanSeedJump_xoshiro256px8;
+		pRan->fnU64Ranu = U64Ran_xoshiro256px;
+		pRan->fnRanAdvance = RanAdvance_discard;
+		pRan->fnDRanuVec = DRanUVec_xoshiro256px;
+		pRan->fnU32RanuVec = U32RanUVec_xoshiro256px;
+		pRan->fnU64RanuVec = U64RanUVec_xoshiro256px;
+		pRan->fnDRanNormalZigVec = DRanNormalZigVec_xoshiro256px;
+		pRan->fnFRanuVec = FRanUVec_xoshiro256px;
+		pRan->fnFRanNormalZigVec = FRanNormalZigVec_xoshiro256px;
 	}
 	else if (strcmp(sRan, "MELG19937") == 0)
 	{
-		s_fnDRanu = DRan_MELG19937;
-		s_fnU32Ranu = U32Ran_MELG19937;
-		s_fnRanSetSeed = RanSetSeed_MELG19937;
-		s_fnRanJump = RanJump_MELG19937;
-		s_fnRanSeedJump = RanSeedJump_MELG19937;	
+		pRan->fnDRanu = DRan_MELG19937;
+		pRan->fnU32Ranu = U32Ran_MELG19937;
+		pRan->fnRanSetSeed = RanSetSeed_MELG19937;
+		pRan->fnRanJump = RanJump_MELG19937;
+		pRan->fnRanSeedJump = RanSeedJump_MELG19937;	
+		pRan->fnU64Ranu = U64Ran_MELG19937;
+		pRan->fnRanAdvance = RanAdvance_discard;
+		pRan->fnDRanuVec = DRanUVec_MELG19937;
+		pRan->fnU32RanuVec = U32RanUVec_MELG19937;
+		pRan->fnU64RanuVec = U64RanUVec_MELG19937;
+		pRan->fnDRanNormalZigVec = DRanNormalZigVec_MELG19937;
+		pRan->fnFRanuVec = FRanUVec_MELG19937;
+		pRan->fnFRanNormalZigVec = FRanNormalZigVec_MELG19937;
+	}
+	else if (strcmp(sRan, "Philox4x32-10") == 0)
+	{
+		pRan->fnDRanu = DRan_philox4x32;
+		pRan->fnU32Ranu = U32Ran_philox4x32;
+		pRan->fnRanSetSeed = RanSetSeed_philox4x32;
+		pRan->fnRanJump = RanJump_philox4x32;
+		pRan->fnRanSeedJump = RanSeedJump_philox4x32;
+		pRan->fnU64Ranu = U64Ran_philox4x32;
+		pRan->fnRanAdvance = RanAdvance_philox4x32;
+		pRan->fnDRanuVec = DRanUVec_philox4x32;
+		pRan->fnU32RanuVec = U32RanUVec_philox4x32;
+		pRan->fnU64RanuVec = U64RanUVec_philox4x32;
+		pRan->fnDRanNormalZigVec = DRanNormalZigVec_philox4x32;
+		pRan->fnFRanuVec = FRanUVec_philox4x32;
+		pRan->fnFRanNormalZigVec = FRanNormalZigVec_philox4x32;
 	}
 	else // DEFAULT = FAULT
 	{
-		s_fnDRanu = NULL;
-		s_fnU32Ranu = NULL;
-		s_fnRanSetSeed = NULL;
-		s_fnRanJump = NULL;
-		s_fnRanSeedJump = NULL;
+		pRan->fnDRanu = NULL;
+		pRan->fnU32Ranu = NULL;
+		pRan->fnRanSetSeed = NULL;
+		pRan->fnRanJump = NULL;
+		pRan->fnRanSeedJump = NULL;
+		pRan->fnU64Ranu = NULL;
+		pRan->fnRanAdvance = NULL;
+		pRan->fnDRanuVec = NULL;
+		pRan->fnU32RanuVec = NULL;
+		pRan->fnU64RanuVec = NULL;
+		pRan->fnDRanNormalZigVec = NULL;
+		pRan->fnFRanuVec = NULL;
+		pRan->fnFRanNormalZigVec = NULL;
 	}
 	/* END if ... else if ... else block */
+	pRan->bHalf = 0;
+}
+
+
+/* Non-reentrant interface, using the default generator state */
+double  DRanU(void)
+{
+    return DRanU_r(&s_ranDefault);
+}
+
+uint32_t U32RanU(void)
+{
+    return U32RanU_r(&s_ranDefault);
+}
+
+uint64_t U64RanU(void)
+{
+    return U64RanU_r(&s_ranDefault);
+}
+
+float   FRanU(void)
+{
+    return FRanU_r(&s_ranDefault);
+}
+
+void    RanSetSeed(uint64_t uSeed)
+{
+	RanSetSeed_r(&s_ranDefault, uSeed);
+}
+
+void    RanJumpRan(uint64_t uJumpsize)
+{
+	RanJumpRan_r(&s_ranDefault, uJumpsize);
+}
+
+void	RanSeedJump(uint64_t uSeed, uint64_t uJumpsize)
+{
+	RanSeedJump_r(&s_ranDefault, uSeed, uJumpsize);
+}
+
+void    RanAdvanceRan(uint64_t uSteps)
+{
+	RanAdvanceRan_r(&s_ranDefault, uSteps);
+}
+
+void    RanSetRan(const char *sRan)
+{
+	RanSetRan_r(&s_ranDefault, sRan);
 }
 
 
@@ -1599,11 +3835,27 @@ void    RanSetRanExt(DRANFUN DRanFun, U32RANFUN U32RanFun,
 		             RANSETSEEDFUN RanSetSeedFun, RANJUMPFUN RanJumpFun,
 					 RANSEEDJUMPFUN RanSeedJumpFun)
 {
-	s_fnDRanu = DRanFun;
-	s_fnU32Ranu = U32RanFun;
-	s_fnRanSetSeed = RanSetSeedFun;
-	s_fnRanJump = RanJumpFun;
-	s_fnRanSeedJump = RanSeedJumpFun;
+	RanAsyncEnd(&s_ranDefault);
+	s_ranDefault.fnDRanExt = DRanFun;
+	s_ranDefault.fnU32RanExt = U32RanFun;
+	s_ranDefault.fnRanSetSeedExt = RanSetSeedFun;
+	s_ranDefault.fnRanJumpExt = RanJumpFun;
+	s_ranDefault.fnRanSeedJumpExt = RanSeedJumpFun;
+	
+	s_ranDefault.fnDRanu = DRan_ext;
+	s_ranDefault.fnU32Ranu = U32Ran_ext;
+	s_ranDefault.fnRanSetSeed = RanSetSeed_ext;
+	s_ranDefault.fnRanJump = RanJump_ext;
+	s_ranDefault.fnRanSeedJump = RanSeedJump_ext;
+	s_ranDefault.fnU64Ranu = U64Ran_ext;
+	s_ranDefault.fnRanAdvance = RanAdvance_discard;
+	s_ranDefault.fnDRanuVec = DRanUVec_ext;
+	s_ranDefault.fnU32RanuVec = U32RanUVec_ext;
+	s_ranDefault.fnU64RanuVec = U64RanUVec_ext;
+	s_ranDefault.fnDRanNormalZigVec = DRanNormalZigVec_ext;
+	s_ranDefault.fnFRanuVec = FRanUVec_ext;
+	s_ranDefault.fnFRanNormalZigVec = FRanNormalZigVec_ext;
+	s_ranDefault.bHalf = 0;
 }
 /*---------------- END uniform random number generators --------------------*/
 
@@ -1631,13 +3883,65 @@ void    RanSetRanExt(DRANFUN DRanFun, U32RANFUN U32RanFun,
  *==========================================================================*/
 
 
+/*------------------------ Ziggurat instrumentation ------------------------
+ *  M. H. V. Werts, 2025
+ *
+ *  When compiled with RANDOMMW_ZIGSTATS defined, every RANSTATE counts the
+ *  paths taken through the ziggurat, and the uniform random numbers drawn
+ *  by it (not those drawn directly by the user with DRanU etc.). This gives
+ *  the number of uniform draws per normal variate, and the frequency of
+ *  the expensive wedge (exp) and tail (log) paths. Counters are per 
+ *  RANSTATE, and therefore per thread if each thread has its own state.
+ *  Without RANDOMMW_ZIGSTATS, the counting macros are empty.
+ *--------------------------------------------------------------------------*/
+#ifdef RANDOMMW_ZIGSTATS
+#define ZIGSTATS_ADD(pRan, field, n)  ((pRan)->zigstats.field += (n))
+#else
+#define ZIGSTATS_ADD(pRan, field, n)  ((void)0)
+#endif
+
+void	RanZigStatsGet_r(const RANSTATE *pRan, RANZIGSTATS *pStats)
+{
+#ifdef RANDOMMW_ZIGSTATS
+	*pStats = pRan->zigstats;
+#else
+	(void)pRan;
+	memset(pStats, 0, sizeof(*pStats));
+#endif
+}
+
+void	RanZigStatsReset_r(RANSTATE *pRan)
+{
+#ifdef RANDOMMW_ZIGSTATS
+	memset(&pRan->zigstats, 0, sizeof(pRan->zigstats));
+#else
+	(void)pRan;
+#endif
+}
+
+void	RanZigStatsGet(RANZIGSTATS *pStats)
+{
+	RanZigStatsGet_r(&s_ranDefault, pStats);
+}
+
+void	RanZigStatsReset(void)
+{
+	RanZigStatsReset_r(&s_ranDefault);
+}
+/*--------------------- END Ziggurat instrumentation -----------------------*/
+
+
 /*------------------------------ General Ziggurat --------------------------*/
-static double DRanNormalTail(double dMin, int iNegative)
+static double DRanNormalTail(RANSTATE *pRan, DRANFUN_R fnDRan, double dMin,
+                             int iNegative)
 {
 	double x, y;
+	ZIGSTATS_ADD(pRan, uTail, 1);
 	do
-	{	x = log(DRanU()) / dMin;
-		y = log(DRanU());
+	{	x = log(fnDRan(pRan)) / dMin;
+		y = log(fnDRan(pRan));
+		ZIGSTATS_ADD(pRan, uTailIter, 1);
+		ZIGSTATS_ADD(pRan, uDRan, 2);
 	} while (-2 * y < x * x);
 	return iNegative ? x - dMin : dMin - x;
 }
@@ -1647,184 +3951,3436 @@ static double DRanNormalTail(double dMin, int iNegative)
 				   /* (R * phi(R) + Pr(X>=R)) * sqrt(2\pi) */
 #define ZIGNOR_V 9.91256303526217e-3
 
+/* exponential ziggurat */
+#define ZIGEXP_C 256			       /* number of blocks */
+#define ZIGEXP_R 7.69711747013104972	/* start of the right tail */
+				   /* R * f(R) + Pr(X>=R) = (R + 1) * exp(-R) */
+#define ZIGEXP_V 3.949659822581572e-3
+
+/* McFarland's modified ziggurat */
+#define ZIGMF_L 253				/* number of rectangles */
+#define ZIGMF_R 3.6360066255009455	/* start of the right tail */
+
+/* The tables of the normal, exponential and McFarland ziggurats are 
+   constant data, computed from the parameters above by the program
+   genzigtables.c, and aligned to 64-byte cache lines. No initialization
+   is needed, and the tables are shared read-only by all generator states.
+   After changing a parameter, replace the block below by the output of 
+   genzigtables; 'genzigtables -c' checks the tables against the 
+   computation. */
+/*------------- BEGIN generated by genzigtables.c, do not edit -------------*/
 /* s_adZigX holds coordinates, such that each rectangle has*/
 /* same area; s_adZigR holds s_adZigX[i + 1] / s_adZigX[i] */
-static double s_adZigX[ZIGNOR_C + 1], s_adZigR[ZIGNOR_C];
+/* s_adZigF holds the density exp(-x^2/2) at s_adZigX[i]   */
+static const double s_adZigX[ZIGNOR_C + 1] __attribute__((aligned(64))) = {
+	3.7130862467425505, 3.4426198558990002, 3.2230849845811416,
+	3.0832288582168683, 2.9786962526477803, 2.8943440070215289,
+	2.8231253505489105, 2.7611693723871769, 2.7061135731218195,
+	2.6564064112613597, 2.6109722484318474, 2.5690336259249378,
+	2.5300096723888275, 2.4934545220953721, 2.4590181774118305,
+	2.4264206455337498, 2.3954342780110625, 2.3658713701176386,
+	2.3375752413392368, 2.310413683698763, 2.2842740596774718,
+	2.2590595738691985, 2.2346863955909795, 2.2110814088787034,
+	2.1881804320760492, 2.1659267937489219, 2.1442701823603953,
+	2.1231657086739766, 2.1025731351892385, 2.0824562379920168,
+	2.0627822745083084, 2.0435215366550676, 2.0246469733773855,
+	2.0061338699634721, 1.9879595741276199, 1.9701032608543265,
+	1.9525457295535567, 1.9352692282966228, 1.9182573008645099,
+	1.9014946531051511, 1.884967035707759, 1.8686611409944887,
+	1.8525645117280911, 1.836665460258446, 1.8209529965961255,
+	1.8054167642192285, 1.7900469825998586, 1.7748343955860695,
+	1.7597702248995934, 1.7448461281138004, 1.7300541605637305,
+	1.7153867407136676, 1.7008366185699169, 1.6863968467791681,
+	1.6720607540976009, 1.6578219209540241, 1.6436741568628686,
+	1.6296114794706347, 1.615628095043161, 1.6017183802213781,
+	1.5878768648905761, 1.5740982160230008, 1.5603772223661689,
+	1.5467087798599104, 1.5330878776740433, 1.5195095847659401,
+	1.5059690368632033, 1.492461423781354, 1.4789819769899242,
+	1.4655259573427108, 1.4520886428892246, 1.4386653166845635,
+	1.4252512545140601, 1.4118417124470577, 1.3984319141310053,
+	1.3850170377326518, 1.3715922024273426, 1.3581524543301435,
+	1.344692751753547, 1.3312079496656273, 1.3176927832094141,
+	1.3041418501286168, 1.2905495919261964, 1.2769102735601556,
+	1.2632179614546211, 1.2494664995730682, 1.2356494832633627,
+	1.2217602305399964, 1.2077917504159497, 1.1937367078331287,
+	1.1795873846639882, 1.1653356361647524, 1.1509728421488674,
+	1.1364898520131608, 1.1218769225825422, 1.107123647534036,
+	1.0922188769072774, 1.0771506248928957, 1.0619059636948243,
+	1.0464709007640454, 1.0308302360681956, 1.0149673952513305,
+	0.99886423349298359, 0.98250080351542901, 0.9658550794011499,
+	0.94890262551130644, 0.93161619661515083, 0.91396525102303228,
+	0.89591535258093769, 0.87742742911292337, 0.85845684319381321,
+	0.83895221429757738, 0.81885390670035729, 0.79809206064405691,
+	0.77658398789475991, 0.75423066445405562, 0.73091191064248884,
+	0.70647961133543646, 0.68074791866915463, 0.65347863873997525,
+	0.6243585973360507, 0.59296294247144832, 0.55869217840818519,
+	0.52065603876206057, 0.47743783729668982, 0.42654798635542351,
+	0.36287143109703196, 0.27232086481396467, 0
+};
+static const double s_adZigR[ZIGNOR_C] __attribute__((aligned(64))) = {
+	0.92715860260966809, 0.93623028957388921, 0.95660799295292287,
+	0.96609638454488822, 0.97168148798278098, 0.97539385218210217,
+	0.97805411716851776, 0.98006069464048895, 0.98163153152396454,
+	0.98289638112718658, 0.98393754566633251, 0.98480987047335344,
+	0.98555137923289438, 0.98618930308197361, 0.98674367998678636,
+	0.98722959781119435, 0.98765864371032963, 0.98803987015701755,
+	0.98838045631210891, 0.98868617156930783, 0.98896170724285448,
+	0.98921091831302443, 0.98943700254369094, 0.98964263517811046,
+	0.98983007159696879, 0.99000122651835243, 0.99015773578346966,
+	0.99030100505080254, 0.99043224853369438, 0.99055252008432182,
+	0.99066273833585672, 0.99076370718921958, 0.99085613262097194,
+	0.99094063656071807, 0.99101776841657896, 0.99108801469971874,
+	0.99115180710216499, 0.99120952930818496, 0.99126152276245516,
+	0.99130809157396138, 0.99134950669991539, 0.99138600952667588,
+	0.9914178149430195, 0.99144511398384472, 0.99146807610853294,
+	0.99148685116701207, 0.99150157109748349, 0.9915123513923666,
+	0.99151929236293068, 0.99152248022806455, 0.99152198804846459,
+	0.99151787652404422, 0.99151019466943868, 0.99149898038000517,
+	0.99148426089860509, 0.9914660531916395, 0.99144436424122284,
+	0.99141919125900113, 0.99139052182587151, 0.99135833396074968,
+	0.99132259612049656, 0.99128326713214987, 0.9912402960576856,
+	0.991193621990624, 0.99114317378289896, 0.99108886969948096,
+	0.99103061699728945, 0.99096831142390407, 0.99090183663049125,
+	0.99083106349214667, 0.9907558493275227, 0.99067603700809548,
+	0.99059145394572945, 0.99050191094523621, 0.99040720090638834,
+	0.99030709735723799, 0.99020135279756305, 0.99008969682771364,
+	0.98997183403395694, 0.98984744159647786, 0.98971616658035255,
+	0.98957762286281981, 0.98943138764184679, 0.98927699746094222,
+	0.98911394367309524, 0.9889416672520418, 0.98875955284124373,
+	0.98856692190915973, 0.98836302485260341, 0.98814703185694575,
+	0.98791802228090508, 0.98767497228253098, 0.98741674033883642,
+	0.98714205023059953, 0.98684947096108866, 0.98653739294616549,
+	0.98620399964423899, 0.98584723357553894, 0.98546475539408995,
+	0.98505389429899071, 0.98461158757103473, 0.98413430634945731,
+	0.98361796385447464, 0.98305780101683371, 0.98244824275257281,
+	0.98178271570611264, 0.98105341485447561, 0.98025100142276667,
+	0.97936420732745055, 0.97837931059633121, 0.97727942988529215,
+	0.97604356093863154, 0.97464523783007639, 0.97305063687522453,
+	0.97121583268629852, 0.9690827290502092, 0.96657285378538182,
+	0.96357758631187951, 0.95994217656590097, 0.95543841882869618,
+	0.94971534788091627, 0.9422042060159378, 0.93191932674895062,
+	0.91699279707169312, 0.89341051972459762, 0.85071654937943442,
+	0.75046102138899429, 0
+};
+static const double s_adZigF[ZIGNOR_C + 1] __attribute__((aligned(64))) = {
+	0.0010143525641203774, 0.0026696290838809228, 0.0055489952207713449,
+	0.0086244844128598851, 0.011839478657884862, 0.015167298010546568,
+	0.018592102737011288, 0.022103304615927098, 0.025693291935934271,
+	0.02935631744000685, 0.033087886146225751, 0.036884388786656203,
+	0.040742868074444175, 0.044660862200491425, 0.048636295859867805,
+	0.052667401903051012, 0.056752663481049848, 0.060890770348040406,
+	0.065080585213068073, 0.069321117393577908, 0.073611501884113403,
+	0.077950982513973394, 0.082338898242235656, 0.086774671894780178,
+	0.091257800826830257, 0.095787849121731439, 0.10036444102865587,
+	0.10498725540942132, 0.10965602101484027, 0.11437051244886601,
+	0.11913054670765083, 0.12393598020286782, 0.12878670619594321,
+	0.13368265258343937, 0.1386237799845946, 0.14361008009062776,
+	0.14864157424234226, 0.15371831220818166, 0.1588403711394793,
+	0.16400785468342038, 0.169220892237365, 0.1744796383307895,
+	0.17978427212329545, 0.18513499700899219, 0.19053204031913715,
+	0.19597565311627774, 0.20146611007431367, 0.20700370943992652,
+	0.2125887730717303, 0.2182216465543054, 0.22390269938500842,
+	0.22963232523211613, 0.23541094226347908, 0.24123899354543982,
+	0.24711694751232141, 0.25304529850732577, 0.25902456739620483,
+	0.26505530225558921, 0.27113807913838461, 0.27727350291918812,
+	0.28346220822323298, 0.28970486044295984, 0.29600215684693298,
+	0.30235482778648354, 0.30876363800618112, 0.31522938806501088,
+	0.32175291587598492, 0.3283350983728503, 0.33497685331358917,
+	0.34167914123155041, 0.34844296754632659, 0.35526938484791709,
+	0.36215949536931757, 0.36911445366447221, 0.37613546951056259,
+	0.3832238110559012, 0.39038080823731458, 0.39760785649387331,
+	0.40490642080722294, 0.412278040102661, 0.41972433204957438,
+	0.42724699830499607, 0.43484783024999091, 0.44252871527546844,
+	0.45029164368203922, 0.45813871626787206, 0.46607215268945612,
+	0.47409430069301695, 0.48220764632948521, 0.49041482528384411,
+	0.4987186354709795, 0.50712205107556896, 0.51562823824400184,
+	0.52424057267298407, 0.53296265938383613, 0.5417983550254255,
+	0.55075179311460454, 0.55982741270408687, 0.56902999106795094,
+	0.57836468111976314, 0.58783705443470657, 0.59745315094451668,
+	0.60721953662512029, 0.61714337081888093, 0.62723248524992725,
+	0.6374954773350423, 0.64794182111022247, 0.65858200005008805,
+	0.66942766734889037, 0.68049184099733406, 0.69178914343667508,
+	0.70333609901615812, 0.7151515074104986, 0.72725691834418482,
+	0.73967724367264731, 0.75244155917461142, 0.7655841738977045,
+	0.7791460859296877, 0.79317701177130506, 0.80773829468296054,
+	0.82290721138140899, 0.83878360529598961, 0.85550060786945059,
+	0.87324304891006954, 0.8922816507840261, 0.9130436479717402,
+	0.93628268168505957, 0.96359969312708615, 1
+};
+
+/* single precision: s_adZigX, s_adZigR and s_adZigF as floats */
+static const float s_afZigX[ZIGNOR_C + 1] __attribute__((aligned(64))) = {
+	3.71308613f, 3.4426198f, 3.22308493f, 3.08322883f,
+	2.97869635f, 2.89434409f, 2.82312536f, 2.76116943f,
+	2.70611358f, 2.6564064f, 2.61097217f, 2.56903362f,
+	2.53000975f, 2.49345446f, 2.45901823f, 2.42642069f,
+	2.39543438f, 2.36587143f, 2.3375752f, 2.3104136f,
+	2.2842741f, 2.25905967f, 2.23468637f, 2.2110815f,
+	2.18818045f, 2.16592669f, 2.14427018f, 2.12316561f,
+	2.10257316f, 2.08245635f, 2.06278229f, 2.04352164f,
+	2.024647f, 2.00613379f, 1.98795962f, 1.97010326f,
+	1.95254576f, 1.93526924f, 1.91825736f, 1.90149462f,
+	1.88496709f, 1.86866117f, 1.85256445f, 1.83666551f,
+	1.82095301f, 1.80541682f, 1.79004693f, 1.77483439f,
+	1.75977027f, 1.74484611f, 1.73005414f, 1.71538675f,
+	1.70083666f, 1.68639684f, 1.67206073f, 1.65782189f,
+	1.64367414f, 1.62961149f, 1.61562812f, 1.60171843f,
+	1.58787692f, 1.57409823f, 1.56037724f, 1.54670882f,
+	1.53308785f, 1.51950955f, 1.50596905f, 1.49246144f,
+	1.47898197f, 1.46552598f, 1.45208859f, 1.43866527f,
+	1.42525125f, 1.41184175f, 1.3984319f, 1.38501704f,
+	1.37159216f, 1.35815251f, 1.34469271f, 1.33120799f,
+	1.31769276f, 1.30414188f, 1.29054964f, 1.27691031f,
+	1.26321793f, 1.24946654f, 1.23564947f, 1.22176027f,
+	1.20779181f, 1.19373667f, 1.17958736f, 1.16533566f,
+	1.15097284f, 1.13648987f, 1.12187696f, 1.10712361f,
+	1.09221888f, 1.07715058f, 1.06190598f, 1.04647088f,
+	1.03083026f, 1.01496744f, 0.998864233f, 0.982500792f,
+	0.965855062f, 0.948902607f, 0.931616187f, 0.913965225f,
+	0.895915329f, 0.877427459f, 0.85845685f, 0.838952243f,
+	0.818853915f, 0.798092067f, 0.77658397f, 0.754230678f,
+	0.730911911f, 0.706479609f, 0.680747926f, 0.653478622f,
+	0.624358594f, 0.592962921f, 0.558692157f, 0.520656049f,
+	0.477437824f, 0.426547974f, 0.362871438f, 0.272320867f,
+	0.0f
+};
+static const float s_afZigR[ZIGNOR_C] __attribute__((aligned(64))) = {
+	0.927158594f, 0.936230302f, 0.956607997f, 0.966096401f,
+	0.971681476f, 0.975393832f, 0.978054106f, 0.980060697f,
+	0.981631517f, 0.982896388f, 0.983937562f, 0.984809875f,
+	0.985551357f, 0.986189306f, 0.986743689f, 0.987229586f,
+	0.98765862f, 0.988039851f, 0.988380432f, 0.988686144f,
+	0.988961697f, 0.989210904f, 0.989436984f, 0.98964262f,
+	0.989830077f, 0.990001202f, 0.990157723f, 0.990301013f,
+	0.990432262f, 0.990552545f, 0.990662754f, 0.990763724f,
+	0.990856111f, 0.99094063f, 0.991017759f, 0.991088033f,
+	0.99115181f, 0.991209507f, 0.991261542f, 0.991308093f,
+	0.991349518f, 0.991385996f, 0.991417825f, 0.991445124f,
+	0.991468072f, 0.991486847f, 0.99150157f, 0.991512358f,
+	0.991519272f, 0.991522491f, 0.991522014f, 0.991517901f,
+	0.991510212f, 0.991499007f, 0.991484284f, 0.991466045f,
+	0.991444349f, 0.991419196f, 0.991390526f, 0.99135834f,
+	0.991322577f, 0.991283238f, 0.991240323f, 0.991193593f,
+	0.991143167f, 0.991088867f, 0.991030633f, 0.990968287f,
+	0.990901828f, 0.990831077f, 0.990755856f, 0.990676045f,
+	0.990591466f, 0.99050194f, 0.990407228f, 0.990307093f,
+	0.990201354f, 0.990089715f, 0.989971817f, 0.989847422f,
+	0.989716172f, 0.989577651f, 0.989431381f, 0.989277005f,
+	0.989113927f, 0.988941669f, 0.988759577f, 0.988566935f,
+	0.988363028f, 0.98814702f, 0.987918019f, 0.987674952f,
+	0.987416744f, 0.987142026f, 0.986849487f, 0.986537397f,
+	0.986204028f, 0.985847235f, 0.985464752f, 0.985053897f,
+	0.984611571f, 0.984134316f, 0.983617961f, 0.983057797f,
+	0.98244822f, 0.981782734f, 0.981053412f, 0.980251014f,
+	0.979364216f, 0.978379309f, 0.977279425f, 0.976043582f,
+	0.974645257f, 0.973050654f, 0.971215844f, 0.969082713f,
+	0.966572881f, 0.963577569f, 0.959942162f, 0.955438435f,
+	0.949715376f, 0.942204177f, 0.931919336f, 0.916992784f,
+	0.893410504f, 0.850716531f, 0.750461042f, 0.0f
+};
+static const float s_afZigF[ZIGNOR_C + 1] __attribute__((aligned(64))) = {
+	0.00101435254f, 0.00266962918f, 0.00554899499f, 0.00862448476f,
+	0.0118394783f, 0.0151672978f, 0.0185921025f, 0.022103304f,
+	0.0256932918f, 0.0293563176f, 0.0330878869f, 0.0368843898f,
+	0.0407428667f, 0.0446608625f, 0.0486362949f, 0.0526674017f,
+	0.0567526631f, 0.0608907714f, 0.0650805831f, 0.0693211183f,
+	0.0736115053f, 0.0779509842f, 0.0823388994f, 0.0867746696f,
+	0.0912578031f, 0.0957878456f, 0.100364439f, 0.104987256f,
+	0.109656021f, 0.11437051f, 0.119130544f, 0.123935983f,
+	0.128786713f, 0.133682653f, 0.138623774f, 0.143610075f,
+	0.148641571f, 0.153718308f, 0.158840373f, 0.164007857f,
+	0.169220895f, 0.174479634f, 0.179784268f, 0.185134992f,
+	0.190532044f, 0.195975646f, 0.201466113f, 0.207003713f,
+	0.212588772f, 0.21822165f, 0.223902702f, 0.229632318f,
+	0.235410944f, 0.241238996f, 0.247116953f, 0.253045291f,
+	0.25902456f, 0.265055299f, 0.271138072f, 0.277273506f,
+	0.283462197f, 0.289704859f, 0.29600215f, 0.302354842f,
+	0.308763623f, 0.315229386f, 0.321752906f, 0.328335106f,
+	0.334976852f, 0.341679156f, 0.348442972f, 0.355269372f,
+	0.362159491f, 0.369114459f, 0.376135468f, 0.383223802f,
+	0.3903808f, 0.397607863f, 0.404906422f, 0.412278026f,
+	0.419724345f, 0.427246988f, 0.434847832f, 0.442528725f,
+	0.450291634f, 0.458138704f, 0.466072142f, 0.474094301f,
+	0.482207656f, 0.490414828f, 0.498718649f, 0.50712204f,
+	0.515628219f, 0.524240553f, 0.53296268f, 0.541798353f,
+	0.550751805f, 0.559827387f, 0.569029987f, 0.57836467f,
+	0.58783704f, 0.597453177f, 0.607219517f, 0.617143393f,
+	0.627232492f, 0.637495458f, 0.647941828f, 0.658581972f,
+	0.669427693f, 0.680491865f, 0.69178915f, 0.70333612f,
+	0.715151489f, 0.727256894f, 0.73967725f, 0.752441585f,
+	0.765584171f, 0.779146075f, 0.793177009f, 0.807738304f,
+	0.822907209f, 0.838783622f, 0.855500579f, 0.873243034f,
+	0.892281651f, 0.913043618f, 0.936282694f, 0.963599682f,
+	1.0f
+};
 
-static void zigNorInit(int iC, double dR, double dV)
+/* exponential ziggurat: as above, for the density exp(-x) */
+static const double s_adZigExpX[ZIGEXP_C + 1] __attribute__((aligned(64))) = {
+	8.6971174701310847, 7.6971174701310501, 6.9410336293772108,
+	6.478378493832567, 6.14416466577247, 5.8821443157953963,
+	5.6664101674540301, 5.4828906275260589, 5.3230905057543945,
+	5.1814872813014965, 5.0542884899813005, 4.938777085901247,
+	4.8329397410251076, 4.7352429966017366, 4.6444918854200807,
+	4.5597370617073469, 4.4802117465284175, 4.4052876934735679,
+	4.3344436803172677, 4.2672424802773614, 4.2033137137351799,
+	4.142340865664047, 4.0840513104082934, 4.0282085446479323,
+	3.9746060666737844, 3.9230625001354853, 3.8734176703995047,
+	3.8255294185223323, 3.7792709924116634, 3.7345288940397929,
+	3.6912010902374144, 3.6491955157608493, 3.6084288131289051,
+	3.568825265648333, 3.5303158891293394, 3.4928376547740556,
+	3.4563328211327562, 3.4207483572511159, 3.386035442460297,
+	3.3521490309001054, 3.319047470970744, 3.2866921715990647,
+	3.2550473085704459, 3.2240795652862602, 3.1937579032122363,
+	3.1640533580259689, 3.134938858084436, 3.10638906233982,
+	3.0783802152540858, 3.0508900166154507, 3.0238975044556722,
+	2.9973829495161262, 2.9713277599210852, 2.9457143948950413,
+	2.9205262865127364, 2.8957477686001374, 2.8713640120155319,
+	2.8473609656351844, 2.8237253024500308, 2.8004443702507333,
+	2.7775061464397521, 2.7548991965623402, 2.7326126361946956,
+	2.7106360958679243, 2.6889596887417988, 2.6675739807732617,
+	2.6464699631518038, 2.6256390267977832, 2.6050729387408302,
+	2.5847638202141354, 2.5647041263168999, 2.5448866271118646,
+	2.5253043900378223, 2.5059507635285883, 2.4868193617402041,
+	2.4679040502973595, 2.4491989329782444, 2.4306983392644144,
+	2.4123968126888653, 2.3942890999214526, 2.3763701405361353,
+	2.358635057409332, 2.3410791477030291, 2.3236978743901906,
+	2.306486858283574, 2.2894418705322637, 2.272558825553149,
+	2.2558337743672134, 2.2392628983129033, 2.222842503111031,
+	2.2065690132576581, 2.1904389667232143, 2.1744490099377689,
+	2.1585958930438802, 2.1428764653998362, 2.1272876713173625,
+	2.1118265460190364, 2.0964902118017092, 2.0812758743932194,
+	2.0661808194905702, 2.0512024094685795, 2.0363380802487643,
+	2.0215853383189208, 2.0069417578945128, 1.9924049782135711,
+	1.9779727009573547, 1.9636426877895423, 1.9494127580071789,
+	1.9352807862970454, 1.9212447005915219, 1.9073024800183813,
+	1.8934521529393018, 1.879691795072205, 1.8660195276928215,
+	1.8524335159111693, 1.8389319670188735, 1.8255131289035134,
+	1.8121752885263842, 1.7989167704602844, 1.7857359354841194,
+	1.7726311792312988, 1.7596009308890681, 1.7466436519460677,
+	1.7337578349855649, 1.7209420025219289, 1.7081947058780513,
+	1.6955145241015315, 1.6829000629175475, 1.6703499537164457,
+	1.6578628525741663, 1.6454374393037172, 1.6330724165359849,
+	1.6207665088282515, 1.6085184617988519, 1.596327041286477,
+	1.5841910325326825, 1.5721092393862233, 1.5600804835278816,
+	1.5481036037145068, 1.5361774550410254, 1.5243009082192196,
+	1.5124728488721104, 1.5006921768428103, 1.4889578055167394,
+	1.4772686611561272, 1.4656236822457387, 1.454021818848787,
+	1.4424620319720061, 1.4309432929388732, 1.4194645827699766,
+	1.408024891569529, 1.3966232179170355, 1.3852585682631156,
+	1.3739299563284839, 1.3626364025050801, 1.3513769332583287,
+	1.3401505805294984, 1.3289563811371101, 1.3177933761763183,
+	1.3066606104151677, 1.2955571316865944, 1.284481990275006,
+	1.2734342382962345, 1.2624129290696087, 1.2514171164808459,
+	1.2404458543343997, 1.2294981956938424, 1.2185731922087835,
+	1.2076698934267542, 1.196787346088396, 1.1859245934041951,
+	1.1750806743109043, 1.1642546227056716, 1.1534454666557674,
+	1.1426522275816655, 1.1318739194110714, 1.1211095477013233,
+	1.1103581087274039, 1.0996185885325902, 1.0888899619385397,
+	1.0781711915113652, 1.0674612264799606, 1.0567590016025443,
+	1.0460634359770369, 1.0353734317905212, 1.0246878730026101,
+	1.0140056239570894, 1.0033255279156894, 0.99264640550726846,
+	0.98196705308505516, 0.97128624098389593, 0.96060271166865907,
+	0.94991517776406853, 0.93922231995525485, 0.92852278474720296,
+	0.91781518207003676, 0.90709808271568271, 0.89637001558988239,
+	0.88562946476174387, 0.87487486629101741, 0.86410460481099671,
+	0.85331700984236547, 0.8425103518103606, 0.8316828377342651,
+	0.82083260655440382, 0.80995772405741018, 0.79905617735547896,
+	0.78812586886948433, 0.77716460975912138, 0.76617011273542623,
+	0.75513998418197359, 0.74407171550049944, 0.73296267358435663,
+	0.72181009030874732, 0.71061105090964605, 0.69936248110322297,
+	0.68806113277373881, 0.67670356802951348, 0.66528614139266862,
+	0.65380497984765551, 0.64225596042452693, 0.63063468493348063,
+	0.61893645139486642, 0.60715622162029026, 0.59528858429149301,
+	0.58332771274875961, 0.57126731653257812, 0.55910058551153019,
+	0.54682012516329981, 0.53441788123715472, 0.52188505159212406,
+	0.50921198244364319, 0.49638804551865967, 0.48340149165345014,
+	0.47023927508215713, 0.45688684093140813, 0.44332786607354013,
+	0.42954394022539827, 0.4155141696003436, 0.40121467889626466,
+	0.38661797794110619, 0.37169214532990352, 0.35639976025837972,
+	0.34069648106483463, 0.32452911701689441, 0.30783295467491661,
+	0.29052795549121424, 0.27251318547844777, 0.25365836338589415,
+	0.23379048305965566, 0.21267151063094616, 0.18995868962240969,
+	0.1651276225641628, 0.13730498093998469, 0.10483850756578511,
+	0.063852163814956245, 0
+};
+static const double s_adZigExpR[ZIGEXP_C] __attribute__((aligned(64))) = {
+	0.88501937527756969, 0.90177052075821229, 0.93334492234895627,
+	0.9484108826956823, 0.95735460160488206, 0.96332389401564789,
+	0.96761273284061822, 0.97085476756194788, 0.97339830605926736,
+	0.97545129720201762, 0.97714586250685487, 0.97857013122169989,
+	0.97978523431731246, 0.98083496216629562, 0.98175154014612565,
+	0.98255923223144104, 0.98327667144015996, 0.98391841394121538,
+	0.98449600340983379, 0.98501871716040235, 0.98549410007825688,
+	0.9859283537627439, 0.98632662483499056, 0.98669322171877949,
+	0.98703177983587331, 0.98734538903362712, 0.98763669297965662,
+	0.98790796748635723, 0.98816118281496423, 0.98839805366842159,
+	0.98862007962999832, 0.98882857811923941, 0.98902471143770976,
+	0.98920950910943584, 0.98938388644747399, 0.98954866007259046,
+	0.98970456095429549, 0.98985224542540917, 0.98999230452957998,
+	0.99012527198992906, 0.99025163103129221, 0.99037182024466175,
+	0.99048623864770002, 0.99059525006749283, 0.99069918694952086,
+	0.99079835367893498, 0.99089302948572944, 0.99098347099360529,
+	0.99106991446267267, 0.99115257776820054, 0.99123166215108904,
+	0.99130735377031254, 0.99137982508307188, 0.99144923607463231,
+	0.99151573535666204, 0.99157946115023921, 0.99164054216744923,
+	0.99169909840360515, 0.99175524185050945, 0.99180907713980859,
+	0.99186070212431754, 0.99191020840419331, 0.99195768180396959,
+	0.99200320280572929, 0.99204684694304812, 0.99208868515978688,
+	0.99212878413733741, 0.99216720659349922, 0.99220401155581028,
+	0.99223925461183005, 0.99227298813859877, 0.99230526151325416,
+	0.99233612130657078, 0.99236561146099878, 0.99239377345461544,
+	0.99242064645225525, 0.99244626744495057, 0.99247067137870859,
+	0.99249389127353815, 0.99251595833355921, 0.99253690204893663,
+	0.99255675029032009, 0.99257552939639304, 0.99259326425509031,
+	0.99260997837898157, 0.992625693975279, 0.99264043201087893,
+	0.99265421227281758, 0.99266705342448014, 0.99267897305787656,
+	0.99268998774226858, 0.99270011306940653, 0.99270936369561391,
+	0.99271775338093615, 0.99272529502555107, 0.992732000703623,
+	0.99273788169476451, 0.99274294851326073, 0.99274721093519136,
+	0.99275067802357986, 0.99275335815168719, 0.99275525902455197,
+	0.9927563876988813, 0.99275675060137658, 0.99275635354557445,
+	0.99275520174728571, 0.9927532998386881, 0.99275065188114386,
+	0.99274726137679481, 0.99274313127898395, 0.99273826400155152,
+	0.99273266142704697, 0.99272632491388924, 0.99271925530251537,
+	0.99271145292053586, 0.99270291758693296, 0.99269364861531262,
+	0.99268364481623561, 0.99267290449863754, 0.99266142547035219,
+	0.99264920503774434, 0.99263624000445749, 0.99262252666928041,
+	0.99260806082312947, 0.99259283774514351, 0.99257685219788694,
+	0.99256009842164661, 0.99254257012781588, 0.99252426049134423,
+	0.99250516214223861, 0.99248526715609153, 0.99246456704361197,
+	0.99244305273913003, 0.99242071458804337, 0.99239754233317123,
+	0.99237352509997245, 0.99234865138058859, 0.9923229090166612,
+	0.99229628518087165, 0.99226876635714678, 0.99224033831946779,
+	0.99221098610921499, 0.99218069401097431, 0.99214944552672835,
+	0.9921172233483414, 0.99208400932825103, 0.99204978444825997,
+	0.99201452878632412, 0.99197822148121484, 0.99194084069493027,
+	0.99190236357271777, 0.99186276620055802, 0.99182202355995108,
+	0.99178010947982875, 0.99173699658540471, 0.99169265624376002,
+	0.99164705850594381, 0.99160017204534567, 0.99155196409208457,
+	0.99150240036313231, 0.99145144498786364, 0.9913990604287054,
+	0.99134520739651888, 0.99128984476033, 0.99123292945097408,
+	0.99117441635819603, 0.99111425822069332, 0.99105240550855556,
+	0.99098880629748987, 0.99092340613417673, 0.99085614789203136,
+	0.99078697161658158, 0.99071581435959066, 0.99064261000097809,
+	0.99056728905748903, 0.9904897784769624, 0.99041000141693225,
+	0.99032787700616476, 0.9902433200875882, 0.99015624094091936,
+	0.99006654498309166, 0.98997413244440957, 0.98987889801810258,
+	0.98978073048071791, 0.98967951228048023, 0.98957511909044182,
+	0.98946741932286175, 0.98935627360084644, 0.98924153418280314,
+	0.98912304433473275, 0.98900063764476409, 0.98887413727364426,
+	0.98874335513410494, 0.98860809099110669, 0.98846813147392887,
+	0.98832324898986446, 0.98817320052790492, 0.98801772633919449,
+	0.98785654847919979, 0.98768936919438477, 0.98751586913370193,
+	0.98733570536229998, 0.98714850915145469, 0.98695388351475388,
+	0.98675140045588228, 0.98654059788784909, 0.9863209761769578,
+	0.98609199425710237, 0.98585306525074157, 0.98560355152190393,
+	0.98534275907338664, 0.98506993118442843, 0.98478424116596475,
+	0.98448478408730611, 0.98417056729975716, 0.98384049954802177,
+	0.98349337841764106, 0.98312787581408623, 0.98274252110380778,
+	0.98233568146602424, 0.98190553890171028, 0.98145006321710937,
+	0.98096698013499184, 0.98045373347714926, 0.97990744009148245,
+	0.97932483584681684, 0.97870221056072948, 0.97803532912240687,
+	0.97731933527054926, 0.97654863341021136, 0.97571674239409822,
+	0.97481611319623096, 0.97383789963829548, 0.97277166744713106,
+	0.97160502140444105, 0.97032312239453711, 0.96890805450552175,
+	0.96733798498544132, 0.96558603352123296, 0.96361872652487746,
+	0.96139384751146695, 0.95885738974131207, 0.95593914209661457,
+	0.95254613726150117, 0.94855265223826246, 0.94378444893277547,
+	0.93799298941023512, 0.93081134015790656, 0.9216746490790324,
+	0.90966709956572256, 0.89320233377214986, 0.86928175221883852,
+	0.83150825287654584, 0.76354482443436988, 0.60905258284881303,
+	0
+};
+static const double s_adZigExpF[ZIGEXP_C + 1] __attribute__((aligned(64))) = {
+	0.00016706669230795803, 0.0004541343538414966, 0.00096726928232717605,
+	0.0015362997803015767, 0.0021459677437189128, 0.0027887987935740857,
+	0.0034602647778369166, 0.0041572951208338118, 0.0048776559835424131,
+	0.005619642207205509, 0.006381905937319206, 0.0071633531836350168,
+	0.0079630774380170782, 0.0087803149858090151, 0.009614413642502255,
+	0.010464810181030028, 0.011331013597834651, 0.012212592426255444,
+	0.01310916493125506, 0.014020391403182004, 0.014945968011691214,
+	0.015885621839973229, 0.016839106826040014, 0.017806200410911435,
+	0.018786700744696107, 0.019780424338009826, 0.020787204072578207,
+	0.021806887504283678, 0.022839335406385341, 0.023884420511558282,
+	0.024942026419731898, 0.026012046645134335, 0.027094383780955921,
+	0.028188948763978757, 0.029295660224637525, 0.030414443910466743,
+	0.031545232172893747, 0.032687963508959687, 0.03384258215087449,
+	0.03500903769739757, 0.036187284781931589, 0.037377282772959528,
+	0.038578995503075024, 0.039792391023374299, 0.041017441380415007,
+	0.042254122413316428, 0.043502413568888391, 0.04476229773294349,
+	0.046033761076175385, 0.047316792913181777, 0.048611385573379719,
+	0.049917534282706601, 0.051235237055126504, 0.052564494593071921,
+	0.053905310196046316, 0.055257689676697273, 0.05662164128374312,
+	0.057997175631200916, 0.059384305633420544, 0.060783046445479931,
+	0.062193415408541314, 0.063615431999807667, 0.065049117786754082,
+	0.066494496385340121, 0.067951593421936976, 0.069420436498729129,
+	0.070901055162372217, 0.07239348087570914, 0.073897746992365135,
+	0.075413888734058812, 0.076941943170480934, 0.078481949201606852,
+	0.080033947542320363, 0.081597980709237891, 0.083174093009632841,
+	0.08476233053236859, 0.086362741140757385, 0.087975374467270703,
+	0.089600281910033358, 0.091237516631040683, 0.092887133556044069,
+	0.094549189376056372, 0.096223742550433339, 0.097910853311492768,
+	0.099610583670637715, 0.10132299742595421, 0.1030481601712583,
+	0.10478613930657076, 0.10653700405000224, 0.10830082545103438,
+	0.110077676405186, 0.11186763167005694, 0.11367076788274494,
+	0.11548716357863417, 0.11731689921155621, 0.11916005717532833,
+	0.12101672182667549, 0.12288697950954582, 0.12477091858083166,
+	0.12666862943751134, 0.12858020454522887, 0.13050573846833147,
+	0.13244532790138822, 0.13439907170221438, 0.13636707092642961,
+	0.13834942886358098, 0.14034625107486323, 0.14235764543247301,
+	0.14438372216063561, 0.14642459387834578, 0.14848037564386765,
+	0.15055118500104078, 0.15263714202744377, 0.154738369384469,
+	0.15685499236936615, 0.15898713896931513, 0.16113493991759298,
+	0.16329852875190279, 0.165478041874937, 0.16767361861725122,
+	0.16988540130252872, 0.17211353531532111, 0.17435816917135458,
+	0.17661945459049599, 0.17889754657247942, 0.18119260347549743,
+	0.1835047870977686, 0.18583426276219828, 0.18818119940425548,
+	0.19054576966319658, 0.19292814997677254, 0.19532852067956447,
+	0.19774706610510009, 0.20018397469191251, 0.20263943909371027,
+	0.20511365629383899, 0.20760682772422334, 0.21011915938898959,
+	0.21265086199297964, 0.21520215107538007, 0.21777324714870192,
+	0.22036437584336088, 0.22297576805812155, 0.22560766011668545,
+	0.22826029393071814, 0.23093391716962888, 0.23362878343743479,
+	0.23634515245706109, 0.23908329026245065, 0.24184346939887874,
+	0.24462596913189366, 0.24743107566532918, 0.25025908236886385,
+	0.25311029001563107, 0.25598500703041699, 0.25888354974901784,
+	0.26180624268936459, 0.26475341883506387, 0.26772541993204652,
+	0.27072259679906174, 0.27374530965280475, 0.27679392844851919,
+	0.27986883323697476, 0.28297041453878263, 0.28609907373707877,
+	0.28925522348967969, 0.29243928816189457, 0.29565170428126325,
+	0.2988929210155839, 0.30216340067569569, 0.30546361924459248,
+	0.30879406693456246, 0.31215524877418188, 0.31554768522713128,
+	0.31897191284495957, 0.3224284849560915, 0.32591797239355857,
+	0.32944096426413882, 0.33299806876181143, 0.3365899140286801,
+	0.34021714906678258, 0.34388044470450502, 0.34758049462163959,
+	0.35131801643748606, 0.35509375286679018, 0.3589084729487525,
+	0.36276297335482061, 0.36665807978151704, 0.37059464843514894,
+	0.37457356761590516, 0.37859575940958384, 0.38266218149601289,
+	0.38677382908414082, 0.39093173698480027, 0.39513698183329338,
+	0.39939068447523435, 0.40369401253053361, 0.40804818315203578,
+	0.41245446599716462, 0.41691418643300643, 0.42142872899762018,
+	0.42599954114303801, 0.43062813728846255, 0.4353161032156404,
+	0.44006510084235773, 0.44487687341455245, 0.44975325116275899,
+	0.45469615747461956, 0.45970761564214185, 0.46478975625043045,
+	0.46994482528396436, 0.47517519303738182, 0.48048336393045876,
+	0.48587198734188958, 0.49134386959403731, 0.49690198724155438,
+	0.50254950184135261, 0.50828977641064788, 0.51412639381475367,
+	0.52006317736823882, 0.52610421398362506, 0.53225388026304876,
+	0.53851687200286746, 0.54489823767244538, 0.55140341654064717,
+	0.55803828226259344, 0.56480919291240639, 0.57172304866483215,
+	0.57878735860285158, 0.58601031847727469, 0.59340090169174031,
+	0.60096896636523933, 0.60872538207962934, 0.61668218091521509,
+	0.62485273870367364, 0.63325199421437406, 0.64189671642727431,
+	0.65080583341457954, 0.66000084107900858, 0.66950631673193395,
+	0.67935057226477491, 0.68956649611708787, 0.70019265508279849,
+	0.71127476080508678, 0.72286765959358334, 0.73503809243143547,
+	0.74786862198520776, 0.76146338884990972, 0.7759568520401301,
+	0.79152763697251138, 0.80842165152302559, 0.82699329664306942,
+	0.84778550062401126, 0.87170433238122902, 0.90046992992577801,
+	0.938143680862219, 1
+};
+
+/* McFarland: X_k, with X_L = 0 */
+static const double s_adZigMFX[ZIGMF_L + 1] __attribute__((aligned(64))) = {
+	3.6360066255009453, 3.4315504938371104, 3.3044597575834196,
+	3.2104230299359235, 3.1350404965487715, 3.071731380503703,
+	3.0169132333162572, 2.9684110536981398, 2.9248012360226463,
+	2.8850991264225918, 2.8485942418840637, 2.8147564539689527,
+	2.7831792868859999, 2.753543960557268, 2.7255956695841124,
+	2.6991274073362819, 2.673968620032908, 2.6499770531137168,
+	2.6270327665739952, 2.6050336599534876, 2.5838920706554434,
+	2.5635321499209933, 2.5438878118259747, 2.5249011109756583,
+	2.5065209453594179, 2.4887020089326741, 2.4714039381921373,
+	2.454590611032538, 2.4382295662970579, 2.4222915198391677,
+	2.4067499583960643, 2.3915807966781797, 2.3767620861836267,
+	2.3622737666172666, 2.3480974526209666, 2.3342162499412229,
+	2.3206145962721481, 2.3072781228890764, 2.2941935338849961,
+	2.2813485003794192, 2.2687315675178219, 2.2563320724428313,
+	2.2441400717138329, 2.232146276893431, 2.2203419972180196,
+	2.2087190884339831, 2.1972699070173745, 2.1859872691085749,
+	2.1748644135885562, 2.1638949688032989, 2.153072922510352,
+	2.1423925946785825, 2.1318486128206597, 2.1214358895791334,
+	2.1111496023223051, 2.100985174536381, 2.0909382588264758,
+	2.0810047213615022, 2.071180627617438, 2.0614622292903251,
+	2.0518459522650163, 2.0423283855384633, 2.0329062710075072,
+	2.0235764940409049, 2.0143360747639063, 2.0051821599912358,
+	1.996112015750988, 1.9871230203478074, 1.9782126579189259,
+	1.969378512441224, 1.960618262151582, 1.9519296743464103,
+	1.9433106005294971, 1.9347589718802014, 1.9262727950166023,
+	1.9178501480305348, 1.9094891767735123, 1.9011880913744068,
+	1.8929451629714305, 1.8847587206424721, 1.8766271485192088,
+	1.8685488830716357, 1.8605224105507767, 1.8525462645783393,
+	1.8446190238729934, 1.8367393101037817, 1.8289057858619202,
+	1.8211171527429342, 1.8133721495316959, 1.8056695504835014,
+	1.7980081636948406, 1.790386829557987, 1.7828044192939709,
+	1.7752598335588912, 1.767752001118887, 1.7602798775894231,
+	1.752842444234846, 1.7454387068244517, 1.7380676945415596,
+	1.7307284589423289, 1.723420072961267, 1.7161416299605847,
+	1.7088922428207343, 1.7016710430696416, 1.6944771800482961,
+	1.6873098201105126, 1.680168145854809, 1.6730513553864725,
+	1.6659586616079951, 1.6588892915361753, 1.6518424856442675,
+	1.6448174972276663, 1.6378135917916821, 1.6308300464600529,
+	1.6238661494029047, 1.6169211992829364, 1.6099945047186717,
+	1.6030853837636732, 1.5961931634006661, 1.589317179049569,
+	1.582456774088471, 1.575611299386636, 1.5687801128486527,
+	1.5619625789688796, 1.5551580683953692, 1.5483659575024822,
+	1.5415856279714237, 1.534816466377964, 1.5280578637866162,
+	1.5213092153505743, 1.514569919916712, 1.5078393796349769,
+	1.501116999571507, 1.494402187324817, 1.487694352644402,
+	1.4809929070511159, 1.4742972634586768, 1.4676068357956611,
+	1.4609210386273375, 1.4542392867766951, 1.4475609949440083,
+	1.440885577324275, 1.4342124472218576, 1.4275410166616347,
+	1.4208706959959649, 1.4142008935067423, 1.407531015001801,
+	1.4008604634049069, 1.3941886383385456, 1.3875149356986873,
+	1.3808387472206778, 1.3741594600353673, 1.3674764562145489,
+	1.360789112304738, 1.3540967988482726, 1.3473988798906633,
+	1.3406947124730653, 1.3339836461086816, 1.3272650222418378,
+	1.3205381736883948, 1.3138024240560842, 1.3070570871432636,
+	1.3003014663144921, 1.2935348538512166, 1.2867565302757547,
+	1.2799657636466237, 1.2731618088231356, 1.2663439066970261,
+	1.259511283388725, 1.2526631494056926, 1.2457986987600576,
+	1.2389171080425772, 1.2320175354497032, 1.2250991197602876,
+	1.2181609792581789, 1.2112022105966473, 1.2042218876002495,
+	1.1972190599993568, 1.1901927520921753, 1.1831419613286192,
+	1.1760656568099117, 1.1689627776972285, 1.1618322315220864,
+	1.1546728923905116, 1.1474835990722585, 1.1402631529655241,
+	1.1330103159266693, 1.1257238079534271, 1.1184023047089136,
+	1.1110444348724797, 1.103648777301979, 1.0962138579904201,
+	1.0887381467981376, 1.0812200539395733, 1.0736579262014412,
+	1.0660500428664406, 1.0583946113137244, 1.0506897622639721,
+	1.0429335446331149, 1.0351239199544018, 1.02725875632356,
+	1.0193358218161097, 1.0113527773194033, 1.0033071687144683,
+	0.99519641833410988, 0.98701781561375757, 0.97876850683997763,
+	0.97044548388813356, 0.9620455718249985, 0.95356541523378735,
+	0.94500146309754329, 0.93634995205146609, 0.9276068877847925,
+	0.91876802433727989, 0.90982884099298622, 0.90078451642337021,
+	0.89162989967087802, 0.88235947749073551, 0.87296733747962396,
+	0.86344712631141052, 0.85379200226718821, 0.84399458108315362,
+	0.83404687393697963, 0.82394021614039825, 0.81366518478824723,
+	0.80321150321299839, 0.79256792958286282, 0.78172212632578042,
+	0.77066050621269078, 0.75936804982450334, 0.74782808766424147,
+	0.73602203822549406, 0.72392909069841471, 0.71152581740432652,
+	0.6987856960826665, 0.68567851518000678, 0.67216962534122837,
+	0.6582189858549985, 0.64377993341171025, 0.62879756815562171,
+	0.61320660180729158, 0.59692843260762896, 0.57986708022333311,
+	0.56190338937075013, 0.54288651202970706, 0.52262093319905967,
+	0.50084582939360522, 0.47720040650606238, 0.4511615357701288,
+	0.42192077318821097, 0.38810845095526264, 0.34703847379431746,
+	0.29172225078045622, 0
+};
+/* McFarland: X_k * 2^-55 (fast path) */
+static const double s_adZigMFXs[ZIGMF_L] __attribute__((aligned(64))) = {
+	1.0091945683301921e-16, 9.5244659210544658e-17, 9.1717182670409391e-17,
+	8.9107139165543013e-17, 8.7014853560018243e-17, 8.5257672602470718e-17,
+	8.373616337310089e-17, 8.238995745918742e-17, 8.1179541867111468e-17,
+	8.0077586962007169e-17, 7.9064372878858251e-17, 7.8125185597714772e-17,
+	7.7248743149016528e-17, 7.6426197608205571e-17, 7.565047670477255e-17,
+	7.4915834850538595e-17, 7.4217538227142278e-17, 7.3551638477379244e-17,
+	7.2914806597379345e-17, 7.2304208730097562e-17, 7.1717411749701125e-17,
+	7.1152310430227886e-17, 7.0607070518812617e-17, 7.0080083707670334e-17,
+	6.9569931631080993e-17, 6.907535679369842e-17, 6.8595238883254953e-17,
+	6.8128575309926385e-17, 6.7674465095620081e-17, 6.7232095441992703e-17,
+	6.6800730458173705e-17, 6.6379701643087255e-17, 6.5968399803429576e-17,
+	6.5566268154162072e-17, 6.5172796399086868e-17, 6.4787515628473372e-17,
+	6.4409993901563768e-17, 6.4039832406134101e-17, 6.3676662106631924e-17,
+	6.3320140807882596e-17, 6.296995057380522e-17, 6.2625795450655699e-17,
+	6.2287399452516182e-17, 6.1954504773460179e-17, 6.1626870196341266e-17,
+	6.1304269672712384e-17, 6.0986491052166649e-17, 6.0673334942545201e-17,
+	6.0364613685097607e-17, 6.0060150430898932e-17, 5.9759778306699207e-17,
+	5.9463339659964822e-17, 5.9170685374217428e-17, 5.8881674246922628e-17,
+	5.8596172423161649e-17, 5.8314052879159834e-17, 5.8035194950469709e-17,
+	5.7759483900229951e-17, 5.7486810523461552e-17, 5.7217070783830567e-17,
+	5.6950165479713774e-17, 5.6685999936758138e-17, 5.6424483724435071e-17,
+	5.6165530394361587e-17, 5.5909057238398738e-17, 5.565498506474686e-17,
+	5.5403237990441999e-17, 5.5153743248820481e-17, 5.4906431010663e-17,
+	5.4661234217857179e-17, 5.4418088428531185e-17, 5.4176931672711712e-17,
+	5.393770431764969e-17, 5.3700348942037385e-17, 5.346481021841216e-17,
+	5.3231034803106613e-17, 5.2998971233162225e-17, 5.276856982967556e-17,
+	5.2539782607092535e-17, 5.2312563188008145e-17, 5.208686672306697e-17,
+	5.1862649815593734e-17, 5.1639870450614265e-17, 5.1418487927954983e-17,
+	5.1198462799134463e-17, 5.0979756807783596e-17, 5.0762332833351748e-17,
+	5.0546154837875339e-17, 5.0331187815602527e-17, 5.0117397745283493e-17,
+	4.9904751544950238e-17, 4.9693217029022824e-17, 4.9482762867591205e-17,
+	4.9273358547732603e-17, 4.9064974336734595e-17, 4.8857581247103239e-17,
+	4.8651151003244076e-17, 4.8445656009711615e-17, 4.8241069320930075e-17,
+	4.803736461229471e-17, 4.7834516152569145e-17, 4.7632498777499663e-17,
+	4.7431287864572576e-17, 4.7230859308845562e-17, 4.703118949978813e-17,
+	4.6832255299070551e-17, 4.6634034019244181e-17, 4.6436503403259681e-17,
+	4.623964160477265e-17, 4.604342716918939e-17, 4.5847839015407885e-17,
+	4.5652856418211994e-17, 4.5458458991278818e-17, 4.5264626670761613e-17,
+	4.5071339699412481e-17, 4.4878578611210929e-17, 4.4686324216466113e-17,
+	4.4494557587362126e-17, 4.4303260043917105e-17, 4.411241314032835e-17,
+	4.3921998651676757e-17, 4.3731998560965102e-17, 4.354239504646564e-17,
+	4.3353170469353485e-17, 4.3164307361603071e-17, 4.2975788414125809e-17,
+	4.2787596465127635e-17, 4.2599714488665951e-17, 4.2412125583385813e-17,
+	4.2224812961415955e-17, 4.2037759937405327e-17, 4.1850949917681594e-17,
+	4.1664366389512958e-17, 4.1477992910455203e-17, 4.1291813097765805e-17,
+	4.1105810617867329e-17, 4.0919969175842087e-17, 4.0734272504940358e-17,
+	4.0548704356084194e-17, 4.0363248487348822e-17, 4.0177888653403444e-17,
+	3.9992608594893037e-17, 3.9807392027742461e-17, 3.9622222632363776e-17,
+	3.9437084042747287e-17, 3.9251959835416358e-17, 3.9066833518225402e-17,
+	3.8881688518979854e-17, 3.8696508173856213e-17, 3.8511275715599406e-17,
+	3.8325974261473822e-17, 3.8140586800943434e-17, 3.7955096183055174e-17,
+	3.7769485103498701e-17, 3.7583736091314285e-17, 3.7397831495219006e-17,
+	3.7211753469520028e-17, 3.7025483959581873e-17, 3.6839004686812722e-17,
+	3.6652297133132749e-17, 3.6465342524885207e-17, 3.6278121816148524e-17,
+	3.6090615671405037e-17, 3.5902804447518937e-17, 3.5714668174973004e-17,
+	3.5526186538310071e-17, 3.5337338855721422e-17, 3.5148104057720234e-17,
+	3.4958460664833573e-17, 3.4768386764241559e-17, 3.4577859985286884e-17,
+	3.4386857473772047e-17, 3.4195355864955012e-17, 3.4003331255147085e-17,
+	3.3810759171808949e-17, 3.3617614542032141e-17, 3.3423871659284108e-17,
+	3.3229504148284318e-17, 3.303448492786785e-17, 3.2838786171679989e-17,
+	3.2642379266531788e-17, 3.2445234768231036e-17, 3.2247322354686147e-17,
+	3.2048610776061793e-17, 3.1849067801744083e-17, 3.1648660163850041e-17,
+	3.1447353496990275e-17, 3.1245112273965067e-17, 3.1041899737041899e-17,
+	3.0837677824426805e-17, 3.0632407091501473e-17, 3.0426046626353402e-17,
+	3.0218553959075401e-17, 3.00098849642542e-17, 2.9799993756003428e-17,
+	2.9588832574823936e-17, 2.937635166549225e-17, 2.9162499145084846e-17,
+	2.8947220860140314e-17, 2.8730460231840609e-17, 2.8512158087955486e-17,
+	2.8292252480136274e-17, 2.8070678484965009e-17, 2.7847367986956982e-17,
+	2.7622249441475452e-17, 2.7395247615240525e-17, 2.7166283301793204e-17,
+	2.6935273008902682e-17, 2.6702128614469703e-17, 2.6466756986969968e-17,
+	2.6229059565883819e-17, 2.5988931896854975e-17, 2.5746263115489013e-17,
+	2.5500935372715358e-17, 2.5252823193460844e-17, 2.5001792758976577e-17,
+	2.4747701101470677e-17, 2.4490395197660928e-17, 2.4229710945389947e-17,
+	2.3965472004433844e-17, 2.3697488478946155e-17, 2.3425555414434518e-17,
+	2.3149451076536754e-17, 2.2868934971842454e-17, 2.2583745562194869e-17,
+	2.2293597612771343e-17, 2.1998179100059601e-17, 2.1697147587645416e-17,
+	2.1390125954165195e-17, 2.1076697326996667e-17, 2.0756399034656022e-17,
+	2.0428715336737015e-17, 2.0093068617233331e-17, 1.9748808627437956e-17,
+	1.9395199226742335e-17, 1.9031401876090836e-17, 1.8656454862687421e-17,
+	1.8269246833540989e-17, 1.7868482621633271e-17, 1.7452638449866934e-17,
+	1.7019902204465131e-17, 1.6568092248359893e-17, 1.6094544592152679e-17,
+	1.5595952012358031e-17, 1.506812763534557e-17, 1.4505644829717048e-17,
+	1.3901264289506588e-17, 1.324497196658787e-17, 1.2522248120931079e-17,
+	1.1710653924030006e-17, 1.0772173457553398e-17, 9.6322526009306314e-18,
+	8.0969189902984133e-18
+};
+/* McFarland: f(X_k) */
+static const double s_adZigMFF[ZIGMF_L + 1] __attribute__((aligned(64))) = {
+	0.0013464657392405521, 0.0027731556153421035, 0.0042547165082092052,
+	0.0057796739057975203, 0.0073412991397548586, 0.0089351098420715116,
+	0.010557880525306297, 0.01220716637565691, 0.013881043659552722,
+	0.015577955319901545, 0.017296612992133101, 0.019035931625539348,
+	0.020794984077516454, 0.022572968529196654, 0.024369184454956363,
+	0.02618301448594414, 0.028013910447927576, 0.029861382426274053,
+	0.031724990071820669, 0.033604335595891974, 0.035499058059143641,
+	0.037408828665702873, 0.039333346848513209, 0.041272336984644505,
+	0.043225545617491874, 0.045192739090762865, 0.047173701519943906,
+	0.049168233042587217, 0.051176148300675052, 0.053197275117489298,
+	0.055231453338541979, 0.057278533811712218, 0.059338377486158375,
+	0.061410854613100106, 0.063495844034396953, 0.065593232547141639,
+	0.067702914334351535, 0.069824790453368618, 0.071958768374838195,
+	0.074104761566178581, 0.076262689114321727, 0.078432475383232239,
+	0.080614049702320958, 0.082807346082387212, 0.085012302956158414,
+	0.08722886294086879, 0.08945697262063701, 0.091696582346674091,
+	0.093947646053588421, 0.096210121090256298, 0.098483968063902014,
+	0.10076915069618393, 0.10306563569021507, 0.10537339260756419,
+	0.10769239375438167, 0.11002261407588829, 0.11236403105853823,
+	0.11471662463924179, 0.117080377121091, 0.11945527309508817,
+	0.12184129936742331, 0.12423844489189199, 0.12664670070708142,
+	0.129066059877988, 0.13149651744176, 0.13393807035728678,
+	0.13639071745837988, 0.13885445941031591, 0.14132929866952831,
+	0.14381523944625588, 0.14631228766997087, 0.14882045095742544,
+	0.15133973858316821, 0.15387016145239568, 0.15641173207601367,
+	0.15896446454779528, 0.16152837452353083, 0.16410347920207397,
+	0.1666897973081958, 0.169287349077167, 0.17189615624099375,
+	0.17451624201624027, 0.17714763109337558, 0.17979034962758886,
+	0.18244442523102131, 0.18510988696636804, 0.18778676534180691,
+	0.19047509230721649, 0.19317490125164802, 0.19588622700202013,
+	0.19860910582300839, 0.20134357541810557, 0.20408967493182989,
+	0.20684744495306343, 0.20961692751950373, 0.21239816612321552,
+	0.21519120571727093, 0.21799609272346998, 0.22081287504113459,
+	0.22364160205697198, 0.22648232465600532, 0.2293350952335719,
+	0.23219996770839085, 0.23507699753670439, 0.23796624172749911,
+	0.24086775885881534, 0.24378160909515467, 0.24670785420599756,
+	0.24964655758544602, 0.25259778427300583, 0.25556160097552832,
+	0.25853807609033019, 0.26152727972951417, 0.26452928374551549,
+	0.26754416175789902, 0.27057198918143693, 0.27361284325549745,
+	0.27666680307477709, 0.27973394962141335, 0.28281436579851427,
+	0.28590813646514673, 0.28901534847282567, 0.29213609070355095,
+	0.29527045410944042, 0.2984185317540109, 0.30158041885516212,
+	0.30475621282992255, 0.30794601334101707, 0.31114992234532457,
+	0.31436804414429137, 0.31760048543637642, 0.3208473553716038,
+	0.32410876560830504, 0.32738483037213734, 0.33067566651746955,
+	0.3339813935912318, 0.33730213389933178, 0.34063801257574478,
+	0.34398915765439236, 0.34735570014393008, 0.35073777410557205,
+	0.35413551673408822, 0.35754906844211587, 0.36097857294793922,
+	0.3644241773668952, 0.36788603230657702, 0.37136429196601523,
+	0.37485911423902679, 0.37837066082193616, 0.38189909732588162,
+	0.38544459339393661, 0.38900732282328732, 0.39258746369272585,
+	0.39618519849573069, 0.39980071427942709, 0.40343420278973813,
+	0.40708586062305507, 0.41075588938477947, 0.41444449585511312,
+	0.41815189216249465, 0.42187829596511067, 0.42562393064093734,
+	0.4293890254868003, 0.4331738159269749, 0.43697854373188416,
+	0.44080345724749309, 0.44464881163604025, 0.44851486912879379,
+	0.45240189929156982, 0.4563101793038073, 0.46023999425205009,
+	0.46419163743875513, 0.46816541070741374, 0.47216162478505241,
+	0.47618059964326048, 0.48022266487898779, 0.48428816011645182,
+	0.48837743543160717, 0.49249085180074809, 0.4966287815749495,
+	0.50079160898219521, 0.50497973065920276, 0.50919355621513085,
+	0.51343350882954886, 0.51770002588726283, 0.52199355965282923,
+	0.52631457798785186, 0.5306635651144449, 0.53504102242857565,
+	0.53944746936735233, 0.54388344433473024, 0.5483495056905533,
+	0.55284623280835177, 0.55737422720787333, 0.56193411376895874,
+	0.56652654203407549, 0.57115218760762188, 0.57581175366101101,
+	0.58050597255355896, 0.5852356075803532, 0.59000145485958211,
+	0.59480434537329552, 0.59964514717725648, 0.60452476779749154,
+	0.6094441568333604, 0.6144043087895279, 0.61940626616216043,
+	0.6244511228080728, 0.62954002762949568, 0.63467418861171676,
+	0.63985487725619916, 0.64508343345803643, 0.65036127088395312,
+	0.65568988291572261, 0.66107084923411885, 0.66650584313069217,
+	0.67199663964917578, 0.67754512467572225, 0.68315330511810102,
+	0.68882332033930294, 0.69455745504176958, 0.70035815383607425,
+	0.70622803777410659, 0.71216992318397532, 0.71818684321498638,
+	0.72428207259019417, 0.73045915617653789, 0.73672194212568276,
+	0.74307462052222895, 0.7495217687134389, 0.75606840480487014,
+	0.76272005121574682, 0.76948281073431446, 0.77636345825143283,
+	0.78336955236059092, 0.79050957241445463, 0.79779308860488551,
+	0.80523097546943612, 0.81283568337473477, 0.82062158872301538,
+	0.82860545310813372, 0.83680703655005828, 0.84524993409651517,
+	0.85396274566074371, 0.86298075999781898, 0.87234846427043744,
+	0.88212344503610773, 0.89238277902271135, 0.9032342323509116,
+	0.91483773390854828, 0.92745214190929814, 0.94155939144668033,
+	0.95834165037890395, 1
+};
+/* McFarland: max. distance curve-chord, 2^63 */
+static const int64_t s_aiZigMFE[ZIGMF_L + 1] __attribute__((aligned(64))) = {
+	INT64_C(0), INT64_C(760464464756977536),
+	INT64_C(448776389453228736), INT64_C(319432378471897408),
+	INT64_C(248137135038660896), INT64_C(202880090710681728),
+	INT64_C(171571836145746784), INT64_C(148614414285098496),
+	INT64_C(131055373124879376), INT64_C(117188697716188016),
+	INT64_C(105959326255363328), INT64_C(96679498306158944),
+	INT64_C(88881617781386496), INT64_C(82236635090996560),
+	INT64_C(76506247815513712), INT64_C(71513621424603928),
+	INT64_C(67124763292295976), INT64_C(63236284861690232),
+	INT64_C(59767133309439944), INT64_C(56652867194208240),
+	INT64_C(53841607214960800), INT64_C(51291116660985568),
+	INT64_C(48966660107409288), INT64_C(46839408578694032),
+	INT64_C(44885235084247800), INT64_C(43083793392981096),
+	INT64_C(41417805265094856), INT64_C(39872503096997952),
+	INT64_C(38435189823393504), INT64_C(37094888274115888),
+	INT64_C(35842059459286912), INT64_C(34668374475718432),
+	INT64_C(33566528493027216), INT64_C(32530088034651152),
+	INT64_C(31553364792381624), INT64_C(30631310760148672),
+	INT64_C(29759430587601468), INT64_C(28933707950038632),
+	INT64_C(28150543382619872), INT64_C(27406701553218468),
+	INT64_C(26699266338927000), INT64_C(26025602393386608),
+	INT64_C(25383322136448944), INT64_C(24770257293318028),
+	INT64_C(24184434268496548), INT64_C(23624052764942996),
+	INT64_C(23087467160665388), INT64_C(22573170234308304),
+	INT64_C(22079778906128604), INT64_C(21606021700268192),
+	INT64_C(21150727704382524), INT64_C(20712816804742780),
+	INT64_C(20291291044279076), INT64_C(19885226946514136),
+	INT64_C(19493768681172612), INT64_C(19116121973675916),
+	INT64_C(18751548657186932), INT64_C(18399361791986144),
+	INT64_C(18058921289943424), INT64_C(17729629972545684),
+	INT64_C(17410930027184682), INT64_C(17102299803410062),
+	INT64_C(16803250920730630), INT64_C(16513325643225228),
+	INT64_C(16232094505533570), INT64_C(15959154153057876),
+	INT64_C(15694125373664434), INT64_C(15436651308392866),
+	INT64_C(15186395819615258), INT64_C(14943041993376300),
+	INT64_C(14706290776721832), INT64_C(14475859724874562),
+	INT64_C(14251481852616210), INT64_C(14032904578842484),
+	INT64_C(13819888758886204), INT64_C(13612207788758082),
+	INT64_C(13409646783940384), INT64_C(13212001820007746),
+	INT64_C(13019079228719652), INT64_C(12830694952499916),
+	INT64_C(12646673940395888), INT64_C(12466849594441034),
+	INT64_C(12291063251927698), INT64_C(12119163706012324),
+	INT64_C(11951006761178172), INT64_C(11786454817946586),
+	INT64_C(11625376488303168), INT64_C(11467646234777360),
+	INT64_C(11313144036696950), INT64_C(11161755075774700),
+	INT64_C(11013369444603426), INT64_C(10867881873142240),
+	INT64_C(10725191472407054), INT64_C(10585201496261312),
+	INT64_C(10447819113277276), INT64_C(10312955200401850),
+	INT64_C(10180524141948780), INT64_C(10050443645126908),
+	INT64_C(9922634564323140), INT64_C(9797020737762494),
+	INT64_C(9673528831335160), INT64_C(9552088193168372),
+	INT64_C(9432630715687846), INT64_C(9315090704659824),
+	INT64_C(9199404759053738), INT64_C(9085511651476776),
+	INT64_C(8973352220636881), INT64_C(8862869265013556),
+	INT64_C(8754007446505511), INT64_C(8646713195091558),
+	INT64_C(8540934620742466), INT64_C(8436621428556354),
+	INT64_C(8333724837752538), INT64_C(8232197506270748),
+	INT64_C(8131993457089647), INT64_C(8033068007686473),
+	INT64_C(7935377706820334), INT64_C(7838880265795117),
+	INT64_C(7743534501781544), INT64_C(7649300279221272),
+	INT64_C(7556138450933521), INT64_C(7464010805876688),
+	INT64_C(7372880018859656), INT64_C(7282709598630062),
+	INT64_C(7193463841420490), INT64_C(7105107782753352),
+	INT64_C(7017607152316233), INT64_C(6930928333209724),
+	INT64_C(6845038316161265), INT64_C(6759904660509167),
+	INT64_C(6675495452250827), INT64_C(6591779265524932),
+	INT64_C(6508725126498524), INT64_C(6426302470258606),
+	INT64_C(6344481109293391), INT64_C(6263231193285924),
+	INT64_C(6182523175252931), INT64_C(6102327773011657),
+	INT64_C(6022615936368828), INT64_C(5943358812242663),
+	INT64_C(5864527706326324), INT64_C(5786094048575497),
+	INT64_C(5708029361802792), INT64_C(5630305219839112),
+	INT64_C(5552893217221683), INT64_C(5475764929523744),
+	INT64_C(5398891876691216), INT64_C(5322245488522601),
+	INT64_C(5245797062572811), INT64_C(5169517727829297),
+	INT64_C(5093378405262402), INT64_C(5017349763033004),
+	INT64_C(4941402179374008), INT64_C(4865505694936416),
+	INT64_C(4789629969956383), INT64_C(4713744236314053),
+	INT64_C(4637817249534022), INT64_C(4561817237889926),
+	INT64_C(4485711849830694), INT64_C(4409468097528906),
+	INT64_C(4333052301521251), INT64_C(4256430026934765),
+	INT64_C(4179566022679093), INT64_C(4102424149973266),
+	INT64_C(4024967315895197), INT64_C(3947157394758890),
+	INT64_C(3868955150707636), INT64_C(3790320150735371),
+	INT64_C(3711210678805242), INT64_C(3631583638019625),
+	INT64_C(3551394448746868), INT64_C(3470596942067842),
+	INT64_C(3389143244518994), INT64_C(3306983651872443),
+	INT64_C(3224066499727854), INT64_C(3140338019530721),
+	INT64_C(3055742187674558), INT64_C(2970220561540922),
+	INT64_C(2883712102663141), INT64_C(2796152987593842),
+	INT64_C(2707476403707875), INT64_C(2617612326065839),
+	INT64_C(2526487281961430), INT64_C(2434024086041046),
+	INT64_C(2340141566361501), INT64_C(2244754256447310),
+	INT64_C(2147772062704893), INT64_C(2049099909268294),
+	INT64_C(1948637341988292), INT64_C(1846278104768869),
+	INT64_C(1741909672605341), INT64_C(1635412746802538),
+	INT64_C(1526660701444393), INT64_C(1415518986048581),
+	INT64_C(1301844475706792), INT64_C(1185484781083662),
+	INT64_C(1066277521235753), INT64_C(944049605179095),
+	INT64_C(818616619727547), INT64_C(689782595215188),
+	INT64_C(557341020753906), INT64_C(421080377713239),
+	INT64_C(280811035512773), INT64_C(136572683581253),
+	INT64_C(0), INT64_C(169472758397711),
+	INT64_C(328796148688750), INT64_C(494086117604026),
+	INT64_C(665530764099509), INT64_C(843517990857118),
+	INT64_C(1028505400997879), INT64_C(1221003717282243),
+	INT64_C(1421576554072223), INT64_C(1630844609094949),
+	INT64_C(1849491895574336), INT64_C(2078273468195936),
+	INT64_C(2318024607662932), INT64_C(2569671609599602),
+	INT64_C(2834244438739207), INT64_C(3112891592204642),
+	INT64_C(3406897615841603), INT64_C(3717703831259860),
+	INT64_C(4046932971216094), INT64_C(4396418610274760),
+	INT64_C(4768240509584800), INT64_C(5164767307835617),
+	INT64_C(5588708402325280), INT64_C(6043177410462442),
+	INT64_C(6531770343680806), INT64_C(7058662626930194),
+	INT64_C(7628730489114479), INT64_C(8247704170665717),
+	INT64_C(8922363124275932), INT64_C(9660787276677458),
+	INT64_C(10472684082388492), INT64_C(11369819457156506),
+	INT64_C(12366593251406166), INT64_C(13480819203094044),
+	INT64_C(14734799533779424), INT64_C(16156832897793574),
+	INT64_C(17783374517380608), INT64_C(19662203666920196),
+	INT64_C(21857193839187664), INT64_C(24455721148099060),
+	INT64_C(27580591444163160), INT64_C(31410078238128172),
+	INT64_C(36213361593675528), INT64_C(42417299664264160),
+	INT64_C(50742735963559656), INT64_C(62513705977911432),
+	INT64_C(80469541423131808), INT64_C(111428752232753376),
+	INT64_C(179355748003825344), INT64_C(2269185220820220160)
+};
+/* McFarland: alias table, threshold, 2^56 */
+static const uint64_t s_auZigMFThr[256] __attribute__((aligned(64))) = {
+	UINT64_C(0x100000000000000), UINT64_C(0x0a576fa75ec1fc8),
+	UINT64_C(0x09a614e9c7988a0), UINT64_C(0x0b2f58411d408d8),
+	UINT64_C(0x0fd37a8182a6fe0), UINT64_C(0x0da8457329c8108),
+	UINT64_C(0x0c18bb1c5d23670), UINT64_C(0x0aea2e0fded8438),
+	UINT64_C(0x09fc6849425bc60), UINT64_C(0x093c2f42cd60a70),
+	UINT64_C(0x089d49e0c7817d8), UINT64_C(0x08178f3a66ce908),
+	UINT64_C(0x07a554ee0994bb8), UINT64_C(0x07428aefe25507c),
+	UINT64_C(0x06ec330fc5a7cc0), UINT64_C(0x06a00bca9dc8ea8),
+	UINT64_C(0x065c592cf252038), UINT64_C(0x061fc00beb3b810),
+	UINT64_C(0x05e92cd0ef38cdc), UINT64_C(0x05b7c1cb247e8a8),
+	UINT64_C(0x058aca85e4f1c38), UINT64_C(0x0561b28c73dec94),
+	UINT64_C(0x053bfe910a1c0bc), UINT64_C(0x05194745cb7d944),
+	UINT64_C(0x04f9356ee3cd558), UINT64_C(0x04db7eda0dce79c),
+	UINT64_C(0x04bfe4007fd9740), UINT64_C(0x04a62e28fe35e68),
+	UINT64_C(0x048e2deb6f1ed54), UINT64_C(0x0477b9ff67f684c),
+	UINT64_C(0x0462ae44f17bea8), UINT64_C(0x044eeafaedd8020),
+	UINT64_C(0x043c54198aba590), UINT64_C(0x042ad0c96e6417c),
+	UINT64_C(0x041a4af1f093740), UINT64_C(0x040aaed9f2e2438),
+	UINT64_C(0x03fbead7e1a254c), UINT64_C(0x03edef0e17bde7c),
+	UINT64_C(0x03e0ad317819ff8), UINT64_C(0x03d4185877ed176),
+	UINT64_C(0x03c824d13041f1c), UINT64_C(0x03bcc7fd4c6bcba),
+	UINT64_C(0x03b1f832e892034), UINT64_C(0x03a7aca1977a950),
+	UINT64_C(0x039ddd3aedca132), UINT64_C(0x0394829e0d7f7e2),
+	UINT64_C(0x038b9605bd27ee0), UINT64_C(0x03831138b2bdc9a),
+	UINT64_C(0x037aee7bbcfb1e0), UINT64_C(0x037328859029b42),
+	UINT64_C(0x036bba73f607bde), UINT64_C(0x03649fc23a5cc52),
+	UINT64_C(0x035dd440a379b04), UINT64_C(0x0357540cd97a0e8),
+	UINT64_C(0x03511b8b1c4f4f4), UINT64_C(0x034b27603102e12),
+	UINT64_C(0x0345746bed45580), UINT64_C(0x033fffc4514b854),
+	UINT64_C(0x033ac6b11d46768), UINT64_C(0x0335c6a7d85719e),
+	UINT64_C(0x0330fd4833fa51c), UINT64_C(0x032c6858cd3dfa8),
+	UINT64_C(0x032805c43659cd4), UINT64_C(0x0323d3964822e52),
+	UINT64_C(0x031fcff9b267a1e), UINT64_C(0x031bf935c06ac4a),
+	UINT64_C(0x03184dac54a1926), UINT64_C(0x0314cbd80b39c5e),
+	UINT64_C(0x0311724a8ae0c8a), UINT64_C(0x030e3faaf619158),
+	UINT64_C(0x030b32b47f014d2), UINT64_C(0x03084a35198a7f6),
+	UINT64_C(0x0305850c47ad68e), UINT64_C(0x0302e229fee7896),
+	UINT64_C(0x0300608da3b915c), UINT64_C(0x02fdff4519c1208),
+	UINT64_C(0x02fbbd6be67b826), UINT64_C(0x02f99a2a64dbd90),
+	UINT64_C(0x02f794b507b37c4), UINT64_C(0x02f5ac4bab6e1a4),
+	UINT64_C(0x02f3e038f4c642e), UINT64_C(0x02f22fd1b9d7e9a),
+	UINT64_C(0x02f09a7477b05b4), UINT64_C(0x02ef1f88d27f0f8),
+	UINT64_C(0x02edbe7f1c6fd12), UINT64_C(0x02ec76cfe7b2eb0),
+	UINT64_C(0x02eb47fba00c7c4), UINT64_C(0x02ea318a2978d0e),
+	UINT64_C(0x02e9330a893d2fe), UINT64_C(0x02e84c129222fb6),
+	UINT64_C(0x02e77c3e97e6200), UINT64_C(0x02e6c331281acee),
+	UINT64_C(0x02e62092c873b3c), UINT64_C(0x02e59411b7029fa),
+	UINT64_C(0x02e51d61b4f89c2), UINT64_C(0x02e4bc3bcccbc9a),
+	UINT64_C(0x02e4705e2609b08), UINT64_C(0x02e4398bd354330),
+	UINT64_C(0x02e4178cab12b34), UINT64_C(0x02e40a2d1f6c098),
+	UINT64_C(0x02e4113e1ac3394), UINT64_C(0x02e42c94dd6ec6e),
+	UINT64_C(0x02e45c0ae0ddb38), UINT64_C(0x02e49f7dbaadc86),
+	UINT64_C(0x02e4f6cf03dad44), UINT64_C(0x02e561e4400275e),
+	UINT64_C(0x02e5e0a6cb449ba), UINT64_C(0x02e67303c4a9a52),
+	UINT64_C(0x02e718ebfecddae), UINT64_C(0x02e7d253f0ac394),
+	UINT64_C(0x02e89f33a8b676c), UINT64_C(0x02e97f86c11e19c),
+	UINT64_C(0x02ea734c57531c0), UINT64_C(0x02eb7a87034c5e2),
+	UINT64_C(0x02ec953cd2ef816), UINT64_C(0x02edc377438128e),
+	UINT64_C(0x02ef0543410984c), UINT64_C(0x02f05ab12469178),
+	UINT64_C(0x02f1c3d4b25521c), UINT64_C(0x02f340c5200287e),
+	UINT64_C(0x02f4d19d1417ea6), UINT64_C(0x02f6767aad2452c),
+	UINT64_C(0x02f82f7f87d883a), UINT64_C(0x02f9fcd0c79d790),
+	UINT64_C(0x02fbde971ec186e), UINT64_C(0x02fdd4fedc68c0c),
+	UINT64_C(0x02ffe037f706ee6), UINT64_C(0x030200761d45cf8),
+	UINT64_C(0x030435f0c3c2b6a), UINT64_C(0x030680e33929b0e),
+	UINT64_C(0x0308e18cba55324), UINT64_C(0x030b583085a57de),
+	UINT64_C(0x030de515f47c8ca), UINT64_C(0x03108888951b90a),
+	UINT64_C(0x031342d84419ac2), UINT64_C(0x031614594cbdb8c),
+	UINT64_C(0x0318fd648634fb4), UINT64_C(0x031bfe577814a14),
+	UINT64_C(0x031f17947e1519e), UINT64_C(0x03224982ee5a3c8),
+	UINT64_C(0x0325948f44262b2), UINT64_C(0x0328f92b4cf8b1e),
+	UINT64_C(0x032c77ce567ff74), UINT64_C(0x033010f56280518),
+	UINT64_C(0x0333c5235bf4e24), UINT64_C(0x033794e15005ba6),
+	UINT64_C(0x033b80beac9a4fe), UINT64_C(0x033f89517e708d0),
+	UINT64_C(0x0343af36b90115e), UINT64_C(0x0347f3127c506d4),
+	UINT64_C(0x034c55906699a94), UINT64_C(0x0350d763e338e28),
+	UINT64_C(0x0355794884edad8), UINT64_C(0x035a3c026365146),
+	UINT64_C(0x035f205e7d25876), UINT64_C(0x036427332270b76),
+	UINT64_C(0x036951606635b9e), UINT64_C(0x036e9fd0948d8c2),
+	UINT64_C(0x03741378b37a16e), UINT64_C(0x0379ad590aaf5ac),
+	UINT64_C(0x037f6e7db3c9d18), UINT64_C(0x038557ff35462fc),
+	UINT64_C(0x038b6b0327c824e), UINT64_C(0x0391a8bce4567fe),
+	UINT64_C(0x0398126e420a4de), UINT64_C(0x039ea9685de59dc),
+	UINT64_C(0x03a56f0c70915b8), UINT64_C(0x03ac64ccb592c98),
+	UINT64_C(0x03b38c2d5fc3b3a), UINT64_C(0x03bae6c5a0e3476),
+	UINT64_C(0x03c27640c3bd1aa), UINT64_C(0x03ca3c5f5b42c70),
+	UINT64_C(0x03d23af886f6860), UINT64_C(0x03da73fb50e2da8),
+	UINT64_C(0x03e2e97023afdce), UINT64_C(0x03eb9d7a60ea46e),
+	UINT64_C(0x03f4925a12dc2ea), UINT64_C(0x03fdca6dc1b9eaa),
+	UINT64_C(0x040748346f2ca5c), UINT64_C(0x04110e4fb91874c),
+	UINT64_C(0x041b1f86279fbec), UINT64_C(0x04257ec5af842a4),
+	UINT64_C(0x04302f26662863c), UINT64_C(0x043b33ed7151578),
+	UINT64_C(0x04469090394b6c4), UINT64_C(0x045248b7deee138),
+	UINT64_C(0x045e604500ca048), UINT64_C(0x046adb53daa1418),
+	UINT64_C(0x0477be40bcee664), UINT64_C(0x04850dacf5d2bd0),
+	UINT64_C(0x0492ce8429b50b8), UINT64_C(0x04a106023391360),
+	UINT64_C(0x04afb9b99023820), UINT64_C(0x04beef9a711d400),
+	UINT64_C(0x04ceadfa8142990), UINT64_C(0x04defb9d72f6f38),
+	UINT64_C(0x04efdfbe72cf60c), UINT64_C(0x0501621a964ef60),
+	UINT64_C(0x05138afc6a5f0c0), UINT64_C(0x05266348c25c4d4),
+	UINT64_C(0x0539f48cf479684), UINT64_C(0x054e490eb30e058),
+	UINT64_C(0x05636bddb63d3dc), UINT64_C(0x057968e77cb127c),
+	UINT64_C(0x05904d0d6993974), UINT64_C(0x05a8263d964e244),
+	UINT64_C(0x05c1038ebf47a80), UINT64_C(0x05daf55fc0edbc0),
+	UINT64_C(0x05f60d7b2e47308), UINT64_C(0x06125f3fa83d7cc),
+	UINT64_C(0x062fffcdb31e674), UINT64_C(0x064f063bf259bf8),
+	UINT64_C(0x066f8bd2db07830), UINT64_C(0x0691ac51232b0e4),
+	UINT64_C(0x06b5863a76d5950), UINT64_C(0x06db3b324b32f5c),
+	UINT64_C(0x0702f0650b99224), UINT64_C(0x072ccf025b32e44),
+	UINT64_C(0x075904cbbd41e10), UINT64_C(0x0787c4bbbb0ac34),
+	UINT64_C(0x07b947ca99dbdd4), UINT64_C(0x07edcdd6e56bcac),
+	UINT64_C(0x08259eb9b273838), UINT64_C(0x08610b907dd37f8),
+	UINT64_C(0x08a070493b269d8), UINT64_C(0x08e435809dad2a0),
+	UINT64_C(0x092cd2c7472b150), UINT64_C(0x097ad168acbfd18),
+	UINT64_C(0x09cecfd6d891a68), UINT64_C(0x0a2985e97bfe280),
+	UINT64_C(0x0a8bca2e6cfdb10), UINT64_C(0x0af6989f69ddbe8),
+	UINT64_C(0x0b6b1b2fd4a0450), UINT64_C(0x0beab4d13cc3710),
+	UINT64_C(0x0c770fcdd4b57f8), UINT64_C(0x0d1230b71fb76f0),
+	UINT64_C(0x0dbe8fb696aad30), UINT64_C(0x0e7f3aeac3509c0),
+	UINT64_C(0x0f5805d67717298), UINT64_C(0x081cb0a7c4f80a8),
+	UINT64_C(0x07cee4903185398), UINT64_C(0x066813555d6c588),
+	UINT64_C(0x0e0503d52038b28), UINT64_C(0x09debfce326e068),
+	UINT64_C(0x0e6d27f30bc2950), UINT64_C(0x066af3f714e9290),
+	UINT64_C(0x0671be9261ba200), UINT64_C(0x0e46995f43ad918),
+	UINT64_C(0x0744bff73038300), UINT64_C(0x05f8eaf54838b88),
+	UINT64_C(0x088fa4906bdcf18), UINT64_C(0x0b4c53aafe3a900),
+	UINT64_C(0x05458aef70adc18), UINT64_C(0x0c095bd84fe6da0),
+	UINT64_C(0x000000000000000), UINT64_C(0x000000000000000)
+};
+/* McFarland: alias table, alias */
+static const uint8_t s_aucZigMFAlias[256] __attribute__((aligned(64))) = {
+	  0,   0,   1,   2,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   1,   1,   2, 241, 243, 245, 246, 246,
+	247, 248, 248, 249, 249, 249, 250, 250, 250, 250, 251, 251,
+	251, 251, 251, 252, 252, 252, 252, 252, 252, 252, 252, 252,
+	252, 253, 253, 253, 253, 253, 253, 253, 253, 253, 253, 253,
+	253, 253, 253, 253, 253, 253, 253, 253, 253, 253, 253, 253,
+	253, 253, 253, 253, 253, 253, 253, 253, 253, 253, 253, 253,
+	253, 253, 253, 253, 253, 253, 253, 253, 253, 253, 253, 253,
+	253, 253, 253, 253, 253, 253, 253, 253, 253, 253, 253, 253,
+	253, 253, 253, 253, 253, 253, 253, 253, 253, 253, 253, 253,
+	253, 253, 253, 253, 253, 253, 253, 253, 253, 253, 253, 253,
+	253, 253, 253, 253, 253, 253, 253, 253, 253, 253, 253, 253,
+	253, 253, 253, 253, 253, 253, 253, 253, 253, 253, 253, 253,
+	253, 253, 253, 253, 253, 253, 253, 253, 253, 253, 253, 253,
+	253, 253, 253, 253, 253, 253, 253, 253, 253, 253, 253, 253,
+	253, 253, 253, 253, 253, 253, 253, 253, 253, 253, 253, 253,
+	253, 253, 253, 253, 253, 253, 253, 253, 253, 253, 253, 253,
+	253, 253, 253, 253, 253, 253, 253, 253, 253, 253, 253, 253,
+	253, 253, 253, 253, 253, 253, 253, 253, 253, 253, 253, 253,
+	253, 253, 253, 253, 253, 253, 253, 253, 253, 253, 253,   3,
+	239, 240, 241, 242, 243, 244, 245, 246, 247, 248, 249, 250,
+	251, 252, 253, 253
+};
+/* McFarland: overhang with the inflection */
+static const int s_iZigMFInfl = 204;
+/*-------------- END generated by genzigtables.c, do not edit --------------*/
+
+/* Table-driven wedge test (ZIGNORW, ZIGNOR1W) for x in the wedge of 
+   layer i >= 1, i.e. s_adZigX[i + 1] <= |x| < s_adZigX[i].
+
+   The ZIGNOR wedge test f1 + U * (f0 - f1) < 1, with f0 and f1 the 
+   density at s_adZigX[i] and s_adZigX[i + 1] relative to f(x), is
+   equivalent to y < f(x), with y = F[i + 1] + U * (F[i] - F[i + 1]) and
+   F = s_adZigF. Writing f(x) = F[i] * exp(d) = F[i + 1] * exp(-e), with
+   d = (X[i]^2 - x^2) / 2 >= 0 and e = (x^2 - X[i + 1]^2) / 2 >= 0, the
+   quadratic Taylor bounds exp(d) >= 1 + d + d^2/2 and 
+   exp(-e) <= 1 - e + e^2/2 accept or reject most candidates without
+   evaluating exp(). Only candidates between the bounds need the single
+   exp(-x^2/2). */
+static inline __attribute__((always_inline)) 
+int     ZigNorWedgeTable(RANSTATE *pRan, DRANFUN_R fnDRan, uint32_t i, 
+                         double x)
 {
-	int i;	double f;
+	double y, d, e;
 	
-	f = exp(-0.5 * dR * dR);
-	s_adZigX[0] = dV / f; /* [0] is bottom block: V / f(R) */
-	s_adZigX[1] = dR;
-	s_adZigX[iC] = 0;
-
-	for (i = 2; i < iC; ++i)
-	{
-		s_adZigX[i] = sqrt(-2 * log(dV / s_adZigX[i - 1] + f));
-		f = exp(-0.5 * s_adZigX[i] * s_adZigX[i]);
-	}
-	for (i = 0; i < iC; ++i)
-		s_adZigR[i] = s_adZigX[i + 1] / s_adZigX[i];
+	ZIGSTATS_ADD(pRan, uDRan, 1);
+	y = s_adZigF[i + 1] + fnDRan(pRan) * (s_adZigF[i] - s_adZigF[i + 1]);
+	d = 0.5 * (s_adZigX[i] * s_adZigX[i] - x * x);
+	if (y < s_adZigF[i] * (1 + d * (1 + 0.5 * d)))
+		return 1;
+	e = 0.5 * (x * x - s_adZigX[i + 1] * s_adZigX[i + 1]);
+	if (y >= s_adZigF[i + 1] * (1 - e * (1 - 0.5 * e)))
+		return 0;
+	ZIGSTATS_ADD(pRan, uExp, 1);
+	return y < exp(-0.5 * x * x);
 }
 
-double  DRanNormalZig(void)
+/* Exponential ziggurat
+
+   The same construction as ZIGNOR, for the density exp(-x), x >= 0, with
+   256 layers (Marsaglia & Tsang, 2000). Each candidate takes the uniform
+   u in [0, 1) from the upper 53 bits of a single 64-bit number w, and the 
+   layer index from bits 3-10. The wedge test is table-driven, as in 
+   ZigNorWedgeTable. The exponential distribution is memoryless, so the 
+   tail beyond R is R plus a new exponential variate.
+*/
+static inline __attribute__((always_inline)) 
+double  DRanExpZig_inline(RANSTATE *pRan, U64RANFUN_R fnU64Ran, 
+                          DRANFUN_R fnDRan)
 {
+	uint64_t w;
 	uint32_t i;
-	double x, u, f0, f1;
+	double x, u, y, d, e, dOffset = 0;
 	
+	ZIGSTATS_ADD(pRan, uExpZig, 1);
 	for (;;)
 	{
-		u = 2 * DRanU() - 1;
-		i = U32RanU() & 0x7F;
-		/* first try the rectangular boxes */
-		if (fabs(u) < s_adZigR[i])		 
-			return u * s_adZigX[i];
-		/* bottom box: sample from the tail */
-		if (i == 0)						
-			return DRanNormalTail(ZIGNOR_R, u < 0);
-		/* is this a sample from the wedges? */
-		x = u * s_adZigX[i];		   
+		w = fnU64Ran(pRan);
+		u = (w >> 11) * 0x1.0p-53;
+		i = (uint32_t)(w >> 3) & 0xFF;
+		ZIGSTATS_ADD(pRan, uU64Ran, 1);
+		if (u < s_adZigExpR[i])
+			return dOffset + u * s_adZigExpX[i];
+		if (i == 0)
+		{
+			dOffset += ZIGEXP_R;
+			continue;
+		}
+		/* wedge: accept if y < exp(-x), see ZigNorWedgeTable */
+		x = u * s_adZigExpX[i];
+		ZIGSTATS_ADD(pRan, uDRan, 1);
+		y = s_adZigExpF[i + 1] 
+		    + fnDRan(pRan) * (s_adZigExpF[i] - s_adZigExpF[i + 1]);
+		d = s_adZigExpX[i] - x;
+		if (y < s_adZigExpF[i] * (1 + d * (1 + 0.5 * d)))
+			return dOffset + x;
+		e = x - s_adZigExpX[i + 1];
+		if (y >= s_adZigExpF[i + 1] * (1 - e * (1 - 0.5 * e)))
+			continue;
+		ZIGSTATS_ADD(pRan, uExp, 1);
+		if (y < exp(-x))
+			return dOffset + x;
+	}
+}
+
+/* Normal tail beyond dMin (ZIGNORX): Marsaglia's method as in 
+   DRanNormalTail, with the exponential variates -log(U) taken from the
+   exponential ziggurat. The tail is rare, so the RNG is called through
+   the RANSTATE pointers. */
+static double DRanNormalTailExp(RANSTATE *pRan, double dMin, int iNegative)
+{
+	double x, y;
+	ZIGSTATS_ADD(pRan, uTail, 1);
+	do
+	{	x = DRanExpZig_inline(pRan, pRan->fnU64Ranu, pRan->fnDRanu) / dMin;
+		y = DRanExpZig_inline(pRan, pRan->fnU64Ranu, pRan->fnDRanu);
+		ZIGSTATS_ADD(pRan, uTailIter, 1);
+	} while (2 * y < x * x);
+	return iNegative ? -dMin - x : dMin + x;
+}
+
+/* The ziggurat algorithm proper, drawing uniform random numbers from the
+   functions fnDRan and fnU32Ran. It is always inlined, so that the bulk
+   generation routines (section G), which pass the functions of a specific
+   RNG, call these directly instead of through the RANSTATE pointers. 
+   iZig selects the table-driven wedge test (ZigNorWedgeTable, ZIGNORW)
+   and the exponential-ziggurat tail (DRanNormalTailExp, ZIGNORX). */
+static inline __attribute__((always_inline)) 
+double  DRanNormalZig_inline(RANSTATE *pRan, DRANFUN_R fnDRan, 
+                             U32RANFUN_R fnU32Ran, int iZig)
+{
+	uint32_t i;
+	double x, u, f0, f1;
+	
+	ZIGSTATS_ADD(pRan, uNormals, 1);
+	for (;;)
+	{
+		u = 2 * fnDRan(pRan) - 1;
+		i = fnU32Ran(pRan) & 0x7F;
+		ZIGSTATS_ADD(pRan, uDRan, 1);
+		ZIGSTATS_ADD(pRan, uU32Ran, 1);
+		/* first try the rectangular boxes */
+		if (fabs(u) < s_adZigR[i])		 
+		{
+			ZIGSTATS_ADD(pRan, uRectAccept, 1);
+			return u * s_adZigX[i];
+		}
+		/* bottom box: sample from the tail */
+		if (i == 0)						
+		{
+			if (iZig & RANZIG_ZIGNORX)
+				return DRanNormalTailExp(pRan, ZIGNOR_R, u < 0);
+			return DRanNormalTail(pRan, fnDRan, ZIGNOR_R, u < 0);
+		}
+		/* is this a sample from the wedges? */
+		x = u * s_adZigX[i];		   
+		if (iZig & RANZIG_ZIGNORW)
+		{
+			if (ZigNorWedgeTable(pRan, fnDRan, i, x))
+			{
+				ZIGSTATS_ADD(pRan, uWedgeAccept, 1);
+				return x;
+			}
+			ZIGSTATS_ADD(pRan, uWedgeReject, 1);
+			continue;
+		}
+		f0 = exp(-0.5 * (s_adZigX[i] * s_adZigX[i] - x * x) );
+		f1 = exp(-0.5 * (s_adZigX[i+1] * s_adZigX[i+1] - x * x) );
+		ZIGSTATS_ADD(pRan, uDRan, 1);
+		ZIGSTATS_ADD(pRan, uExp, 2);
+      	if (f1 + fnDRan(pRan) * (f0 - f1) < 1.0)
+		{
+			ZIGSTATS_ADD(pRan, uWedgeAccept, 1);
+			return x;
+		}
+		ZIGSTATS_ADD(pRan, uWedgeReject, 1);
+	}
+}
+
+/* ZIGNOR1: single-draw variant of the above
+
+   ZIGNOR draws a uniform double and a separate 32-bit integer for every
+   candidate, of which only 7 bits are used (the layer index). Here, both
+   come from a single 64-bit number w: the uniform from the upper 53 bits
+   (w >> 11), exactly as DRan does for the 64-bit RNGs, and the layer index
+   from bits 4-10, which are not used by the uniform. (The lowest bits are
+   avoided, since they are the weakest bits of Xoshiro256+.) The wedge and
+   tail are as in ZIGNOR. For the 64-bit RNGs, this halves the number of
+   RNG calls per normal variate. For MWC8222, a 64-bit number consists of
+   two 32-bit outputs, and there is no gain.
+   
+   Unlike DRan, u = -1 (w >> 11 == 0) is not excluded: it is never accepted
+   in the rectangle, and is a valid wedge candidate. iZig selects the
+   wedge test and tail as for DRanNormalZig_inline.
+*/
+static inline __attribute__((always_inline)) 
+double  DRanNormalZig1_inline(RANSTATE *pRan, U64RANFUN_R fnU64Ran, 
+                              DRANFUN_R fnDRan, int iZig)
+{
+	uint64_t w;
+	uint32_t i;
+	double x, u, f0, f1;
+	
+	ZIGSTATS_ADD(pRan, uNormals, 1);
+	for (;;)
+	{
+		w = fnU64Ran(pRan);
+		u = 2 * ((w >> 11) * 0x1.0p-53) - 1;
+		i = (uint32_t)(w >> 4) & 0x7F;
+		ZIGSTATS_ADD(pRan, uU64Ran, 1);
+		if (fabs(u) < s_adZigR[i])		 
+		{
+			ZIGSTATS_ADD(pRan, uRectAccept, 1);
+			return u * s_adZigX[i];
+		}
+		if (i == 0)						
+		{
+			if (iZig & RANZIG_ZIGNORX)
+				return DRanNormalTailExp(pRan, ZIGNOR_R, u < 0);
+			return DRanNormalTail(pRan, fnDRan, ZIGNOR_R, u < 0);
+		}
+		x = u * s_adZigX[i];		   
+		if (iZig & RANZIG_ZIGNORW)
+		{
+			if (ZigNorWedgeTable(pRan, fnDRan, i, x))
+			{
+				ZIGSTATS_ADD(pRan, uWedgeAccept, 1);
+				return x;
+			}
+			ZIGSTATS_ADD(pRan, uWedgeReject, 1);
+			continue;
+		}
 		f0 = exp(-0.5 * (s_adZigX[i] * s_adZigX[i] - x * x) );
 		f1 = exp(-0.5 * (s_adZigX[i+1] * s_adZigX[i+1] - x * x) );
-      	if (f1 + DRanU() * (f0 - f1) < 1.0)
+		ZIGSTATS_ADD(pRan, uDRan, 1);
+		ZIGSTATS_ADD(pRan, uExp, 2);
+      	if (f1 + fnDRan(pRan) * (f0 - f1) < 1.0)
+		{
+			ZIGSTATS_ADD(pRan, uWedgeAccept, 1);
+			return x;
+		}
+		ZIGSTATS_ADD(pRan, uWedgeReject, 1);
+	}
+}
+
+/* McFarland's modified ziggurat
+
+   C. D. McFarland, J. Stat. Comput. Simul. 2016, 86, 1281 (see README).
+   The area under f(x) = exp(-x^2/2), x >= 0, is divided into 256 parts of
+   equal area A. 253 of these are rectangles [0, X_k] x [f(X_(k-1)), f(X_k)]
+   (with f(X_-1) = 0), which lie entirely under the curve. Most variates
+   (253/256 = 98.8 %) are therefore obtained from a single 64-bit number w, 
+   without any test: the rectangle from the upper 8 bits, and a signed
+   uniform from the lower 56 bits. As in ZIGNOR1 and the exponential 
+   ziggurat, the index is not taken from the lowest bits, which are the
+   weakest bits of Xoshiro256+ and Lehmer64.
+   
+   The remaining 3 parts are the overhangs between the rectangles and the
+   curve, and the tail beyond X_0 = R. The region is selected with an 
+   alias table (Walker), in proportion to its area. A point is sampled
+   uniformly in the bounding box of the overhang, in coordinates (a, b) in
+   the unit square, for which the chord between the corners is b = 1 - a.
+   In the convex overhangs (x > 1), points above the chord are reflected 
+   to below the chord, and points further below the chord than the 
+   largest distance of the curve from the chord are accepted without 
+   evaluating exp(). In the concave overhangs (x < 1), points below the 
+   chord are accepted directly, and points too far above it are rejected.
+   These tests are integer comparisons on the 63-bit coordinates. The
+   tail uses Marsaglia's method with the exponential ziggurat.
+   
+   The tables are generated by genzigtables.c. X_k is found by bisection
+   from X_k (f(X_k) - f(X_(k-1))) = A; with A = sqrt(pi/2) / 256, exactly 
+   253 rectangles fit.
+*/
+static inline __attribute__((always_inline)) 
+double  DRanNormalZigMF_inline(RANSTATE *pRan, U64RANFUN_R fnU64Ran, 
+                               DRANFUN_R fnDRan)
+{
+	const uint64_t uOne = (uint64_t)1 << 63;
+	const uint64_t uMask56 = ((uint64_t)1 << 56) - 1;
+	uint64_t w, w2, u1, u2;
+	uint32_t i, j;
+	double x, y;
+	
+	ZIGSTATS_ADD(pRan, uNormals, 1);
+	w = fnU64Ran(pRan);
+	i = (uint32_t)(w >> 56);
+	ZIGSTATS_ADD(pRan, uU64Ran, 1);
+	if (i < ZIGMF_L)
+	{
+		ZIGSTATS_ADD(pRan, uRectAccept, 1);
+		return s_adZigMFXs[i] * (double)((int64_t)(w << 8) >> 8);
+	}
+	
+	/* overhang or tail, with alias table; sign from bit 55 of w, the sign
+	   bit of the signed uniform */
+	w2 = fnU64Ran(pRan);
+	ZIGSTATS_ADD(pRan, uU64Ran, 1);
+	j = (uint32_t)(w2 >> 56);
+	if ((w2 & uMask56) >= s_auZigMFThr[j])
+		j = s_aucZigMFAlias[j];
+	
+	if (j == 0)
+	{
+		ZIGSTATS_ADD(pRan, uTail, 1);
+		do
+		{	x = DRanExpZig_inline(pRan, fnU64Ran, fnDRan) / ZIGMF_R;
+			y = DRanExpZig_inline(pRan, fnU64Ran, fnDRan);
+			ZIGSTATS_ADD(pRan, uTailIter, 1);
+		} while (2 * y < x * x);
+		x += ZIGMF_R;
+		return ((w >> 55) & 1) ? -x : x;
+	}
+	
+	/* overhang j: point (a, b) = (u1, u2) * 2^-63 in the unit square */
+	for (;;)
+	{
+		u1 = fnU64Ran(pRan) >> 1;
+		u2 = fnU64Ran(pRan) >> 1;
+		ZIGSTATS_ADD(pRan, uU64Ran, 2);
+		if ((j < (uint32_t)s_iZigMFInfl) && (u1 + u2 > uOne))
+		{
+			/* convex: reflect to below the chord */
+			u1 = uOne - u1;
+			u2 = uOne - u2;
+		}
+		x = s_adZigMFX[j] + u1 * 0x1.0p-63 * (s_adZigMFX[j - 1] - s_adZigMFX[j]);
+		if (j < (uint32_t)s_iZigMFInfl)
+		{
+			if ((int64_t)(uOne - u1 - u2) > s_aiZigMFE[j])
+				break;
+		}
+		else if (j > (uint32_t)s_iZigMFInfl)
+		{
+			/* concave: below the chord is under the curve */
+			if (u1 + u2 <= uOne)
+				break;
+			if ((int64_t)(u1 + u2 - uOne) > s_aiZigMFE[j])
+			{
+				ZIGSTATS_ADD(pRan, uWedgeReject, 1);
+				continue;
+			}
+		}
+		y = s_adZigMFF[j - 1] + u2 * 0x1.0p-63 * (s_adZigMFF[j] - s_adZigMFF[j - 1]);
+		ZIGSTATS_ADD(pRan, uExp, 1);
+		if (y < exp(-0.5 * x * x))
+			break;
+		ZIGSTATS_ADD(pRan, uWedgeReject, 1);
+	}
+	ZIGSTATS_ADD(pRan, uWedgeAccept, 1);
+	return ((w >> 55) & 1) ? -x : x;
+}
+
+double  DRanNormalZig_r(RANSTATE *pRan)
+{
+	int iZig = pRan->iZig;
+	
+	if ((pRan->pAsync != NULL) && RanAsyncIsNormal(pRan->pAsync))
+		return RanAsyncRead(pRan->pAsync);
+	if (iZig & RANZIG_MCFARLAND)
+		return DRanNormalZigMF_inline(pRan, pRan->fnU64Ranu, pRan->fnDRanu);
+	if (iZig & RANZIG_ZIGNOR1)
+		return DRanNormalZig1_inline(pRan, pRan->fnU64Ranu, pRan->fnDRanu,
+		                             iZig);
+	return DRanNormalZig_inline(pRan, pRan->fnDRanu, pRan->fnU32Ranu, iZig);
+}
+
+double  DRanNormalZig(void)
+{
+	return DRanNormalZig_r(&s_ranDefault);
+}
+
+/* Select the normal algorithm by name: "ZIGNOR" (default), followed by
+   the options "1" (single draw), "W" (table-driven wedge test) and "X"
+   (exponential-ziggurat tail), in that order, e.g. "ZIGNOR1W", "ZIGNORX"
+   or "ZIGNOR1WX", or "MCFARLAND". An unknown name selects ZIGNOR. The
+   generator state is not affected. */
+void    RanSetZig_r(RANSTATE *pRan, const char *sZig)
+{
+	int iZig = RANZIG_ZIGNOR;
+	
+	RanAsyncEnd(pRan);
+	if (strcmp(sZig, "MCFARLAND") == 0)
+	{
+		pRan->iZig = RANZIG_MCFARLAND;
+		return;
+	}
+	if (strncmp(sZig, "ZIGNOR", 6) == 0)
+	{
+		sZig += 6;
+		if (*sZig == '1')
+		{
+			iZig |= RANZIG_ZIGNOR1;
+			sZig++;
+		}
+		if (*sZig == 'W')
+		{
+			iZig |= RANZIG_ZIGNORW;
+			sZig++;
+		}
+		if (*sZig == 'X')
+		{
+			iZig |= RANZIG_ZIGNORX;
+			sZig++;
+		}
+	}
+	pRan->iZig = (*sZig == '\0') ? iZig : RANZIG_ZIGNOR;
+}
+
+void    RanSetZig(const char *sZig)
+{
+	RanSetZig_r(&s_ranDefault, sZig);
+}
+
+/* Exponentially distributed random number with mean 1 */
+double  DRanExpZig_r(RANSTATE *pRan)
+{
+	return DRanExpZig_inline(pRan, pRan->fnU64Ranu, pRan->fnDRanu);
+}
+
+double  DRanExpZig(void)
+{
+	return DRanExpZig_r(&s_ranDefault);
+}
+
+/* Single precision ziggurat (FRanNormalZig)
+
+   ZIGNOR with the tables in single precision (s_afZigX, s_afZigR, 
+   s_afZigF), and a single 32-bit half (see U32RanHalf_inline) per 
+   candidate: the layer index from its upper 7 bits, and a signed 
+   uniform u in [-1, 1) with 25-bit resolution from its lower 25 bits,
+   which is exactly representable as a float. As in ZIGNOR1, the index
+   is not taken from the lowest bits, which are the weakest bits of 
+   Xoshiro256+ (in the lower half). The wedge test is
+   table-driven, as in ZigNorWedgeTable, and the tail uses Marsaglia's
+   method, with uniform floats. The choice of the double precision 
+   algorithm (RanSetZig) does not apply. */
+static float FRanNormalTail(RANSTATE *pRan, float fMin, int iNegative)
+{
+	float x, y;
+	do
+	{	x = logf(FRan_inline(pRan, pRan->fnU64Ranu)) / fMin;
+		y = logf(FRan_inline(pRan, pRan->fnU64Ranu));
+	} while (-2 * y < x * x);
+	return iNegative ? x - fMin : fMin - x;
+}
+
+/* h is the first candidate, already drawn by the caller */
+static inline __attribute__((always_inline)) 
+float   FRanNormalZig_inline(RANSTATE *pRan, U64RANFUN_R fnU64Ran, uint32_t h)
+{
+	uint32_t i;
+	float u, x, y, d, e;
+	
+	for (;; h = U32RanHalf_inline(pRan, fnU64Ran))
+	{
+		i = h >> 25;
+		u = (float)((int32_t)(h << 7) >> 7) * 0x1.0p-24f;
+		if (fabsf(u) < s_afZigR[i])
+			return u * s_afZigX[i];
+		if (i == 0)
+			return FRanNormalTail(pRan, (float)ZIGNOR_R, u < 0);
+		x = u * s_afZigX[i];
+		y = s_afZigF[i + 1] 
+		    + FRan_inline(pRan, fnU64Ran) * (s_afZigF[i] - s_afZigF[i + 1]);
+		d = 0.5f * (s_afZigX[i] * s_afZigX[i] - x * x);
+		if (y < s_afZigF[i] * (1 + d * (1 + 0.5f * d)))
 			return x;
+		e = 0.5f * (x * x - s_afZigX[i + 1] * s_afZigX[i + 1]);
+		if (y >= s_afZigF[i + 1] * (1 - e * (1 - 0.5f * e)))
+			continue;
+		if (y < expf(-0.5f * x * x))
+			return x;
+	}
+}
+
+float   FRanNormalZig_r(RANSTATE *pRan)
+{
+	return FRanNormalZig_inline(pRan, pRan->fnU64Ranu, 
+	                            U32RanHalf_inline(pRan, pRan->fnU64Ranu));
+}
+
+float   FRanNormalZig(void)
+{
+	return FRanNormalZig_r(&s_ranDefault);
+}
+/*--------------------------- END General Ziggurat -------------------------*/
+
+
+/*==========================================================================*/
+
+
+/*==========================================================================
+ *  Bulk generation
+ *  M. H. V. Werts, 2025
+ *
+ *  Filling of arrays with uniform doubles, raw 32-bit or 64-bit unsigned
+ *  integers, or normally distributed doubles. Each uniform RNG has its own
+ *  set of inner loops, in which the RNG routines are called directly, so
+ *  that they can be inlined by the compiler, instead of going through the
+ *  function pointers in RANSTATE for every single number. The resulting
+ *  arrays are identical to those obtained with successive calls to the 
+ *  scalar functions DRanU, U32RanU, U64RanU and DRanNormalZig.
+ *
+ *  RanFillNormalParallel fills large arrays of normal variates on several
+ *  threads, in chunks generated by jumped copies of the generator.
+ *==========================================================================*/
+
+/* Generic inner loops, calling the routines of RNG 'name' directly */
+#define RAN_VEC_UNIFORM(name)                                                 \
+static void DRanUVec_##name(RANSTATE *pRan, double *pdOut, size_t n)         \
+{                                                                             \
+	size_t k;                                                                 \
+	for (k = 0; k < n; ++k)                                                   \
+		pdOut[k] = DRan_##name(pRan);                                         \
+}                                                                             \
+static void U64RanUVec_##name(RANSTATE *pRan, uint64_t *puOut, size_t n)     \
+{                                                                             \
+	size_t k;                                                                 \
+	for (k = 0; k < n; ++k)                                                   \
+		puOut[k] = U64Ran_##name(pRan);                                       \
+}
+
+#define RAN_VEC_U32(name)                                                     \
+static void U32RanUVec_##name(RANSTATE *pRan, uint32_t *puOut, size_t n)     \
+{                                                                             \
+	size_t k;                                                                 \
+	for (k = 0; k < n; ++k)                                                   \
+		puOut[k] = U32Ran_##name(pRan);                                       \
+}
+
+#define RAN_VEC_NORMAL(name)                                                  \
+static void DRanNormalZigVec_##name(RANSTATE *pRan, double *pdOut, size_t n) \
+{                                                                             \
+	size_t k;                                                                 \
+	int iZig = pRan->iZig;                                                    \
+	if (iZig & RANZIG_MCFARLAND)                                              \
+	{                                                                         \
+		for (k = 0; k < n; ++k)                                               \
+			pdOut[k] = DRanNormalZigMF_inline(pRan, U64Ran_##name,            \
+			                                  DRan_##name);                   \
+		return;                                                               \
+	}                                                                         \
+	if (iZig & RANZIG_ZIGNOR1)                                                \
+	{                                                                         \
+		for (k = 0; k < n; ++k)                                               \
+			pdOut[k] = DRanNormalZig1_inline(pRan, U64Ran_##name, DRan_##name,\
+			                                 iZig);                           \
+		return;                                                               \
+	}                                                                         \
+	for (k = 0; k < n; ++k)                                                   \
+		pdOut[k] = DRanNormalZig_inline(pRan, DRan_##name, U32Ran_##name,     \
+		                                iZig);                                \
+}
+
+
+/* Batched ziggurat for the multi-lane Xoshiro256+ engines
+
+   For the 64-bit RNGs, every uniform double (DRan) and every 32-bit 
+   integer (U32Ran) is obtained from a single raw 64-bit number, as
+   xx * 2^-53 with xx = raw >> 11 (rejecting xx == 0), and as raw >> 32,
+   respectively. Each candidate of the ziggurat is thus a pair of
+   successive raw numbers, giving u = 2 * DRan - 1 and i = U32Ran & 0x7F.
+   
+   Starting from the current position in a block of raw numbers, a SIMD
+   kernel evaluates the rectangle test for successive candidates (4 with
+   AVX2, 8 with AVX-512), gathering s_adZigR[i] and s_adZigX[i], and 
+   accepts all candidates up to the first one that fails. That candidate
+   is handled by the scalar ziggurat, drawing from the same block, which 
+   generally consumes a data-dependent number of raw numbers (wedge or
+   tail). The SIMD kernel then continues from the new position. 
+   Candidates after a failing one cannot be used, as the candidates 
+   following the scalar step are no longer aligned with them. The output
+   is therefore identical to that of successive calls to DRanNormalZig.
+   
+   This is only used with the multi-lane engines, which generate the raw
+   numbers into their output buffer anyway. For the other RNGs, generating
+   blocks of raw numbers first was found to be slower than the inline 
+   loop of RAN_VEC_NORMAL, in which the (latency bound) generation of the
+   raw numbers overlaps with the ziggurat.
+*/
+
+/* Rectangle test for successive candidates from nRaw raw numbers puRaw.
+   Writes the accepted variates to pdOut (at most nMax), and returns their
+   number m, stopping at the first candidate that fails, or at the end of 
+   the raw numbers. 2 * m raw numbers have been used. 
+   
+   The SIMD kernels are compiled for each instruction set, and selected by
+   iIsa (see RanSetIsa). The candidates that remain after the SIMD kernel
+   are tested one by one, starting from candidate m. */
+static inline __attribute__((always_inline))
+size_t ZigNorAcceptRaw64_rest(const uint64_t *puRaw, size_t nRaw,
+                              double *pdOut, size_t nMax, size_t m)
+{
+	uint64_t xx;
+	uint32_t i;
+	double u;
+	
+	/* remaining candidates (all candidates with RANISA_SCALAR) */
+	while ((m < nMax) && (2 * m + 2 <= nRaw))
+	{
+		xx = puRaw[2 * m] >> 11;
+		i = (uint32_t)(puRaw[2 * m + 1] >> 32) & 0x7F;
+		u = 2 * (xx * 0x1.0p-53) - 1;
+		if ((xx == 0) || !(fabs(u) < s_adZigR[i]))
+			break;
+		pdOut[m++] = u * s_adZigX[i];
+	}
+	return m;
+}
+
+#ifdef RANDOMMW_DISPATCH
+/* (g++ 12 warns about the AVX-512 intrinsics themselves) */
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wmaybe-uninitialized"
+RANDOMMW_TARGET_AVX512
+static size_t ZigNorAcceptRaw64_avx512(const uint64_t *puRaw, size_t nRaw,
+                                       double *pdOut, size_t nMax)
+{
+	size_t m = 0;
+	const __m512i vEven = _mm512_set_epi64(14, 12, 10, 8, 6, 4, 2, 0);
+	const __m512i vOdd = _mm512_set_epi64(15, 13, 11, 9, 7, 5, 3, 1);
+	const __m512i vMask = _mm512_set1_epi64(0x7F);
+	const __m512d vScale = _mm512_set1_pd(0x1.0p-53);
+	const __m512d vTwo = _mm512_set1_pd(2.0), vOne = _mm512_set1_pd(1.0);
+	
+	while ((m + 8 <= nMax) && (2 * m + 16 <= nRaw))
+	{
+		__m512i r0 = _mm512_loadu_si512(puRaw + 2 * m);
+		__m512i r1 = _mm512_loadu_si512(puRaw + 2 * m + 8);
+		__m512i vxx = _mm512_srli_epi64(_mm512_permutex2var_epi64(r0, vEven, r1), 11);
+		__m512i vi = _mm512_and_si512(_mm512_srli_epi64(
+		             _mm512_permutex2var_epi64(r0, vOdd, r1), 32), vMask);
+		__m512d vu = _mm512_sub_pd(_mm512_mul_pd(vTwo, 
+		             _mm512_mul_pd(_mm512_cvtepu64_pd(vxx), vScale)), vOne);
+		__m512d vR = _mm512_i64gather_pd(vi, s_adZigR, 8);
+		__m512d vX = _mm512_i64gather_pd(vi, s_adZigX, 8);
+		__mmask8 acc = _mm512_cmp_pd_mask(_mm512_abs_pd(vu), vR, _CMP_LT_OQ)
+		               & _mm512_test_epi64_mask(vxx, vxx);
+		
+		_mm512_storeu_pd(pdOut + m, _mm512_mul_pd(vu, vX));
+		if (acc != 0xFF)
+		{
+			m += __builtin_ctz(~(unsigned int)acc);
+			return m;
+		}
+		m += 8;
+	}
+	return ZigNorAcceptRaw64_rest(puRaw, nRaw, pdOut, nMax, m);
+}
+#pragma GCC diagnostic pop
+
+RANDOMMW_TARGET_AVX2
+static size_t ZigNorAcceptRaw64_avx2(const uint64_t *puRaw, size_t nRaw,
+                                     double *pdOut, size_t nMax)
+{
+	size_t m = 0;
+	const __m256i vMask = _mm256_set1_epi64x(0x7F);
+	const __m256i vHi = _mm256_set1_epi64x(0x4530000000000000LL);
+	const __m256i vLo = _mm256_set1_epi64x(0x4330000000000000LL);
+	const __m256i vLoMask = _mm256_set1_epi64x(0xFFFFFFFFLL);
+	const __m256d vHiSub = _mm256_set1_pd(0x1.0p84), vLoSub = _mm256_set1_pd(0x1.0p52);
+	const __m256d vScale = _mm256_set1_pd(0x1.0p-53);
+	const __m256d vTwo = _mm256_set1_pd(2.0), vOne = _mm256_set1_pd(1.0);
+	const __m256d vAbs = _mm256_castsi256_pd(_mm256_set1_epi64x(0x7FFFFFFFFFFFFFFFLL));
+	
+	while ((m + 4 <= nMax) && (2 * m + 8 <= nRaw))
+	{
+		__m256i r0 = _mm256_loadu_si256((const __m256i *)(puRaw + 2 * m));
+		__m256i r1 = _mm256_loadu_si256((const __m256i *)(puRaw + 2 * m + 4));
+		/* even and odd raw numbers, in order */
+		__m256i vxx = _mm256_srli_epi64(_mm256_permute4x64_epi64(
+		              _mm256_unpacklo_epi64(r0, r1), 0xD8), 11);
+		__m256i vi = _mm256_and_si256(_mm256_srli_epi64(_mm256_permute4x64_epi64(
+		             _mm256_unpackhi_epi64(r0, r1), 0xD8), 32), vMask);
+		/* exact conversion of xx < 2^53 to double (see section B) */
+		__m256d vdh = _mm256_sub_pd(_mm256_castsi256_pd(_mm256_or_si256(
+		              _mm256_srli_epi64(vxx, 32), vHi)), vHiSub);
+		__m256d vdl = _mm256_sub_pd(_mm256_castsi256_pd(_mm256_or_si256(
+		              _mm256_and_si256(vxx, vLoMask), vLo)), vLoSub);
+		__m256d vu = _mm256_sub_pd(_mm256_mul_pd(vTwo, 
+		             _mm256_mul_pd(_mm256_add_pd(vdh, vdl), vScale)), vOne);
+		__m256d vR = _mm256_i64gather_pd(s_adZigR, vi, 8);
+		__m256d vX = _mm256_i64gather_pd(s_adZigX, vi, 8);
+		__m256d vacc = _mm256_and_pd(
+		               _mm256_cmp_pd(_mm256_and_pd(vu, vAbs), vR, _CMP_LT_OQ),
+		               _mm256_castsi256_pd(_mm256_xor_si256(_mm256_cmpeq_epi64(
+		               vxx, _mm256_setzero_si256()), _mm256_set1_epi64x(-1))));
+		int acc = _mm256_movemask_pd(vacc);
+		
+		_mm256_storeu_pd(pdOut + m, _mm256_mul_pd(vu, vX));
+		if (acc != 0xF)
+		{
+			m += __builtin_ctz(~(unsigned int)acc);
+			return m;
+		}
+		m += 4;
+	}
+	return ZigNorAcceptRaw64_rest(puRaw, nRaw, pdOut, nMax, m);
+}
+#endif
+
+static size_t ZigNorAcceptRaw64(int iIsa, const uint64_t *puRaw, size_t nRaw,
+                                double *pdOut, size_t nMax)
+{
+#ifdef RANDOMMW_DISPATCH
+	if (iIsa == RANISA_AVX512)
+		return ZigNorAcceptRaw64_avx512(puRaw, nRaw, pdOut, nMax);
+	if (iIsa == RANISA_AVX2)
+		return ZigNorAcceptRaw64_avx2(puRaw, nRaw, pdOut, nMax);
+#else
+	(void)iIsa;
+#endif
+	return ZigNorAcceptRaw64_rest(puRaw, nRaw, pdOut, nMax, 0);
+}
+
+/* As ZigNorAcceptRaw64, for ZIGNOR1: one raw number per candidate, with
+   the uniform from bits 11-63 and the layer index from bits 4-10 (see
+   DRanNormalZig1_inline). m raw numbers have been used. nEnd is the 
+   smaller of nRaw and nMax. */
+static inline __attribute__((always_inline))
+size_t ZigNor1AcceptRaw64_rest(const uint64_t *puRaw, size_t nEnd,
+                               double *pdOut, size_t m)
+{
+	uint64_t w;
+	uint32_t i;
+	double u;
+	
+	while (m < nEnd)
+	{
+		w = puRaw[m];
+		i = (uint32_t)(w >> 4) & 0x7F;
+		u = 2 * ((w >> 11) * 0x1.0p-53) - 1;
+		if (!(fabs(u) < s_adZigR[i]))
+			break;
+		pdOut[m++] = u * s_adZigX[i];
+	}
+	return m;
+}
+
+#ifdef RANDOMMW_DISPATCH
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wmaybe-uninitialized"
+RANDOMMW_TARGET_AVX512
+static size_t ZigNor1AcceptRaw64_avx512(const uint64_t *puRaw, size_t nEnd,
+                                        double *pdOut)
+{
+	size_t m = 0;
+	const __m512i vMask = _mm512_set1_epi64(0x7F);
+	const __m512d vScale = _mm512_set1_pd(0x1.0p-53);
+	const __m512d vTwo = _mm512_set1_pd(2.0), vOne = _mm512_set1_pd(1.0);
+	
+	while (m + 8 <= nEnd)
+	{
+		__m512i r = _mm512_loadu_si512(puRaw + m);
+		__m512i vi = _mm512_and_si512(_mm512_srli_epi64(r, 4), vMask);
+		__m512d vu = _mm512_sub_pd(_mm512_mul_pd(vTwo, _mm512_mul_pd(
+		             _mm512_cvtepu64_pd(_mm512_srli_epi64(r, 11)), vScale)), vOne);
+		__m512d vR = _mm512_i64gather_pd(vi, s_adZigR, 8);
+		__m512d vX = _mm512_i64gather_pd(vi, s_adZigX, 8);
+		__mmask8 acc = _mm512_cmp_pd_mask(_mm512_abs_pd(vu), vR, _CMP_LT_OQ);
+		
+		_mm512_storeu_pd(pdOut + m, _mm512_mul_pd(vu, vX));
+		if (acc != 0xFF)
+		{
+			m += __builtin_ctz(~(unsigned int)acc);
+			return m;
+		}
+		m += 8;
+	}
+	return ZigNor1AcceptRaw64_rest(puRaw, nEnd, pdOut, m);
+}
+#pragma GCC diagnostic pop
+
+RANDOMMW_TARGET_AVX2
+static size_t ZigNor1AcceptRaw64_avx2(const uint64_t *puRaw, size_t nEnd,
+                                      double *pdOut)
+{
+	size_t m = 0;
+	const __m256i vMask = _mm256_set1_epi64x(0x7F);
+	const __m256i vHi = _mm256_set1_epi64x(0x4530000000000000LL);
+	const __m256i vLo = _mm256_set1_epi64x(0x4330000000000000LL);
+	const __m256i vLoMask = _mm256_set1_epi64x(0xFFFFFFFFLL);
+	const __m256d vHiSub = _mm256_set1_pd(0x1.0p84), vLoSub = _mm256_set1_pd(0x1.0p52);
+	const __m256d vScale = _mm256_set1_pd(0x1.0p-53);
+	const __m256d vTwo = _mm256_set1_pd(2.0), vOne = _mm256_set1_pd(1.0);
+	const __m256d vAbs = _mm256_castsi256_pd(_mm256_set1_epi64x(0x7FFFFFFFFFFFFFFFLL));
+	
+	while (m + 4 <= nEnd)
+	{
+		__m256i r = _mm256_loadu_si256((const __m256i *)(puRaw + m));
+		__m256i vxx = _mm256_srli_epi64(r, 11);
+		__m256i vi = _mm256_and_si256(_mm256_srli_epi64(r, 4), vMask);
+		__m256d vdh = _mm256_sub_pd(_mm256_castsi256_pd(_mm256_or_si256(
+		              _mm256_srli_epi64(vxx, 32), vHi)), vHiSub);
+		__m256d vdl = _mm256_sub_pd(_mm256_castsi256_pd(_mm256_or_si256(
+		              _mm256_and_si256(vxx, vLoMask), vLo)), vLoSub);
+		__m256d vu = _mm256_sub_pd(_mm256_mul_pd(vTwo, 
+		             _mm256_mul_pd(_mm256_add_pd(vdh, vdl), vScale)), vOne);
+		__m256d vR = _mm256_i64gather_pd(s_adZigR, vi, 8);
+		__m256d vX = _mm256_i64gather_pd(s_adZigX, vi, 8);
+		int acc = _mm256_movemask_pd(_mm256_cmp_pd(_mm256_and_pd(vu, vAbs), 
+		                                           vR, _CMP_LT_OQ));
+		
+		_mm256_storeu_pd(pdOut + m, _mm256_mul_pd(vu, vX));
+		if (acc != 0xF)
+		{
+			m += __builtin_ctz(~(unsigned int)acc);
+			return m;
+		}
+		m += 4;
+	}
+	return ZigNor1AcceptRaw64_rest(puRaw, nEnd, pdOut, m);
+}
+#endif
+
+static size_t ZigNor1AcceptRaw64(int iIsa, const uint64_t *puRaw, size_t nRaw,
+                                 double *pdOut, size_t nMax)
+{
+	size_t nEnd = (nMax < nRaw) ? nMax : nRaw;
+	
+#ifdef RANDOMMW_DISPATCH
+	if (iIsa == RANISA_AVX512)
+		return ZigNor1AcceptRaw64_avx512(puRaw, nEnd, pdOut);
+	if (iIsa == RANISA_AVX2)
+		return ZigNor1AcceptRaw64_avx2(puRaw, nEnd, pdOut);
+#else
+	(void)iIsa;
+#endif
+	return ZigNor1AcceptRaw64_rest(puRaw, nEnd, pdOut, 0);
+}
+
+/* Single precision. Uniform floats are converted from both halves of 
+   each 64-bit number directly, after using up a pending lower half; a 
+   zero (rejected) is overwritten by the next number, without a branch. For
+   normal floats, the rectangle test of the candidate in the upper half 
+   is done before the lower half is stored in the generator state, which
+   is only needed if the ziggurat continues beyond the rectangle. */
+#define RAN_VEC_FLOAT(name)                                                   \
+static void FRanUVec_##name(RANSTATE *pRan, float *pfOut, size_t n)          \
+{                                                                             \
+	size_t k = 0;                                                             \
+	uint64_t w;                                                               \
+	uint32_t xx;                                                              \
+	if ((n > 0) && pRan->bHalf)                                               \
+		pfOut[k++] = FRan_inline(pRan, U64Ran_##name);                        \
+	while (k + 1 < n)                                                         \
+	{                                                                         \
+		w = U64Ran_##name(pRan);                                              \
+		xx = (uint32_t)(w >> 40);                                             \
+		pfOut[k] = xx * 0x1.0p-24f;                                           \
+		k += (xx != 0);                                                       \
+		xx = (uint32_t)w >> 8;                                                \
+		pfOut[k] = xx * 0x1.0p-24f;                                           \
+		k += (xx != 0);                                                       \
+	}                                                                         \
+	while (k < n)                                                             \
+		pfOut[k++] = FRan_inline(pRan, U64Ran_##name);                        \
+}                                                                             \
+static void FRanNormalZigVec_##name(RANSTATE *pRan, float *pfOut, size_t n)  \
+{                                                                             \
+	size_t k = 0;                                                             \
+	uint64_t w;                                                               \
+	uint32_t h;                                                               \
+	float u;                                                                  \
+	while (k < n)                                                             \
+	{                                                                         \
+		if (pRan->bHalf)                                                      \
+		{                                                                     \
+			h = U32RanHalf_inline(pRan, U64Ran_##name);                       \
+			pfOut[k++] = FRanNormalZig_inline(pRan, U64Ran_##name, h);        \
+			continue;                                                         \
+		}                                                                     \
+		w = U64Ran_##name(pRan);                                              \
+		h = (uint32_t)(w >> 32);                                              \
+		u = (float)((int32_t)(h << 7) >> 7) * 0x1.0p-24f;                     \
+		if ((k + 1 < n) && (fabsf(u) < s_afZigR[h >> 25]))                    \
+		{                                                                     \
+			pfOut[k++] = u * s_afZigX[h >> 25];                               \
+			h = (uint32_t)w;                                                  \
+		}                                                                     \
+		else                                                                  \
+		{                                                                     \
+			pRan->uiHalf = (uint32_t)w;                                       \
+			pRan->bHalf = 1;                                                  \
+		}                                                                     \
+		pfOut[k++] = FRanNormalZig_inline(pRan, U64Ran_##name, h);            \
+	}                                                                         \
+}
+
+#define RAN_VEC_FUNCTIONS(name)                                               \
+RAN_VEC_UNIFORM(name)                                                         \
+RAN_VEC_U32(name)                                                             \
+RAN_VEC_NORMAL(name)                                                          \
+RAN_VEC_FLOAT(name)
+
+RAN_VEC_FUNCTIONS(MELG19937)
+RAN_VEC_FUNCTIONS(xoshiro256p)
+RAN_VEC_FUNCTIONS(lehmer64)
+RAN_VEC_FUNCTIONS(pcg64dxsm)
+RAN_VEC_FUNCTIONS(MWC8222)
+RAN_VEC_FUNCTIONS(ext)
+
+/* The multi-lane Xoshiro256+ engines write the raw 64-bit numbers 
+   directly into the output array, after emptying their buffer. Uniform 
+   doubles are converted from blocks of raw numbers. Normal variates
+   are obtained with the batched ziggurat, from the output buffer. */
+RAN_VEC_U32(xoshiro256px)
+RAN_VEC_FLOAT(xoshiro256px)
+
+/* Batched ziggurat for an RNG that generates into an output buffer puBuf
+   of nBuf words, with the next word at *piBufi, and that is refilled by 
+   fnRefill when empty (the multi-lane Xoshiro256+ engines and
+   Philox4x32-10). It is always inlined, with the functions of the RNG. */
+static inline __attribute__((always_inline))
+void DRanNormalZigVec_buffered(RANSTATE *pRan, double *pdOut, size_t n,
+                               const uint64_t *puBuf, int *piBufi, int nBuf,
+                               void (*fnRefill)(RANSTATE *),
+                               U64RANFUN_R fnU64Ran, DRANFUN_R fnDRan,
+                               U32RANFUN_R fnU32Ran)
+{
+	size_t k = 0, m;
+	int iZig = pRan->iZig;
+	
+	if (iZig & RANZIG_MCFARLAND)
+	{
+		for (k = 0; k < n; ++k)
+			pdOut[k] = DRanNormalZigMF_inline(pRan, fnU64Ran, fnDRan);
+		return;
+	}
+	if (iZig & RANZIG_ZIGNOR1)
+	{
+		while (k < n)
+		{
+			if (*piBufi == nBuf)
+				fnRefill(pRan);
+			m = ZigNor1AcceptRaw64(pRan->iIsa, puBuf + *piBufi,
+			                       nBuf - *piBufi, pdOut + k, n - k);
+			k += m;
+			*piBufi += m;
+			ZIGSTATS_ADD(pRan, uNormals, m);
+			ZIGSTATS_ADD(pRan, uRectAccept, m);
+			ZIGSTATS_ADD(pRan, uU64Ran, m);
+			if ((k < n) && (*piBufi < nBuf))
+				pdOut[k++] = DRanNormalZig1_inline(pRan, fnU64Ran, fnDRan, 
+				                                   iZig);
+		}
+		return;
+	}
+	
+	while (k < n)
+	{
+		if (*piBufi == nBuf)
+			fnRefill(pRan);
+		m = ZigNorAcceptRaw64(pRan->iIsa, puBuf + *piBufi, nBuf - *piBufi,
+		                      pdOut + k, n - k);
+		k += m;
+		*piBufi += 2 * m;
+		ZIGSTATS_ADD(pRan, uNormals, m);
+		ZIGSTATS_ADD(pRan, uRectAccept, m);
+		ZIGSTATS_ADD(pRan, uDRan, m);
+		ZIGSTATS_ADD(pRan, uU32Ran, m);
+		/* failing (or incomplete) candidate: scalar ziggurat */
+		if ((k < n) && (*piBufi < nBuf))
+			pdOut[k++] = DRanNormalZig_inline(pRan, fnDRan, fnU32Ran, iZig);
+	}
+}
+
+static void DRanNormalZigVec_xoshiro256px(RANSTATE *pRan, double *pdOut, 
+                                          size_t n)
+{
+	DRanNormalZigVec_buffered(pRan, pdOut, n, pRan->xoshiro256px_buf,
+	                          &pRan->xoshiro256px_bufi, XOSHIRO256PX_BUF,
+	                          xoshiro256px_refill, U64Ran_xoshiro256px,
+	                          DRan_xoshiro256px, U32Ran_xoshiro256px);
+}
+
+static void U64RanUVec_xoshiro256px(RANSTATE *pRan, uint64_t *puOut, size_t n)
+{
+	size_t k = 0, nsteps;
+	
+	while ((k < n) && (pRan->xoshiro256px_bufi < XOSHIRO256PX_BUF))
+		puOut[k++] = pRan->xoshiro256px_buf[pRan->xoshiro256px_bufi++];
+	
+	nsteps = (n - k) / pRan->xoshiro256px_lanes;
+	xoshiro256px_generate(pRan, puOut + k, nsteps);
+	k += nsteps * pRan->xoshiro256px_lanes;
+	
+	while (k < n)
+		puOut[k++] = U64Ran_xoshiro256px(pRan);
+}
+
+/* Rejected numbers (see xoshiro256pxL_generate_double) are removed 
+   afterwards, which is rare */
+static void DRanUVec_xoshiro256px(RANSTATE *pRan, double *pdOut, size_t n)
+{
+	size_t k = 0, j, m, nsteps;
+	uint64_t uzero;
+	
+	while ((k < n) && (pRan->xoshiro256px_bufi < XOSHIRO256PX_BUF))
+		pdOut[k++] = DRan_xoshiro256px(pRan);
+	
+	nsteps = (n - k) / pRan->xoshiro256px_lanes;
+	uzero = xoshiro256px_generate_double(pRan, pdOut + k, nsteps);
+	m = k + nsteps * pRan->xoshiro256px_lanes;
+	if (uzero)
+	{
+		for (j = k; j < m; ++j)
+			if (pdOut[j] != 0.0)
+				pdOut[k++] = pdOut[j];
+	}
+	else
+		k = m;
+	
+	while (k < n)
+		pdOut[k++] = DRan_xoshiro256px(pRan);
+}
+
+
+void    DRanUVec_r(RANSTATE *pRan, double *pdOut, size_t n)
+{
+	(*pRan->fnDRanuVec)(pRan, pdOut, n);
+}
+
+void    U32RanUVec_r(RANSTATE *pRan, uint32_t *puOut, size_t n)
+{
+	(*pRan->fnU32RanuVec)(pRan, puOut, n);
+}
+
+void    U64RanUVec_r(RANSTATE *pRan, uint64_t *puOut, size_t n)
+{
+	(*pRan->fnU64RanuVec)(pRan, puOut, n);
+}
+
+void    DRanNormalZigVec_r(RANSTATE *pRan, double *pdOut, size_t n)
+{
+	(*pRan->fnDRanNormalZigVec)(pRan, pdOut, n);
+}
+
+void    FRanUVec_r(RANSTATE *pRan, float *pfOut, size_t n)
+{
+	(*pRan->fnFRanuVec)(pRan, pfOut, n);
+}
+
+void    FRanNormalZigVec_r(RANSTATE *pRan, float *pfOut, size_t n)
+{
+	(*pRan->fnFRanNormalZigVec)(pRan, pfOut, n);
+}
+
+void    DRanUVec(double *pdOut, size_t n)
+{
+	DRanUVec_r(&s_ranDefault, pdOut, n);
+}
+
+void    U32RanUVec(uint32_t *puOut, size_t n)
+{
+	U32RanUVec_r(&s_ranDefault, puOut, n);
+}
+
+void    U64RanUVec(uint64_t *puOut, size_t n)
+{
+	U64RanUVec_r(&s_ranDefault, puOut, n);
+}
+
+void    DRanNormalZigVec(double *pdOut, size_t n)
+{
+	DRanNormalZigVec_r(&s_ranDefault, pdOut, n);
+}
+
+void    FRanUVec(float *pfOut, size_t n)
+{
+	FRanUVec_r(&s_ranDefault, pfOut, n);
+}
+
+void    FRanNormalZigVec(float *pfOut, size_t n)
+{
+	FRanNormalZigVec_r(&s_ranDefault, pfOut, n);
+}
+
+
+/* Instruction set of the SIMD kernels
+
+   The best instruction set supported by the CPU (and the operating 
+   system) is found with __builtin_cpu_supports, which also works where
+   ifunc resolvers (target_clones) are not available, e.g. with MinGW. */
+static int RanIsaBest(void)
+{
+#ifdef RANDOMMW_DISPATCH
+	__builtin_cpu_init();
+	if (__builtin_cpu_supports("avx512f") && __builtin_cpu_supports("avx512dq")
+	    && __builtin_cpu_supports("avx512vl"))
+		return RANISA_AVX512;
+	if (__builtin_cpu_supports("avx2"))
+		return RANISA_AVX2;
+#endif
+	return RANISA_SCALAR;
+}
+
+static const char *s_asIsa[3] = {"SCALAR", "AVX2", "AVX512"};
+
+/* Select the instruction set of the SIMD kernels by name: "SCALAR", 
+   "AVX2" or "AVX512". An empty or unknown name, or an instruction set
+   that is not supported by the CPU, selects the best supported one. The
+   generator state and output are not affected. */
+void    RanSetIsa_r(RANSTATE *pRan, const char *sIsa)
+{
+	int iIsa, iBest = RanIsaBest();
+	
+	RanAsyncEnd(pRan);
+	for (iIsa = iBest; iIsa >= 0; iIsa--)
+		if (strcmp(sIsa, s_asIsa[iIsa]) == 0)
+			break;
+	pRan->iIsa = (iIsa >= 0) ? iIsa : iBest;
+}
+
+void    RanSetIsa(const char *sIsa)
+{
+	RanSetIsa_r(&s_ranDefault, sIsa);
+}
+
+/* Name of the active instruction set, e.g. for benchmark logs */
+const char *RanGetIsa_r(RANSTATE *pRan)
+{
+	return s_asIsa[pRan->iIsa];
+}
+
+const char *RanGetIsa(void)
+{
+	return RanGetIsa_r(&s_ranDefault);
+}
+
+
+/* Parallel filling of large arrays with normal variates
+
+   The array is divided in chunks of nChunk numbers. Chunk c is filled by
+   DRanNormalZigVec_r with a copy of the generator, jumped c times from
+   its current state. Each thread fills a contiguous range of chunks, 
+   jumping its copy once per chunk. The result depends on the RNG, its 
+   state and nChunk, but not on the number of threads. Chunk 0 continues
+   the stream of the generator itself; afterwards, the generator is 
+   jumped once per chunk, so that subsequent numbers are not reused.
+   
+   An external RNG (RanSetRanExt) has no state that can be copied; the
+   array is then filled sequentially by DRanNormalZigVec_r. */
+static int s_nRanThreads = 0;
+
+/* Number of threads used by RanFillNormalParallel (0: all available) */
+void    RanSetThreads(int nThreads)
+{
+	s_nRanThreads = (nThreads > 0) ? nThreads : 0;
+}
+
+static int RanThreadsMax(void)
+{
+	if (s_nRanThreads > 0)
+		return s_nRanThreads;
+#if defined(RANDOMMW_OPENMP)
+	return omp_get_max_threads();
+#elif defined(RANDOMMW_PTHREADS) && defined(_WIN32)
+	return pthread_num_processors_np();
+#elif defined(RANDOMMW_PTHREADS) && defined(_SC_NPROCESSORS_ONLN)
+	{
+		long nProc = sysconf(_SC_NPROCESSORS_ONLN);
+		return (nProc > 0) ? (int)nProc : 1;
+	}
+#else
+	return 1;
+#endif
+}
+
+typedef struct {
+	const RANSTATE *pRan;
+	double *pdOut;
+	size_t n, nChunk;
+	size_t c0, c1;		/* chunks c0 ... c1 - 1 */
+} RANFILLTASK;
+
+static void *RanFillNormalChunks(void *pArg)
+{
+	const RANFILLTASK *pTask = (const RANFILLTASK *)pArg;
+	RANSTATE ranBase, ranChunk;
+	size_t c, k, m;
+	
+	ranBase = *pTask->pRan;
+	if (pTask->c0 > 0)
+		RanJumpRan_r(&ranBase, pTask->c0);
+	for (c = pTask->c0; c < pTask->c1; c++)
+	{
+		k = c * pTask->nChunk;
+		m = (pTask->n - k < pTask->nChunk) ? pTask->n - k : pTask->nChunk;
+		ranChunk = ranBase;
+		DRanNormalZigVec_r(&ranChunk, pTask->pdOut + k, m);
+		if (c + 1 < pTask->c1)
+			RanJumpRan_r(&ranBase, 1);
+	}
+	return NULL;
+}
+
+void    RanFillNormalParallel_r(RANSTATE *pRan, double *pdOut, size_t n, 
+                                size_t nChunk)
+{
+	RANFILLTASK taskAll, *aTask;
+	size_t nChunks;
+	int t, nThreads;
+	
+	if (pRan->pAsync != NULL)
+		RanAsyncMisuse();
+	if (pRan->fnRanJump == RanJump_ext)
+	{
+		DRanNormalZigVec_r(pRan, pdOut, n);
+		return;
+	}
+	if (n == 0)
+		return;
+	if (nChunk == 0)
+		nChunk = RANFILL_CHUNK;
+	nChunks = (n - 1) / nChunk + 1;
+	nThreads = RanThreadsMax();
+	if ((size_t)nThreads > nChunks)
+		nThreads = (int)nChunks;
+	
+	/* one task per thread; if they cannot be allocated, a single task
+	   fills all chunks, which gives the same array */
+	aTask = (nThreads > 1) ? 
+	        (RANFILLTASK *)malloc(sizeof(RANFILLTASK) * nThreads) : NULL;
+	if (aTask == NULL)
+	{
+		aTask = &taskAll;
+		nThreads = 1;
+	}
+	for (t = 0; t < nThreads; t++)
+	{
+		aTask[t].pRan = pRan;
+		aTask[t].pdOut = pdOut;
+		aTask[t].n = n;
+		aTask[t].nChunk = nChunk;
+		aTask[t].c0 = nChunks * t / nThreads;
+		aTask[t].c1 = nChunks * (t + 1) / nThreads;
+	}
+	
+#if defined(RANDOMMW_OPENMP)
+	#pragma omp parallel for schedule(static, 1) num_threads(nThreads)
+	for (t = 0; t < nThreads; t++)
+		RanFillNormalChunks(&aTask[t]);
+#elif defined(RANDOMMW_PTHREADS)
+	{
+		pthread_t *aThread;
+		int nStarted = 1;
+		
+		/* the calling thread fills the chunks of task 0, and those of the
+		   tasks for which no thread can be created */
+		aThread = (nThreads > 1) ? 
+		          (pthread_t *)malloc(sizeof(pthread_t) * nThreads) : NULL;
+		if (aThread != NULL)
+			while ((nStarted < nThreads) && 
+			       (pthread_create(&aThread[nStarted], NULL, 
+			                       RanFillNormalChunks, &aTask[nStarted]) == 0))
+				nStarted++;
+		RanFillNormalChunks(&aTask[0]);
+		for (t = nStarted; t < nThreads; t++)
+			RanFillNormalChunks(&aTask[t]);
+		for (t = 1; t < nStarted; t++)
+			pthread_join(aThread[t], NULL);
+		free(aThread);
+	}
+#else
+	for (t = 0; t < nThreads; t++)
+		RanFillNormalChunks(&aTask[t]);
+#endif
+	
+	if (aTask != &taskAll)
+		free(aTask);
+	RanJumpRan_r(pRan, nChunks);
+}
+
+void    RanFillNormalParallel(double *pdOut, size_t n, size_t nChunk)
+{
+	RanFillNormalParallel_r(&s_ranDefault, pdOut, n, nChunk);
+}
+
+/*==========================================================================*/
+
+
+/*==========================================================================
+ *  Random utility functions
+ *  M. H. V. Werts, 2024
+ *==========================================================================*/
+ 
+/* Fully initialize PRNG
+
+   The default generator keeps the currently selected RNG if sRan is
+   an empty string (MWC8222, unless another RNG was selected before).
+   As RanInit_r, it resets the ziggurat to ZIGNOR and the instruction set
+   to the best one supported.
+*/
+void  RanInit(const char *sRan, uint64_t uSeed, uint64_t uJumpsize)
+{
+	RanAsyncEnd(&s_ranDefault);
+	if (strlen(sRan) > 0)
+	{
+		RanSetRan(sRan);
+	}
+	else if (s_ranDefault.fnDRanu == NULL)
+	{
+		RanSetRan("MWC8222");
+	}
+	s_ranDefault.iZig = RANZIG_ZIGNOR;
+	s_ranDefault.iIsa = RanIsaBest();
+	RanSeedJump(uSeed, uJumpsize);
+}
+
+/* Fully initialize a caller-owned generator state
+
+   An empty string sRan selects the default RNG, MWC8222. The ziggurat 
+   tables are constant, and shared by all generator states. A RANSTATE
+   may therefore be initialized while other threads draw random numbers
+   from their own RANSTATE. If pRan is in asynchronous mode, its 
+   producer thread is stopped first.
+*/
+void  RanInit_r(RANSTATE *pRan, const char *sRan, uint64_t uSeed, 
+                uint64_t uJumpsize)
+{
+	RanAsyncEndOwner(pRan);
+	memset(pRan, 0, sizeof(*pRan));
+	pRan->iIsa = RanIsaBest();
+	RanSetRan_r(pRan, (strlen(sRan) > 0) ? sRan : "MWC8222");
+	RanSeedJump_r(pRan, uSeed, uJumpsize);
+}
+
+/*==========================================================================*/
+
+
+/*==========================================================================
+ *  Modified version of zigtimer.c
+ *  original code by J. A. Doornik, 2005
+ *  small modifications by M. H. V. Werts, 2024
+ *
+*==========================================================================*/
+
+/*==========================================================================
+ *  This code is Copyright (C) 2005, Jurgen A. Doornik.
+ *  Permission to use this code for non-commercial purposes
+ *  is hereby given, provided proper reference is made to:
+ *		Doornik, J.A. (2005), "An Improved Ziggurat Method to Generate Normal
+ *          Random Samples", mimeo, Nuffield College, University of Oxford,
+ *			and www.doornik.com/research.
+ *		or the published version when available.
+ *	This reference is still required when using modified versions of the code.
+ *  This notice should be maintained in modified versions of the code.
+ *	No warranty is given regarding the correctness of this code.
+ *==========================================================================*/
+
+
+/*--------------------------- timer functions ------------------------------*/
+#include <time.h>
+
+#if defined(__linux__) | defined (__APPLE__)
+#include <sys/times.h>
+#include <time.h>
+
+clock_t unix_clock (void)
+{
+    struct tms buf;
+    if (times (&buf) < 0)
+        return clock();
+
+    return buf.tms_utime + buf.tms_stime;
+}
+
+#define clock unix_clock
+#include <unistd.h>
+#ifdef CLOCKS_PER_SEC
+#undef CLOCKS_PER_SEC /* to stop warnings, always 1000000 under POSIX */
+#endif
+#define CLOCKS_PER_SEC (sysconf (_SC_CLK_TCK))
+#endif
+
+static char s_sTime[32];
+static clock_t s_clockStart, s_clockStop;
+static double s_dClockPerHundred = 0;
+
+
+void    StartTimer(void)
+{
+	if (s_dClockPerHundred == 0)
+		s_dClockPerHundred = 100.0 / CLOCKS_PER_SEC;
+		
+	s_clockStop = s_clockStart = clock();
+}
+void    StopTimer(void)
+{
+    s_clockStop = clock();
+}
+
+static double  ClockStartDblHsec(void)
+{
+    return s_clockStart * s_dClockPerHundred;
+}
+static double  ClockStopDblHsec(void)
+{
+    return s_clockStop * s_dClockPerHundred;
+}
+
+static char *  GetTimeSpan(double dTime2, double dTime1)
+{
+    int m, s, h, len, bzeros;  unsigned long tnew;
+    double  duration;
+       
+    duration = fabs(dTime2 - dTime1);             /* difference in hundreds */
+    tnew = (unsigned long)(duration / 100.0);      /* difference in seconds */
+    
+    h = (int)(duration - 100.0 * tnew);                         /* hundreds */
+    s = tnew % 60;  tnew /= 60;                                  /* seconds */
+    m = tnew % 60;  tnew /= 60;             /* minutes, now tnew is # hours */
+    
+    len = bzeros = 0;
+    if (tnew)
+    {   sprintf(s_sTime, "%2d:", (int)tnew);  len = (int)strlen(s_sTime);
+        bzeros = 1;
+    }
+    if (m || tnew)
+    {   sprintf(s_sTime + len, bzeros ? "%02d'" : "%2d'", m);  len += 3;
+        bzeros = 1;
+    }
+    sprintf(s_sTime + len, bzeros ? "%02d" : "%2d", s); len += 2;
+    if (h)
+	{
+		sprintf(s_sTime + len, ".%02d", h); len += 3;
+	}
+	if (!(m || tnew))
+	{
+		sprintf(s_sTime + len, " s"); len += 2;
+	}	
+	return s_sTime;
+}
+char * GetLapsedTime(void)
+{
+    return GetTimeSpan(ClockStopDblHsec(), ClockStartDblHsec());
+}
+/*-------------------------- END timer functions ---------------------------*/
+
+
+/*------------------------ high-resolution timer ---------------------------
+ *  M. H. V. Werts, 2024
+ *
+ *  The timer functions above measure CPU time with a resolution of 1/100 s,
+ *  and use a single global start/stop pair. RANTIMER is a caller-owned
+ *  timer that uses the monotonic wall clock (clock_gettime(), nanosecond
+ *  resolution), and on x86 also the time-stamp counter (rdtsc). Note that
+ *  the time-stamp counter runs at a constant reference frequency, which may
+ *  differ from the actual core clock frequency. Several RANTIMER objects
+ *  can be used at the same time, also from different threads.
+ *--------------------------------------------------------------------------*/
+static double  RanTimerNow(void)
+{
+#ifdef CLOCK_MONOTONIC
+	struct timespec ts;
+
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return ts.tv_sec + 1e-9 * ts.tv_nsec;
+#else
+	return (double)clock() / CLOCKS_PER_SEC;
+#endif
+}
+
+static uint64_t  RanTimerTsc(void)
+{
+#if defined(__x86_64__) || defined(__i386__)
+	return __builtin_ia32_rdtsc();
+#else
+	return 0;
+#endif
+}
+
+void	RanTimerStart(RANTIMER *pTimer)
+{
+	pTimer->uTscStop = pTimer->uTscStart = RanTimerTsc();
+	pTimer->dStop = pTimer->dStart = RanTimerNow();
+}
+
+void	RanTimerStop(RANTIMER *pTimer)
+{
+	pTimer->dStop = RanTimerNow();
+	pTimer->uTscStop = RanTimerTsc();
+}
+
+/* Elapsed time in seconds */
+double	RanTimerSeconds(const RANTIMER *pTimer)
+{
+	return pTimer->dStop - pTimer->dStart;
+}
+
+/* Elapsed time-stamp counter ticks (0 if not available) */
+uint64_t	RanTimerTicks(const RANTIMER *pTimer)
+{
+	return pTimer->uTscStop - pTimer->uTscStart;
+}
+/*---------------------- END high-resolution timer -------------------------*/
+
+/*==========================================================================*/
+
+
+
+/*==========================================================================
+ *  Philox4x32-10 counter-based PRNG
+ *  J. K. Salmon, M. A. Moraes, R. O. Dror, D. E. Shaw, 2011
+ *  (Random123 library, reference [28])
+ *
+ *  M. H. V. Werts, 2025
+ *
+ *  The output is a keyed bijection of a 128-bit counter: block c of the 
+ *  stream (4 32-bit words, 2 64-bit numbers) is philox4x32_10(key, c). The
+ *  key (64 bits) is obtained from the seed with splitmix64. The numbers 
+ *  are therefore a pure function of (seed, position), and any position is
+ *  reached in O(1) (RanAdvanceRan, RanJumpRan, RanSetStream).
+ *
+ *  Counter layout for RanSetStream(uId, uStep): word 0 is the block 
+ *  number within the stream (2^33 64-bit numbers), word 1 the particle 
+ *  uId (< 2^32), words 2-3 the time step uStep. The numbers used for a
+ *  particle at a given time step thus do not depend on the order in which
+ *  the particles are processed, nor on the thread that processes them. 
+ *  A jump (RanJumpRan) is 2^64 blocks, i.e. to the next uStep.
+ *
+ *  Blocks are generated into a buffer by a SIMD kernel (AVX2 or AVX-512,
+ *  see RanSetIsa), at the end of the buffer. After positioning, only 
+ *  PHILOX_REFILL_MIN blocks are generated, and the number of blocks 
+ *  doubles with every refill, so that few numbers are wasted when only a
+ *  few are used per stream. The output
+ *  does not depend on the refill sizes. The 64-bit numbers of block 
+ *  (x0, x1, x2, x3) are x0 + 2^32 x1 and x2 + 2^32 x3.
+ *==========================================================================*/
+
+#define PHILOX_M0 0xD2511F53u
+#define PHILOX_M1 0xCD9E8D57u
+#define PHILOX_W0 0x9E3779B9u
+#define PHILOX_W1 0xBB67AE85u
+
+/* One block: puOut = Philox4x32-10(puKey, puCtr), as in Random123 */
+static inline __attribute__((always_inline))
+void philox4x32_10_inline(const uint32_t *puKey, const uint32_t *puCtr, 
+                          uint32_t *puOut)
+{
+	uint32_t k0 = puKey[0], k1 = puKey[1];
+	uint32_t c0 = puCtr[0], c1 = puCtr[1], c2 = puCtr[2], c3 = puCtr[3];
+	uint64_t p0, p1;
+	int r;
+	
+	for (r = 0; r < 10; r++)
+	{
+		p0 = (uint64_t)PHILOX_M0 * c0;
+		p1 = (uint64_t)PHILOX_M1 * c2;
+		c0 = (uint32_t)(p1 >> 32) ^ c1 ^ k0;
+		c1 = (uint32_t)p1;
+		c2 = (uint32_t)(p0 >> 32) ^ c3 ^ k1;
+		c3 = (uint32_t)p0;
+		k0 += PHILOX_W0;
+		k1 += PHILOX_W1;
+	}
+	puOut[0] = c0;
+	puOut[1] = c1;
+	puOut[2] = c2;
+	puOut[3] = c3;
+}
+
+void    philox4x32_10(const uint32_t *puKey, const uint32_t *puCtr, 
+                      uint32_t *puOut)
+{
+	philox4x32_10_inline(puKey, puCtr, puOut);
+}
+
+/* nblocks blocks from counter ctr, written as 64-bit numbers to pOut.
+   The SIMD kernels hold the 32-bit words of 4 (AVX2) or 8 (AVX-512) 
+   blocks in 64-bit elements, so that the 32 x 32 -> 64 bit products are
+   single instructions (vpmuludq); the remaining blocks are done one by
+   one. The words of the counter are broadcast, except for word 0, unless
+   a carry occurs within the vector. */
+static inline __attribute__((always_inline))
+size_t philox4x32_generate_rest(const uint32_t *puKey, __uint128_t ctr,
+                                uint64_t *pOut, size_t nblocks, size_t k)
+{
+	__uint128_t c;
+	uint32_t auCtr[4], auOut[4];
+	int l;
+	
+	for (; k < nblocks; k++)
+	{
+		c = ctr + k;
+		for (l = 0; l < 4; l++)
+			auCtr[l] = (uint32_t)(c >> (32 * l));
+		philox4x32_10_inline(puKey, auCtr, auOut);
+		pOut[2 * k] = auOut[0] | ((uint64_t)auOut[1] << 32);
+		pOut[2 * k + 1] = auOut[2] | ((uint64_t)auOut[3] << 32);
+	}
+	return k;
+}
+
+static void philox4x32_generate_scalar(const uint32_t *puKey, __uint128_t ctr,
+                                       uint64_t *pOut, size_t nblocks)
+{
+	philox4x32_generate_rest(puKey, ctr, pOut, nblocks, 0);
+}
+
+#ifdef RANDOMMW_DISPATCH
+/* PHILOX_NV independent vectors are processed together, as the rounds of
+   a single vector form a long dependency chain (latency bound) */
+#define PHILOX_NV 4
+
+#define PHILOX_ROUNDS(fmul, fsrli, fand, fxor, fset1)                         \
+	k0 = puKey[0];                                                            \
+	k1 = puKey[1];                                                            \
+	for (r = 0; r < 10; r++)                                                  \
+	{                                                                         \
+		_Pragma("GCC unroll 4")                                               \
+		for (v = 0; v < PHILOX_NV; v++)                                       \
+		{                                                                     \
+			p0 = fmul(c0[v], vM0);                                            \
+			p1 = fmul(c2[v], vM1);                                            \
+			c0[v] = fxor(fxor(fsrli(p1, 32), c1[v]), fset1(k0));              \
+			c1[v] = fand(p1, vLo);                                            \
+			c2[v] = fxor(fxor(fsrli(p0, 32), c3[v]), fset1(k1));              \
+			c3[v] = fand(p0, vLo);                                            \
+		}                                                                     \
+		k0 += PHILOX_W0;                                                      \
+		k1 += PHILOX_W1;                                                      \
+	}
+
+/* words of the counters c + l, l = 0 ... L - 1, in 64-bit elements */
+#define PHILOX_COUNTERS(L, au, c)                                             \
+	for (l = 0; l < L; l++)                                                   \
+		for (j = 0; j < 4; j++)                                               \
+			au[j][l] = (uint32_t)((c + l) >> (32 * j));
+
+RANDOMMW_TARGET_AVX2
+static void philox4x32_generate_avx2(const uint32_t *puKey, __uint128_t ctr,
+                                     uint64_t *pOut, size_t nblocks)
+{
+	const __m256i vM0 = _mm256_set1_epi64x(PHILOX_M0);
+	const __m256i vM1 = _mm256_set1_epi64x(PHILOX_M1);
+	const __m256i vLo = _mm256_set1_epi64x(0xFFFFFFFFLL);
+	const __m256i vIota = _mm256_set_epi64x(3, 2, 1, 0);
+	__m256i c0[PHILOX_NV], c1[PHILOX_NV], c2[PHILOX_NV], c3[PHILOX_NV];
+	__m256i p0, p1, lo, hi;
+	__uint128_t c;
+	uint64_t au[4][4];
+	uint32_t k0, k1;
+	size_t k;
+	int r, v, l, j;
+	
+	for (k = 0; k + 4 * PHILOX_NV <= nblocks; k += 4 * PHILOX_NV)
+	{
+		for (v = 0; v < PHILOX_NV; v++)
+		{
+			c = ctr + k + 4 * v;
+			if ((uint32_t)c <= 0xFFFFFFFFu - 3)
+			{
+				c0[v] = _mm256_add_epi64(_mm256_set1_epi64x((uint32_t)c),
+				                         vIota);
+				c1[v] = _mm256_set1_epi64x((uint32_t)(c >> 32));
+				c2[v] = _mm256_set1_epi64x((uint32_t)(c >> 64));
+				c3[v] = _mm256_set1_epi64x((uint32_t)(c >> 96));
+			}
+			else
+			{
+				PHILOX_COUNTERS(4, au, c)
+				c0[v] = _mm256_loadu_si256((const __m256i *)au[0]);
+				c1[v] = _mm256_loadu_si256((const __m256i *)au[1]);
+				c2[v] = _mm256_loadu_si256((const __m256i *)au[2]);
+				c3[v] = _mm256_loadu_si256((const __m256i *)au[3]);
+			}
+		}
+		PHILOX_ROUNDS(_mm256_mul_epu32, _mm256_srli_epi64, _mm256_and_si256,
+		              _mm256_xor_si256, _mm256_set1_epi64x)
+		/* numbers (lo, hi) of the blocks, in order */
+		for (v = 0; v < PHILOX_NV; v++)
+		{
+			lo = _mm256_or_si256(c0[v], _mm256_slli_epi64(c1[v], 32));
+			hi = _mm256_or_si256(c2[v], _mm256_slli_epi64(c3[v], 32));
+			p0 = _mm256_unpacklo_epi64(lo, hi);
+			p1 = _mm256_unpackhi_epi64(lo, hi);
+			_mm256_storeu_si256((__m256i *)(pOut + 2 * k + 8 * v), 
+			                    _mm256_permute2x128_si256(p0, p1, 0x20));
+			_mm256_storeu_si256((__m256i *)(pOut + 2 * k + 8 * v + 4), 
+			                    _mm256_permute2x128_si256(p0, p1, 0x31));
+		}
+	}
+	philox4x32_generate_rest(puKey, ctr, pOut, nblocks, k);
+}
+
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wmaybe-uninitialized"
+RANDOMMW_TARGET_AVX512
+static void philox4x32_generate_avx512(const uint32_t *puKey, __uint128_t ctr,
+                                       uint64_t *pOut, size_t nblocks)
+{
+	const __m512i vM0 = _mm512_set1_epi64(PHILOX_M0);
+	const __m512i vM1 = _mm512_set1_epi64(PHILOX_M1);
+	const __m512i vLo = _mm512_set1_epi64(0xFFFFFFFFLL);
+	const __m512i vIota = _mm512_set_epi64(7, 6, 5, 4, 3, 2, 1, 0);
+	const __m512i vIdxLo = _mm512_set_epi64(11, 3, 10, 2, 9, 1, 8, 0);
+	const __m512i vIdxHi = _mm512_set_epi64(15, 7, 14, 6, 13, 5, 12, 4);
+	__m512i c0[PHILOX_NV], c1[PHILOX_NV], c2[PHILOX_NV], c3[PHILOX_NV];
+	__m512i p0, p1, lo, hi;
+	__uint128_t c;
+	uint64_t au[4][8];
+	uint32_t k0, k1;
+	size_t k;
+	int r, v, l, j;
+	
+	for (k = 0; k + 8 * PHILOX_NV <= nblocks; k += 8 * PHILOX_NV)
+	{
+		for (v = 0; v < PHILOX_NV; v++)
+		{
+			c = ctr + k + 8 * v;
+			if ((uint32_t)c <= 0xFFFFFFFFu - 7)
+			{
+				c0[v] = _mm512_add_epi64(_mm512_set1_epi64((uint32_t)c), 
+				                         vIota);
+				c1[v] = _mm512_set1_epi64((uint32_t)(c >> 32));
+				c2[v] = _mm512_set1_epi64((uint32_t)(c >> 64));
+				c3[v] = _mm512_set1_epi64((uint32_t)(c >> 96));
+			}
+			else
+			{
+				PHILOX_COUNTERS(8, au, c)
+				c0[v] = _mm512_loadu_si512(au[0]);
+				c1[v] = _mm512_loadu_si512(au[1]);
+				c2[v] = _mm512_loadu_si512(au[2]);
+				c3[v] = _mm512_loadu_si512(au[3]);
+			}
+		}
+		PHILOX_ROUNDS(_mm512_mul_epu32, _mm512_srli_epi64, _mm512_and_si512,
+		              _mm512_xor_si512, _mm512_set1_epi64)
+		for (v = 0; v < PHILOX_NV; v++)
+		{
+			lo = _mm512_or_si512(c0[v], _mm512_slli_epi64(c1[v], 32));
+			hi = _mm512_or_si512(c2[v], _mm512_slli_epi64(c3[v], 32));
+			_mm512_storeu_si512(pOut + 2 * k + 16 * v, 
+			                    _mm512_permutex2var_epi64(lo, vIdxLo, hi));
+			_mm512_storeu_si512(pOut + 2 * k + 16 * v + 8, 
+			                    _mm512_permutex2var_epi64(lo, vIdxHi, hi));
+		}
 	}
+	philox4x32_generate_rest(puKey, ctr, pOut, nblocks, k);
 }
-/*--------------------------- END General Ziggurat -------------------------*/
+#pragma GCC diagnostic pop
+#endif
 
 
-/*==========================================================================*/
+/* nblocks blocks from the counter of the generator, which is advanced */
+static void philox4x32_generate(RANSTATE *pRan, uint64_t *pOut, 
+                                size_t nblocks)
+{
+#ifdef RANDOMMW_DISPATCH
+	if (pRan->iIsa == RANISA_AVX512)
+		philox4x32_generate_avx512(pRan->philox_key, pRan->philox_ctr,
+		                           pOut, nblocks);
+	else if (pRan->iIsa == RANISA_AVX2)
+		philox4x32_generate_avx2(pRan->philox_key, pRan->philox_ctr,
+		                         pOut, nblocks);
+	else
+#endif
+	philox4x32_generate_scalar(pRan->philox_key, pRan->philox_ctr,
+	                           pOut, nblocks);
+	pRan->philox_ctr += nblocks;
+}
 
+static void philox4x32_refill(RANSTATE *pRan)
+{
+	int nblocks = pRan->philox_nrefill;
+	
+	pRan->philox_bufi = PHILOX_BUF - 2 * nblocks;
+	philox4x32_generate(pRan, pRan->philox_buf + pRan->philox_bufi, nblocks);
+	if (2 * nblocks < PHILOX_BUF / 2)
+		pRan->philox_nrefill = 2 * nblocks;
+	else
+		pRan->philox_nrefill = PHILOX_BUF / 2;
+}
 
-/*==========================================================================
- *  Random utility functions
- *  M. H. V. Werts, 2024
- *==========================================================================*/
- 
-/* Fully initialize PRNG and ziggurat algorithm */
-void  RanInit(const char *sRan, uint64_t uSeed, uint64_t uJumpsize)
+/* Current position: the next number is word uHalf (0 or 1) of block
+   *pBlock. The buffer holds whole blocks, up to the counter. */
+static void philox4x32_getpos(RANSTATE *pRan, __uint128_t *pBlock, 
+                              int *piHalf)
 {
-	zigNorInit(ZIGNOR_C, ZIGNOR_R, ZIGNOR_V);
-	if (strlen(sRan) > 0)
+	int nleft = PHILOX_BUF - pRan->philox_bufi;
+	
+	*pBlock = pRan->philox_ctr - (nleft + 1) / 2;
+	*piHalf = nleft & 1;
+}
+
+static void philox4x32_setpos(RANSTATE *pRan, __uint128_t block, int iHalf)
+{
+	pRan->philox_ctr = block;
+	pRan->philox_bufi = PHILOX_BUF;
+	pRan->philox_nrefill = PHILOX_REFILL_MIN;
+	if (iHalf)
 	{
-		RanSetRan(sRan);
+		philox4x32_refill(pRan);
+		pRan->philox_bufi++;
 	}
-	RanSeedJump(uSeed, uJumpsize);
 }
 
+static void RanSetSeed_philox4x32(RANSTATE *pRan, uint64_t uSeed)
+{
+	uint64_t uSplitmix, uKey;
+	
+	RanSetSeed_splitmix64(&uSplitmix, uSeed);
+	uKey = splitmix64_next_r(&uSplitmix);
+	pRan->philox_key[0] = (uint32_t)uKey;
+	pRan->philox_key[1] = (uint32_t)(uKey >> 32);
+	philox4x32_setpos(pRan, 0, 0);
+}
+
+/* Jump by 2^64 blocks (2^65 64-bit numbers) */
+static void RanJump_philox4x32(RANSTATE *pRan, uint64_t uJumps)
+{
+	__uint128_t block;
+	int iHalf;
+	
+	philox4x32_getpos(pRan, &block, &iHalf);
+	philox4x32_setpos(pRan, block + ((__uint128_t)uJumps << 64), iHalf);
+}
+
+static void RanSeedJump_philox4x32(RANSTATE *pRan, uint64_t uSeed, uint64_t uJumpsize)
+{
+	RanSetSeed_philox4x32(pRan, uSeed);
+	if (uJumpsize > 0)
+	{
+		RanJump_philox4x32(pRan, uJumpsize);
+	}
+}
+
+static void RanAdvance_philox4x32(RANSTATE *pRan, uint64_t uSteps)
+{
+	__uint128_t block, t;
+	int iHalf;
+	
+	philox4x32_getpos(pRan, &block, &iHalf);
+	t = iHalf + (__uint128_t)uSteps;
+	philox4x32_setpos(pRan, block + (t >> 1), (int)(t & 1));
+}
+
+static inline uint64_t U64Ran_philox4x32(RANSTATE *pRan)
+{
+	if (pRan->philox_bufi >= PHILOX_BUF)
+		philox4x32_refill(pRan);
+	return pRan->philox_buf[pRan->philox_bufi++];
+}
+
+static uint32_t U32Ran_philox4x32(RANSTATE *pRan)
+{
+	return (uint32_t)(U64Ran_philox4x32(pRan) >> 32);
+}
+
+static double DRan_philox4x32(RANSTATE *pRan)
+{
+	uint64_t xx;
+	
+	while ((xx = (U64Ran_philox4x32(pRan) >> 11)) == 0)
+		;
+	
+	return (xx * 0x1.0p-53);
+}
+
+/* Start of the stream of particle uId at time step uStep (see above). 
+   Only for Philox4x32-10; the other RNGs have no stream key, and -1 is 
+   returned without changing the generator (the asynchronous mode is 
+   stopped all the same). uId fills counter word 1 only: a larger uId 
+   would give the stream of uId mod 2^32, and is rejected in the same way. */
+int     RanSetStream_r(RANSTATE *pRan, uint64_t uId, uint64_t uStep)
+{
+	RanAsyncEnd(pRan);
+	if ((pRan->fnU64Ranu != U64Ran_philox4x32) || (uId > UINT32_MAX))
+		return -1;
+	pRan->bHalf = 0;
+	philox4x32_setpos(pRan, ((__uint128_t)uStep << 64) | (uId << 32), 0);
+	return 0;
+}
+
+int     RanSetStream(uint64_t uId, uint64_t uStep)
+{
+	return RanSetStream_r(&s_ranDefault, uId, uStep);
+}
+
+/* Bulk generation (see section G): the raw numbers are generated directly
+   into the output array, after emptying the buffer; normal variates are
+   obtained with the batched ziggurat, from the buffer. */
+RAN_VEC_U32(philox4x32)
+RAN_VEC_FLOAT(philox4x32)
+
+static void U64RanUVec_philox4x32(RANSTATE *pRan, uint64_t *puOut, size_t n)
+{
+	size_t k = 0, nblocks;
+	
+	while ((k < n) && (pRan->philox_bufi < PHILOX_BUF))
+		puOut[k++] = pRan->philox_buf[pRan->philox_bufi++];
+	
+	nblocks = (n - k) / 2;
+	philox4x32_generate(pRan, puOut + k, nblocks);
+	k += 2 * nblocks;
+	
+	while (k < n)
+		puOut[k++] = U64Ran_philox4x32(pRan);
+}
+
+/* the raw numbers are generated in place, and converted as DRan does (a
+   zero, which is skipped, is removed afterwards, as in the x4/x8 engines) */
+static void DRanUVec_philox4x32(RANSTATE *pRan, double *pdOut, size_t n)
+{
+	size_t k = 0, j, m, nblocks;
+	uint64_t *puRaw, xx, uzero = 0;
+	
+	while ((k < n) && (pRan->philox_bufi < PHILOX_BUF))
+		pdOut[k++] = DRan_philox4x32(pRan);
+	
+	nblocks = (n - k) / 2;
+	puRaw = (uint64_t *)(pdOut + k);
+	philox4x32_generate(pRan, puRaw, nblocks);
+	m = k + 2 * nblocks;
+	for (j = 0; j < 2 * nblocks; ++j)
+	{
+		xx = puRaw[j] >> 11;
+		uzero |= (xx == 0);
+		pdOut[k + j] = xx * 0x1.0p-53;
+	}
+	if (uzero)
+	{
+		for (j = k; j < m; ++j)
+			if (pdOut[j] != 0.0)
+				pdOut[k++] = pdOut[j];
+	}
+	else
+		k = m;
+	
+	while (k < n)
+		pdOut[k++] = DRan_philox4x32(pRan);
+}
+
+static void DRanNormalZigVec_philox4x32(RANSTATE *pRan, double *pdOut, 
+                                        size_t n)
+{
+	DRanNormalZigVec_buffered(pRan, pdOut, n, pRan->philox_buf,
+	                          &pRan->philox_bufi, PHILOX_BUF,
+	                          philox4x32_refill, U64Ran_philox4x32,
+	                          DRan_philox4x32, U32Ran_philox4x32);
+}
+/*---------------------- END Philox4x32-10 ---------------------------------*/
+
 /*==========================================================================*/
 
 
 /*==========================================================================
- *  Modified version of zigtimer.c
- *  original code by J. A. Doornik, 2005
- *  small modifications by M. H. V. Werts, 2024
+ *  Asynchronous mode: producer thread with a lock-free ring buffer
  *
-*==========================================================================*/
-
-/*==========================================================================
- *  This code is Copyright (C) 2005, Jurgen A. Doornik.
- *  Permission to use this code for non-commercial purposes
- *  is hereby given, provided proper reference is made to:
- *		Doornik, J.A. (2005), "An Improved Ziggurat Method to Generate Normal
- *          Random Samples", mimeo, Nuffield College, University of Oxford,
- *			and www.doornik.com/research.
- *		or the published version when available.
- *	This reference is still required when using modified versions of the code.
- *  This notice should be maintained in modified versions of the code.
- *	No warranty is given regarding the correctness of this code.
+ *  M. H. V. Werts, 2025
+ *
+ *  RanAsyncStart_r hands the generator state over to a producer thread, 
+ *  which fills a single-producer/single-consumer ring buffer ahead of 
+ *  demand, with DRanNormalZigVec_r (RANASYNC_NORMAL) or DRanUVec_r 
+ *  (RANASYNC_UNIFORM). As bulk and scalar generation give the same 
+ *  numbers, DRanNormalZig_r and DRanNormalZigVec_r (or DRanU_r and 
+ *  DRanUVec_r) then return the same sequence as without the asynchronous
+ *  mode, reading the next numbers from the ring buffer. 
+ *
+ *  The caller's RANSTATE no longer holds the generator state. Its other
+ *  draw functions (U32RanU_r, U64RanU_r, FRanU_r, DRanExpZig_r, the other
+ *  bulk functions, RanFillNormalParallel_r, and DRanU_r or DRanNormalZig_r
+ *  in the other mode) are replaced by a trap, which reports the misuse
+ *  on stderr and aborts, instead of returning numbers correlated with
+ *  those of the producer. Functions that change the generator (RanInit_r,
+ *  RanSetRan_r, RanSetSeed_r, RanJumpRan_r, RanSeedJump_r, RanAdvanceRan_r,
+ *  RanSetStream_r, RanSetZig_r, RanSetIsa_r) first call RanAsyncStop_r, 
+ *  which takes the generator state back from the producer: numbers 
+ *  generated but not yet read are discarded, as with RanJumpRan. 
+ *  RanInit_r and RanSetRan_r may be called on an uninitialized RANSTATE:
+ *  they find an active producer from a list of the generators in 
+ *  asynchronous mode, not from the contents of the RANSTATE.
+ *
+ *  The indices uHead (written by the producer) and uTail (written by the
+ *  consumer) count the numbers written and read since the start, and are
+ *  on separate cache lines. The consumer publishes uTail once every
+ *  RANASYNC_PUBLISH numbers, and when it finds the ring buffer empty, so
+ *  that the cache line of uTail does not move between the cores for 
+ *  every number. A thread that has to wait spins, and yields its CPU 
+ *  after RANASYNC_SPIN attempts.
  *==========================================================================*/
 
+#define RANASYNC_PUBLISH	64
+#define RANASYNC_SPIN		64
+#define RANASYNC_CACHELINE	64
 
-/*--------------------------- timer functions ------------------------------*/
-#include <time.h>
-
-#if defined(__linux__) | defined (__APPLE__)
-#include <sys/times.h>
-#include <time.h>
+struct RANASYNC {
+	/* written by the producer */
+	uint64_t uHead __attribute__((aligned(RANASYNC_CACHELINE)));
+	uint64_t uStalls;
+	
+	/* written by the consumer */
+	uint64_t uTail __attribute__((aligned(RANASYNC_CACHELINE)));
+	uint64_t uTailLocal;	/* next number to be read */
+	uint64_t uHeadCache;	/* last value of uHead seen by the consumer */
+	uint64_t uWaits;
+	
+	/* constant while active */
+	double *pdRing __attribute__((aligned(RANASYNC_CACHELINE)));
+	uint64_t uMask;			/* depth of the ring buffer - 1 */
+	uint64_t nBatch;		/* minimum number of numbers per refill */
+	int iKind;
+	int iCpu;
+	int bStop;
+	void *pAlloc;			/* allocated block (struct and ring) */
+	RANSTATE *pOwner;		/* generator of the consumer */
+	struct RANASYNC *pNext;	/* list of active producers */
+#ifdef RANDOMMW_PTHREADS
+	pthread_t thread;
+#endif
+	
+	/* generator state, owned by the producer */
+	RANSTATE ran;
+};
 
-clock_t unix_clock (void)
+static inline int RanAsyncIsNormal(const struct RANASYNC *pAsync)
 {
-    struct tms buf;
-    if (times (&buf) < 0)
-        return clock();
-
-    return buf.tms_utime + buf.tms_stime;
+	return (pAsync->iKind == RANASYNC_NORMAL);
 }
 
-#define clock unix_clock
-#include <unistd.h>
-#ifdef CLOCKS_PER_SEC
-#undef CLOCKS_PER_SEC /* to stop warnings, always 1000000 under POSIX */
+static void RanAsyncPause(int nSpin)
+{
+#ifdef RANDOMMW_DISPATCH
+	_mm_pause();
 #endif
-#define CLOCKS_PER_SEC (sysconf (_SC_CLK_TCK))
+#ifdef RANDOMMW_PTHREADS
+	if (nSpin % RANASYNC_SPIN == 0)
+		sched_yield();
+#else
+	(void)nSpin;
 #endif
+}
 
-static char s_sTime[32];
-static clock_t s_clockStart, s_clockStop;
-static double s_dClockPerHundred = 0;
+/* Consumer: the ring buffer is empty, as far as known. Publish the 
+   numbers read, and wait for the producer. */
+static __attribute__((noinline)) void RanAsyncWait(struct RANASYNC *pAsync)
+{
+	uint64_t uTail = pAsync->uTailLocal;
+	int nSpin = 0;
+	
+	__atomic_store_n(&pAsync->uTail, uTail, __ATOMIC_RELEASE);
+	pAsync->uHeadCache = __atomic_load_n(&pAsync->uHead, __ATOMIC_ACQUIRE);
+	if (pAsync->uHeadCache != uTail)
+		return;
+	pAsync->uWaits++;
+	do
+	{
+		RanAsyncPause(++nSpin);
+		pAsync->uHeadCache = __atomic_load_n(&pAsync->uHead, 
+		                                     __ATOMIC_ACQUIRE);
+	} while (pAsync->uHeadCache == uTail);
+}
 
+static inline double RanAsyncRead(struct RANASYNC *pAsync)
+{
+	uint64_t uTail = pAsync->uTailLocal;
+	double x;
+	
+	if (uTail == pAsync->uHeadCache)
+		RanAsyncWait(pAsync);
+	x = pAsync->pdRing[uTail & pAsync->uMask];
+	pAsync->uTailLocal = ++uTail;
+	if (uTail % RANASYNC_PUBLISH == 0)
+		__atomic_store_n(&pAsync->uTail, uTail, __ATOMIC_RELEASE);
+	return x;
+}
 
-void    StartTimer(void)
+/* Functions that change the generator stop the asynchronous mode */
+static inline void RanAsyncEnd(RANSTATE *pRan)
 {
-	if (s_dClockPerHundred == 0)
-		s_dClockPerHundred = 100.0 / CLOCKS_PER_SEC;
-		
-	s_clockStop = s_clockStart = clock();
+	if (pRan->pAsync != NULL)
+		RanAsyncStop_r(pRan, NULL);
 }
-void    StopTimer(void)
+
+/* Draw functions not available in asynchronous mode */
+static void RanAsyncMisuse(void)
 {
-    s_clockStop = clock();
+	fprintf(stderr, "randommw: generator in asynchronous mode: only "
+	        "DRanNormalZig and DRanNormalZigVec (RANASYNC_NORMAL), or DRanU "
+	        "and DRanUVec (RANASYNC_UNIFORM), may be used until "
+	        "RanAsyncStop\n");
+	abort();
 }
 
-static double  ClockStartDblHsec(void)
+#ifdef RANDOMMW_PTHREADS
+/* Generators in asynchronous mode, for RanInit_r and RanSetRan_r */
+static struct RANASYNC *s_pAsyncList = NULL;
+static pthread_mutex_t s_mutexAsync = PTHREAD_MUTEX_INITIALIZER;
+
+static void RanAsyncEndOwner(RANSTATE *pRan)
 {
-    return s_clockStart * s_dClockPerHundred;
+	struct RANASYNC *pAsync;
+	
+	pthread_mutex_lock(&s_mutexAsync);
+	for (pAsync = s_pAsyncList; pAsync != NULL; pAsync = pAsync->pNext)
+		if (pAsync->pOwner == pRan)
+			break;
+	pthread_mutex_unlock(&s_mutexAsync);
+	if (pAsync != NULL)
+	{
+		pRan->pAsync = pAsync;
+		RanAsyncStop_r(pRan, NULL);
+	}
 }
-static double  ClockStopDblHsec(void)
+
+/* Draw functions of the consumer: from the ring buffer, or a trap */
+static double DRan_async(RANSTATE *pRan)
 {
-    return s_clockStop * s_dClockPerHundred;
+	return RanAsyncRead(pRan->pAsync);
 }
 
-static char *  GetTimeSpan(double dTime2, double dTime1)
+static void DRanVec_async(RANSTATE *pRan, double *pdOut, size_t n)
 {
-    int m, s, h, len, bzeros;  unsigned long tnew;
-    double  duration;
-       
-    duration = fabs(dTime2 - dTime1);             /* difference in hundreds */
-    tnew = (unsigned long)(duration / 100.0);      /* difference in seconds */
-    
-    h = (int)(duration - 100.0 * tnew);                         /* hundreds */
-    s = tnew % 60;  tnew /= 60;                                  /* seconds */
-    m = tnew % 60;  tnew /= 60;             /* minutes, now tnew is # hours */
-    
-    len = bzeros = 0;
-    if (tnew)
-    {   sprintf(s_sTime, "%2d:", (int)tnew);  len = (int)strlen(s_sTime);
-        bzeros = 1;
-    }
-    if (m || tnew)
-    {   sprintf(s_sTime + len, bzeros ? "%02d'" : "%2d'", m);  len += 3;
-        bzeros = 1;
-    }
-    sprintf(s_sTime + len, bzeros ? "%02d" : "%2d", s); len += 2;
-    if (h)
+	size_t k;
+	
+	for (k = 0; k < n; k++)
+		pdOut[k] = RanAsyncRead(pRan->pAsync);
+}
+
+static double DRan_asynctrap(RANSTATE *pRan)
+{
+	(void)pRan;
+	RanAsyncMisuse();
+	return 0;
+}
+
+static uint32_t U32Ran_asynctrap(RANSTATE *pRan)
+{
+	(void)pRan;
+	RanAsyncMisuse();
+	return 0;
+}
+
+static uint64_t U64Ran_asynctrap(RANSTATE *pRan)
+{
+	(void)pRan;
+	RanAsyncMisuse();
+	return 0;
+}
+
+static void DRanVec_asynctrap(RANSTATE *pRan, double *pdOut, size_t n)
+{
+	(void)pRan;
+	(void)pdOut;
+	(void)n;
+	RanAsyncMisuse();
+}
+
+static void U32RanVec_asynctrap(RANSTATE *pRan, uint32_t *puOut, size_t n)
+{
+	(void)pRan;
+	(void)puOut;
+	(void)n;
+	RanAsyncMisuse();
+}
+
+static void U64RanVec_asynctrap(RANSTATE *pRan, uint64_t *puOut, size_t n)
+{
+	(void)pRan;
+	(void)puOut;
+	(void)n;
+	RanAsyncMisuse();
+}
+
+static void FRanVec_asynctrap(RANSTATE *pRan, float *pfOut, size_t n)
+{
+	(void)pRan;
+	(void)pfOut;
+	(void)n;
+	RanAsyncMisuse();
+}
+
+/* Producer: refill the free part of the ring buffer, in blocks of at 
+   least nBatch numbers, up to the end of the buffer */
+static void *RanAsyncProducer(void *pArg)
+{
+	struct RANASYNC *pAsync = (struct RANASYNC *)pArg;
+	uint64_t uHead = 0, uTail, i, n;
+	int nSpin = 0;
+	
+	while (!__atomic_load_n(&pAsync->bStop, __ATOMIC_ACQUIRE))
 	{
-		sprintf(s_sTime + len, ".%02d", h); len += 3;
+		uTail = __atomic_load_n(&pAsync->uTail, __ATOMIC_ACQUIRE);
+		n = pAsync->uMask + 1 - (uHead - uTail);
+		if (n < pAsync->nBatch)
+		{
+			if (nSpin++ == 0)
+				__atomic_store_n(&pAsync->uStalls, pAsync->uStalls + 1, 
+				                 __ATOMIC_RELAXED);
+			RanAsyncPause(nSpin);
+			continue;
+		}
+		nSpin = 0;
+		i = uHead & pAsync->uMask;
+		if (n > pAsync->uMask + 1 - i)
+			n = pAsync->uMask + 1 - i;
+		if (pAsync->iKind == RANASYNC_NORMAL)
+			DRanNormalZigVec_r(&pAsync->ran, pAsync->pdRing + i, n);
+		else
+			DRanUVec_r(&pAsync->ran, pAsync->pdRing + i, n);
+		uHead += n;
+		__atomic_store_n(&pAsync->uHead, uHead, __ATOMIC_RELEASE);
 	}
-	if (!(m || tnew))
+	return NULL;
+}
+#endif
+
+/* Start the asynchronous mode. Returns 0, or -1 if it could not be 
+   started (no POSIX threads, already active, out of memory), in which
+   case the generator remains synchronous. Pinning the producer to iCpu
+   is done where supported (Linux, with _GNU_SOURCE defined). */
+int		RanAsyncStart_r(RANSTATE *pRan, int iKind, size_t nDepth, int iCpu)
+{
+#ifdef RANDOMMW_PTHREADS
+	struct RANASYNC *pAsync;
+	uint64_t uDepth = 64;
+	char *pAlloc;
+	
+	if ((pRan->pAsync != NULL) || (pRan->fnRanJump == RanJump_ext))
+		return -1;
+	if (nDepth == 0)
+		nDepth = RANASYNC_DEPTH;
+	while (uDepth < nDepth)
+		uDepth *= 2;
+	
+	/* struct and ring buffer in a single block, aligned to a cache line */
+	pAlloc = (char *)malloc(sizeof(struct RANASYNC) + 
+	                        uDepth * sizeof(double) + RANASYNC_CACHELINE);
+	if (pAlloc == NULL)
+		return -1;
+	pAsync = (struct RANASYNC *)(pAlloc + RANASYNC_CACHELINE - 
+	         (uintptr_t)pAlloc % RANASYNC_CACHELINE);
+	memset(pAsync, 0, sizeof(struct RANASYNC));
+	pAsync->pAlloc = pAlloc;
+	pAsync->pdRing = (double *)(pAsync + 1);
+	pAsync->uMask = uDepth - 1;
+	pAsync->nBatch = uDepth / 8;
+	pAsync->iKind = (iKind == RANASYNC_UNIFORM) ? RANASYNC_UNIFORM 
+	                                            : RANASYNC_NORMAL;
+	pAsync->iCpu = -1;
+	pAsync->ran = *pRan;
+	
+	if (pthread_create(&pAsync->thread, NULL, RanAsyncProducer, pAsync) != 0)
 	{
-		sprintf(s_sTime + len, " s"); len += 2;
-	}	
-	return s_sTime;
+		free(pAlloc);
+		return -1;
+	}
+#ifdef CPU_SET
+	if (iCpu >= 0)
+	{
+		cpu_set_t cpuset;
+		
+		CPU_ZERO(&cpuset);
+		CPU_SET(iCpu, &cpuset);
+		if (pthread_setaffinity_np(pAsync->thread, sizeof(cpuset), 
+		                           &cpuset) == 0)
+			pAsync->iCpu = iCpu;
+	}
+#else
+	(void)iCpu;
+#endif
+	
+	pthread_mutex_lock(&s_mutexAsync);
+	pAsync->pOwner = pRan;
+	pAsync->pNext = s_pAsyncList;
+	s_pAsyncList = pAsync;
+	pthread_mutex_unlock(&s_mutexAsync);
+	
+	/* the state of the consumer is not to be used until RanAsyncStop_r */
+	pRan->pAsync = pAsync;
+	pRan->bHalf = 0;
+	pRan->fnDRanu = DRan_asynctrap;
+	pRan->fnU32Ranu = U32Ran_asynctrap;
+	pRan->fnU64Ranu = U64Ran_asynctrap;
+	pRan->fnDRanuVec = DRanVec_asynctrap;
+	pRan->fnU32RanuVec = U32RanVec_asynctrap;
+	pRan->fnU64RanuVec = U64RanVec_asynctrap;
+	pRan->fnDRanNormalZigVec = DRanVec_asynctrap;
+	pRan->fnFRanuVec = FRanVec_asynctrap;
+	pRan->fnFRanNormalZigVec = FRanVec_asynctrap;
+	if (pAsync->iKind == RANASYNC_UNIFORM)
+	{
+		pRan->fnDRanu = DRan_async;
+		pRan->fnDRanuVec = DRanVec_async;
+	}
+	else
+		pRan->fnDRanNormalZigVec = DRanVec_async;
+	return 0;
+#else
+	(void)pRan;
+	(void)iKind;
+	(void)nDepth;
+	(void)iCpu;
+	return -1;
+#endif
 }
-char * GetLapsedTime(void)
+
+#ifndef RANDOMMW_PTHREADS
+static void RanAsyncEndOwner(RANSTATE *pRan)
 {
-    return GetTimeSpan(ClockStopDblHsec(), ClockStartDblHsec());
+	(void)pRan;
 }
-/*-------------------------- END timer functions ---------------------------*/
+#endif
+
+/* Counters of the asynchronous mode (all zero if not active) */
+void	RanAsyncStats_r(RANSTATE *pRan, RANASYNCSTATS *pStats)
+{
+	struct RANASYNC *pAsync = pRan->pAsync;
+	
+	memset(pStats, 0, sizeof(RANASYNCSTATS));
+	pStats->iCpu = -1;
+	if (pAsync == NULL)
+		return;
+	pStats->uProduced = __atomic_load_n(&pAsync->uHead, __ATOMIC_ACQUIRE);
+	pStats->uConsumed = pAsync->uTailLocal;
+	pStats->uStalls = __atomic_load_n(&pAsync->uStalls, __ATOMIC_RELAXED);
+	pStats->uWaits = pAsync->uWaits;
+	pStats->iCpu = pAsync->iCpu;
+}
+
+/* Stop the producer thread, and take the generator state back; the final
+   counters are stored in pStats, unless it is NULL */
+void	RanAsyncStop_r(RANSTATE *pRan, RANASYNCSTATS *pStats)
+{
+	struct RANASYNC *pAsync = pRan->pAsync;
+#ifdef RANDOMMW_PTHREADS
+	struct RANASYNC **ppAsync;
+#endif
+	
+	if (pAsync == NULL)
+	{
+		if (pStats != NULL)
+			RanAsyncStats_r(pRan, pStats);
+		return;
+	}
+#ifdef RANDOMMW_PTHREADS
+	__atomic_store_n(&pAsync->bStop, 1, __ATOMIC_RELEASE);
+	pthread_join(pAsync->thread, NULL);
+	pthread_mutex_lock(&s_mutexAsync);
+	for (ppAsync = &s_pAsyncList; *ppAsync != NULL; 
+	     ppAsync = &(*ppAsync)->pNext)
+		if (*ppAsync == pAsync)
+		{
+			*ppAsync = pAsync->pNext;
+			break;
+		}
+	pthread_mutex_unlock(&s_mutexAsync);
+#endif
+	if (pStats != NULL)
+		RanAsyncStats_r(pRan, pStats);
+	*pRan = pAsync->ran;
+	pRan->pAsync = NULL;
+	free(pAsync->pAlloc);
+}
+
+int		RanAsyncStart(int iKind, size_t nDepth, int iCpu)
+{
+	return RanAsyncStart_r(&s_ranDefault, iKind, nDepth, iCpu);
+}
+
+void	RanAsyncStop(RANASYNCSTATS *pStats)
+{
+	RanAsyncStop_r(&s_ranDefault, pStats);
+}
+
+void	RanAsyncStats(RANASYNCSTATS *pStats)
+{
+	RanAsyncStats_r(&s_ranDefault, pStats);
+}
+/*----------------------- END asynchronous mode ----------------------------*/
 
 /*==========================================================================*/
 
@@ -0,0 +1,246 @@
+/*==========================================================================
+ *==========================================================================
+ * C++ engine classes for randommw
+ *
+ * Header-only C++20 layer on top of `randommw.h`. Each uniform RNG is
+ * available as an engine class with its state held inline (a RANSTATE
+ * member), which satisfies std::uniform_random_bit_generator, and can
+ * therefore be used with the distributions of <random>:
+ *
+ *   randommw::xoshiro256p, randommw::pcg64dxsm, randommw::mwc8222,
+ *   randommw::lehmer64, randommw::melg19937, randommw::philox4x32
+ *
+ * operator() calls the RNG routine of the engine directly, instead of
+ * through the function pointers of the RANSTATE, so that it can be
+ * inlined. randommw::zignor_normal<Engine> is the normal ziggurat selected
+ * for the engine with RanSetZig_r(e.state(), sZig) (Doornik's ZIGNOR by
+ * default), compiled for a specific engine (DRanNormalZig_inline and its
+ * variants, section F of `randommw.h`).
+ *
+ * An engine constructed with (uSeed, uJumpsize) gives the same stream as
+ * RanInit_r(pRan, sRan, uSeed, uJumpsize), i.e. operator() returns the
+ * numbers of U64RanU_r, and zignor_normal those of DRanNormalZig_r.
+ *
+ * Every engine holds a complete RANSTATE (about 14 KB, mostly the state
+ * of MWC8222 and MELG19937 and the output buffers of the SIMD RNGs), also
+ * for RNGs with a small state such as Xoshiro256+. Declare engines static
+ * or allocate them on the heap rather than on small (thread) stacks.
+ *
+ * discard(z) is an algorithmic advance, O(log z), for PCG64DXSM, MWC8222,
+ * Lehmer64 and Philox4x32-10. Xoshiro256+ and MELG19937 only have jumps
+ * of a fixed size, and their discard(z) generates z numbers, O(z).
+ *
+ * In asynchronous mode (RanAsyncStart_r(e.state(), ...)), the draws follow
+ * the C API: zignor_normal (RANASYNC_NORMAL) or uniform() (RANASYNC_UNIFORM)
+ * read from the ring buffer, and the other draws abort the program, as
+ * U64RanU_r. discard(), jump() and set_stream() stop the asynchronous mode.
+ *
+ * As `randommw.h`, this file contains the definitions of the C functions,
+ * and should be included in only one translation unit of a program.
+ *
+ * M. H. V. Werts, 2025
+ *
+ * Distributed under the CeCILL-C license (see LICENSE)
+ *
+ *==========================================================================
+ *==========================================================================*/
+
+#ifndef RANDOMMW_HPP
+#define RANDOMMW_HPP
+
+#include <cstdint>
+#include <limits>
+
+#include "randommw.h"
+
+namespace randommw {
+
+/* The RNG routines of each engine, called with a constant function, so
+   that they are inlined in operator() and in the ziggurat. Advance is
+   the algorithmic advance by uSteps 64-bit numbers where available, and
+   generates and discards uSteps numbers otherwise (Xoshiro256+ and
+   MELG19937). */
+#define RANDOMMW_KERNEL(kname, sname, fname)                                  \
+struct kname                                                                  \
+{                                                                             \
+	static constexpr const char *sRan = sname;                                \
+	static inline double DRan(RANSTATE *pRan)                                 \
+		{ return DRan_##fname(pRan); }                                        \
+	static inline uint32_t U32Ran(RANSTATE *pRan)                             \
+		{ return U32Ran_##fname(pRan); }                                      \
+	static inline uint64_t U64Ran(RANSTATE *pRan)                             \
+		{ return U64Ran_##fname(pRan); }                                      \
+	static void Jump(RANSTATE *pRan, uint64_t uJumps)                         \
+		{ RanJump_##fname(pRan, uJumps); }                                    \
+	static void Advance(RANSTATE *pRan, uint64_t uSteps);                     \
+};
+
+RANDOMMW_KERNEL(xoshiro256p_kernel, "Xoshiro256+", xoshiro256p)
+RANDOMMW_KERNEL(pcg64dxsm_kernel, "PCG64DXSM", pcg64dxsm)
+RANDOMMW_KERNEL(mwc8222_kernel, "MWC8222", MWC8222)
+RANDOMMW_KERNEL(lehmer64_kernel, "Lehmer64", lehmer64)
+RANDOMMW_KERNEL(melg19937_kernel, "MELG19937", MELG19937)
+RANDOMMW_KERNEL(philox4x32_kernel, "Philox4x32-10", philox4x32)
+
+#undef RANDOMMW_KERNEL
+
+inline void xoshiro256p_kernel::Advance(RANSTATE *pRan, uint64_t uSteps)
+{
+	for (uint64_t i = 0; i < uSteps; i++)
+		U64Ran_xoshiro256p(pRan);
+}
+
+inline void pcg64dxsm_kernel::Advance(RANSTATE *pRan, uint64_t uSteps)
+{
+	RanAdvance_pcg64dxsm(pRan, uSteps);
+}
+
+inline void mwc8222_kernel::Advance(RANSTATE *pRan, uint64_t uSteps)
+{
+	RanAdvance_MWC8222(pRan, uSteps);
+}
+
+inline void lehmer64_kernel::Advance(RANSTATE *pRan, uint64_t uSteps)
+{
+	RanAdvance_lehmer64(pRan, uSteps);
+}
+
+inline void melg19937_kernel::Advance(RANSTATE *pRan, uint64_t uSteps)
+{
+	for (uint64_t i = 0; i < uSteps; i++)
+		U64Ran_MELG19937(pRan);
+}
+
+inline void philox4x32_kernel::Advance(RANSTATE *pRan, uint64_t uSteps)
+{
+	RanAdvance_philox4x32(pRan, uSteps);
+}
+
+
+/* Engine with 64-bit output. The RANSTATE is fully initialized by
+   RanInit_r, so that it may also be passed to the reentrant C functions
+   (e.g. DRanUVec_r) through state(). */
+template <class Kernel>
+class engine
+{
+public:
+	using result_type = uint64_t;
+	using kernel_type = Kernel;
+
+	static constexpr uint64_t default_seed = 0;
+
+	explicit engine(uint64_t uSeed = default_seed, uint64_t uJumpsize = 0)
+	{
+		seed(uSeed, uJumpsize);
+	}
+
+	void seed(uint64_t uSeed = default_seed, uint64_t uJumpsize = 0)
+	{
+		RanInit_r(&m_ran, Kernel::sRan, uSeed, uJumpsize);
+	}
+
+	static constexpr result_type min() { return 0; }
+	static constexpr result_type max()
+	{
+		return std::numeric_limits<result_type>::max();
+	}
+
+	/* in asynchronous mode, the draws go through the RANSTATE, which
+	   reads from the ring buffer or traps (see RanAsyncStart_r) */
+	result_type operator()()
+	{
+		if (m_ran.pAsync != NULL)
+			return m_ran.fnU64Ranu(&m_ran);
+		return Kernel::U64Ran(&m_ran);
+	}
+
+	/* uniform double on (0, 1), as DRanU */
+	double uniform()
+	{
+		if (m_ran.pAsync != NULL)
+			return m_ran.fnDRanu(&m_ran);
+		return Kernel::DRan(&m_ran);
+	}
+
+	/* skip z numbers: O(log z) for PCG64DXSM, MWC8222, Lehmer64 and
+	   Philox4x32-10, but O(z) for Xoshiro256+ and MELG19937, which
+	   generate the z numbers (use jump() for large distances) */
+	void discard(unsigned long long z)
+	{
+		RanAsyncEnd(&m_ran);
+		m_ran.bHalf = 0;
+		Kernel::Advance(&m_ran, z);
+	}
+
+	void jump(uint64_t uJumps = 1)
+	{
+		RanAsyncEnd(&m_ran);
+		m_ran.bHalf = 0;
+		Kernel::Jump(&m_ran, uJumps);
+	}
+
+	/* stream of particle uId at time step uStep (Philox4x32-10 only, as
+	   RanSetStream_r: -1 for the other RNGs) */
+	int set_stream(uint64_t uId, uint64_t uStep)
+	{
+		return RanSetStream_r(&m_ran, uId, uStep);
+	}
+
+	RANSTATE *state() { return &m_ran; }
+
+private:
+	/* The complete RANSTATE (about 14 KB) instead of a state for this RNG
+	   only: state() must be usable with every reentrant C function, and
+	   RanInit_r, the bulk routines and the ziggurats all work on a
+	   RANSTATE. The size matters only for engines on the stack, and is
+	   small compared to the buffers that are usually filled with it. */
+	RANSTATE m_ran;
+};
+
+using xoshiro256p = engine<xoshiro256p_kernel>;
+using pcg64dxsm = engine<pcg64dxsm_kernel>;
+using mwc8222 = engine<mwc8222_kernel>;
+using lehmer64 = engine<lehmer64_kernel>;
+using melg19937 = engine<melg19937_kernel>;
+using philox4x32 = engine<philox4x32_kernel>;
+
+
+/* Normal distribution N(0, 1) by the ziggurat selected in the RANSTATE of
+   the engine (RanSetZig_r, ZIGNOR by default), inlined for the given
+   engine; same dispatch as DRanNormalZig_r */
+template <class Engine>
+class zignor_normal
+{
+public:
+	using result_type = double;
+
+	void reset() {}
+
+	static constexpr result_type min()
+	{
+		return std::numeric_limits<result_type>::lowest();
+	}
+	static constexpr result_type max()
+	{
+		return std::numeric_limits<result_type>::max();
+	}
+
+	result_type operator()(Engine &e)
+	{
+		using K = typename Engine::kernel_type;
+		RANSTATE *pRan = e.state();
+		int iZig = pRan->iZig;
+
+		if (pRan->pAsync != NULL)
+			return DRanNormalZig_r(pRan);
+		if (iZig & RANZIG_MCFARLAND)
+			return DRanNormalZigMF_inline(pRan, K::U64Ran, K::DRan);
+		if (iZig & RANZIG_ZIGNOR1)
+			return DRanNormalZig1_inline(pRan, K::U64Ran, K::DRan, iZig);
+		return DRanNormalZig_inline(pRan, K::DRan, K::U32Ran, iZig);
+	}
+};
+
+} // namespace randommw
+
+#endif // RANDOMMW_HPP
@@ -0,0 +1,269 @@
+/*
+
+test_advance.c
+
+Check RanAdvanceRan and the MWC8222, Lehmer64, MELG19937 and Philox4x32-10
+jumps.
+
+- RanAdvanceRan(n) gives the same stream as n calls of U64RanU, for every
+  uniform RNG (algorithmic advance for MWC8222, Lehmer64, PCG64DXSM and
+  Philox4x32-10, discarding numbers for the other RNGs)
+- advances add up: RanAdvanceRan(a) followed by RanAdvanceRan(b) is
+  RanAdvanceRan(a + b), also for numbers of steps too large to discard
+- a Lehmer64 jump is an advance by 2^64 steps from the state made odd,
+  also for seeds that give an even state, and the MWC8222 jump
+  multiplier is b^-(2^256) mod m (256 squarings of b^-1)
+- RanJumpRan(a + b) is RanJumpRan(a) followed by RanJumpRan(b), and
+  RanInit(.., uJumpsize) is RanInit(.., 0) followed by RanJumpRan(uJumpsize),
+  except for MWC8222 and Lehmer64, whose RanInit(.., uJumpsize) streams 
+  are those of earlier versions (unless compiled with 
+  RANDOMMW_SEEDJUMP_JUMPS defined)
+- a Philox4x32-10 jump is an advance by 2^65 steps (2^64 blocks)
+- 2^62 Lehmer64 jumps (2^126 steps, the period) return to the same stream,
+  the jumped Lehmer64 state is odd, and with RANDOMMW_SEEDJUMP_JUMPS,
+  RanInit gives an odd Lehmer64 state
+- splitmix64_advance_r(n) is n calls of splitmix64_next_r
+
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <inttypes.h>
+#include <string.h>
+
+#include "randommw.h"
+
+#define NGEN 8
+#define NCMP 1000
+
+#ifdef RANDOMMW_SEEDJUMP_JUMPS
+#define SEEDJUMP_JUMPS 1
+#else
+#define SEEDJUMP_JUMPS 0
+#endif
+
+static const char *sLarge[4] = {"MWC8222", "Lehmer64", "PCG64DXSM",
+                                 "Philox4x32-10"};
+static const char *sGen[NGEN] = {"MWC8222", "Lehmer64", "PCG64DXSM",
+                                 "Xoshiro256+", "MELG19937",
+                                 "Xoshiro256+x4", "Xoshiro256+x8",
+                                 "Philox4x32-10"};
+
+/* number of mismatches between the next NCMP numbers of two streams */
+static int compare(RANSTATE *pRan1, RANSTATE *pRan2)
+{
+	int i, nfail = 0;
+
+	for (i = 0; i < NCMP; i++)
+		nfail += (U64RanU_r(pRan1) != U64RanU_r(pRan2));
+	return nfail;
+}
+
+/* RanJumpRan(a + b) = RanJumpRan(a) + RanJumpRan(b), and, if bSeedJump,
+   RanInit(.., uJumpsize) = RanInit(.., 0) + RanJumpRan(uJumpsize) */
+static int jumps_add_up(const char *sRan, uint64_t zigseed, int bSeedJump)
+{
+	static RANSTATE ran1, ran2;
+	int nfail;
+
+	RanInit_r(&ran1, sRan, zigseed, 0);
+	RanInit_r(&ran2, sRan, zigseed, 0);
+	RanJumpRan_r(&ran1, 3);
+	RanJumpRan_r(&ran1, 4094);
+	RanJumpRan_r(&ran2, 4097);
+	nfail = compare(&ran1, &ran2);
+	if (!bSeedJump)
+		return nfail;
+	RanInit_r(&ran1, sRan, zigseed, 17);
+	RanInit_r(&ran2, sRan, zigseed, 0);
+	RanJumpRan_r(&ran2, 17);
+	nfail += compare(&ran1, &ran2);
+	return nfail;
+}
+
+#if !SEEDJUMP_JUMPS
+/* first two 32-bit numbers of RanInit(sRan, 12345, uJumpsize) for 
+   uJumpsize = 1, 17 and 1000, from the version before the MWC8222 and
+   Lehmer64 jumps */
+static int seedjump_unchanged(const char *sRan, const uint32_t *puRef)
+{
+	static RANSTATE ran;
+	const uint64_t auJumpsize[3] = {1, 17, 1000};
+	int k, nfail = 0;
+
+	for (k = 0; k < 3; k++)
+	{
+		RanInit_r(&ran, sRan, 12345, auJumpsize[k]);
+		nfail += (U32RanU_r(&ran) != puRef[2 * k]);
+		nfail += (U32RanU_r(&ran) != puRef[2 * k + 1]);
+	}
+	return nfail;
+}
+
+static const uint32_t s_auRefMWC8222[6] = {0x3bef0d8c, 0xb1f3cfb7, 
+	0xddd7e744, 0xe3286e92, 0x8abdf1a0, 0xc33e6ca4};
+static const uint32_t s_auRefLehmer64[6] = {0x2cc14369, 0xc2e0f519,
+	0x308a4ec0, 0xcd8e9c33, 0xeec0fd13, 0x56e4a4ca};
+#endif
+
+int main(void)
+{
+	static RANSTATE ran1, ran2;
+	const uint64_t auSteps[4] = {1, 255, 1000, 123457};
+	uint64_t zigseed = 12345;
+	uint64_t z[MWC_JUMP_LIMBS];
+	uint64_t uSplitmix1, uSplitmix2;
+	uint64_t i;
+	unsigned int j, k;
+	int nfail, nfailtot = 0;
+
+	printf("RanAdvanceRan(n) and n calls of U64RanU\n");
+	for (j = 0; j < NGEN; j++)
+	{
+		nfail = 0;
+		for (k = 0; k < 4; k++)
+		{
+			RanInit_r(&ran1, sGen[j], zigseed, 0);
+			RanInit_r(&ran2, sGen[j], zigseed, 0);
+			FRanU_r(&ran1); // pending half is discarded
+			RanAdvanceRan_r(&ran1, auSteps[k]);
+			for (i = 0; i < auSteps[k] + 1; i++)
+				U64RanU_r(&ran2);
+			nfail += compare(&ran1, &ran2);
+		}
+		printf("%-14s %s\n", sGen[j], (nfail == 0) ? "OK" : "FAILED");
+		nfailtot += nfail;
+	}
+
+	printf("\nlarge advances\n");
+	for (j = 0; j < 4; j++)
+	{
+		RanInit_r(&ran1, sLarge[j], zigseed, 0);
+		RanInit_r(&ran2, sLarge[j], zigseed, 0);
+		RanAdvanceRan_r(&ran1, UINT64_C(0x8000000000000001));
+		RanAdvanceRan_r(&ran1, UINT64_C(0x7fffffffffffffff));
+		RanAdvanceRan_r(&ran2, UINT64_C(0xffffffffffffffff));
+		RanAdvanceRan_r(&ran2, 1);
+		nfail = compare(&ran1, &ran2);
+		RanInit_r(&ran1, sLarge[j], zigseed, 0);
+		RanInit_r(&ran2, sLarge[j], zigseed, 0);
+		RanAdvanceRan_r(&ran1, UINT64_C(0x9e3779b97f4a7c15));
+		RanAdvanceRan_r(&ran2, UINT64_C(0x1e3779b97f4a7c15));
+		RanAdvanceRan_r(&ran2, UINT64_C(0x8000000000000000));
+		nfail += compare(&ran1, &ran2);
+		printf("%-14s %s\n", sLarge[j], (nfail == 0) ? "OK" : "FAILED");
+		nfailtot += nfail;
+	}
+
+	printf("\nLehmer64 jumps\n");
+	nfail = 0;
+	for (i = 0; i < 8; i++)
+	{
+		// seeds 0...7 give both even and odd states
+		RanInit_r(&ran1, "Lehmer64", i, 0);
+		RanInit_r(&ran2, "Lehmer64", i, 0);
+		RanJumpRan_r(&ran1, 1);
+		ran2.lehmer64_state |= 1;
+		RanAdvanceRan_r(&ran2, UINT64_C(0x8000000000000000));
+		RanAdvanceRan_r(&ran2, UINT64_C(0x8000000000000000));
+		nfail += compare(&ran1, &ran2);
+	}
+	printf("%-30s %s\n", "jump is 2^64 steps", (nfail == 0) ? "OK" : "FAILED");
+	nfailtot += nfail;
+
+	nfail = 0;
+	for (i = 0; i < 100; i++)
+	{
+		RanInit_r(&ran1, "Lehmer64", i, 0);
+		RanJumpRan_r(&ran1, 1);
+		nfail += ((ran1.lehmer64_state & 1) == 0);
+	}
+	printf("%-30s %s\n", "jumped state is odd", (nfail == 0) ? "OK" : "FAILED");
+	nfailtot += nfail;
+
+	nfail = jumps_add_up("Lehmer64", zigseed, SEEDJUMP_JUMPS);
+	printf("%-30s %s\n", "jumps add up", (nfail == 0) ? "OK" : "FAILED");
+	nfailtot += nfail;
+
+#if !SEEDJUMP_JUMPS
+	nfail = seedjump_unchanged("Lehmer64", s_auRefLehmer64);
+	printf("%-30s %s\n", "RanInit streams unchanged", 
+	       (nfail == 0) ? "OK" : "FAILED");
+	nfailtot += nfail;
+#else
+	nfail = 0;
+	for (i = 0; i < 100; i++)
+	{
+		RanInit_r(&ran1, "Lehmer64", i, 0);
+		nfail += ((ran1.lehmer64_state & 1) == 0);
+	}
+	printf("%-30s %s\n", "seeded state is odd", (nfail == 0) ? "OK" : "FAILED");
+	nfailtot += nfail;
+#endif
+
+	RanInit_r(&ran1, "Lehmer64", zigseed, 0);
+	RanInit_r(&ran2, "Lehmer64", zigseed, 0);
+	RanJumpRan_r(&ran1, 1);
+	RanJumpRan_r(&ran2, (UINT64_C(1) << 62) + 1);
+	nfail = compare(&ran1, &ran2);
+	printf("%-30s %s\n", "period is 2^126", (nfail == 0) ? "OK" : "FAILED");
+	nfailtot += nfail;
+
+	printf("\nMWC8222 jumps\n");
+	memset(z, 0, sizeof(z));
+	z[MWC_R / 2 - 1] = MWC_A << 32;
+	for (i = 0; i < 256; i++)
+		mwc_mp_mulmod(z, z);
+	nfail = (memcmp(z, s_auMWCJump, sizeof(z)) != 0);
+	printf("%-30s %s\n", "jump is 2^256 steps", (nfail == 0) ? "OK" : "FAILED");
+	nfailtot += nfail;
+
+	nfail = jumps_add_up("MWC8222", zigseed, SEEDJUMP_JUMPS);
+	printf("%-30s %s\n", "jumps add up", (nfail == 0) ? "OK" : "FAILED");
+	nfailtot += nfail;
+
+#if !SEEDJUMP_JUMPS
+	nfail = seedjump_unchanged("MWC8222", s_auRefMWC8222);
+	printf("%-30s %s\n", "RanInit streams unchanged", 
+	       (nfail == 0) ? "OK" : "FAILED");
+	nfailtot += nfail;
+#endif
+
+	printf("\nMELG19937 jumps\n");
+	nfail = jumps_add_up("MELG19937", zigseed, 1);
+	printf("%-30s %s\n", "jumps add up", (nfail == 0) ? "OK" : "FAILED");
+	nfailtot += nfail;
+
+	printf("\nPhilox4x32-10 jumps\n");
+	RanInit_r(&ran1, "Philox4x32-10", zigseed, 0);
+	RanInit_r(&ran2, "Philox4x32-10", zigseed, 0);
+	RanJumpRan_r(&ran1, 1);
+	RanAdvanceRan_r(&ran2, UINT64_C(0x8000000000000000));
+	RanAdvanceRan_r(&ran2, UINT64_C(0x8000000000000000));
+	RanAdvanceRan_r(&ran2, UINT64_C(0x8000000000000000));
+	RanAdvanceRan_r(&ran2, UINT64_C(0x8000000000000000));
+	nfail = compare(&ran1, &ran2);
+	printf("%-30s %s\n", "jump is 2^65 steps", (nfail == 0) ? "OK" : "FAILED");
+	nfailtot += nfail;
+
+	nfail = jumps_add_up("Philox4x32-10", zigseed, 1);
+	printf("%-30s %s\n", "jumps add up", (nfail == 0) ? "OK" : "FAILED");
+	nfailtot += nfail;
+
+	printf("\nSplitmix64\n");
+	nfail = 0;
+	for (k = 0; k < 4; k++)
+	{
+		uSplitmix1 = uSplitmix2 = zigseed;
+		splitmix64_advance_r(&uSplitmix1, auSteps[k]);
+		for (i = 0; i < auSteps[k]; i++)
+			splitmix64_next_r(&uSplitmix2);
+		nfail += (splitmix64_next_r(&uSplitmix1) != splitmix64_next_r(&uSplitmix2));
+	}
+	printf("%-30s %s\n", "advance", (nfail == 0) ? "OK" : "FAILED");
+	nfailtot += nfail;
+
+	printf("\n%d mismatches\n", nfailtot);
+
+	return (nfailtot != 0);
+}
@@ -0,0 +1,248 @@
+/*
+
+test_async.c
+
+Check the asynchronous mode (RanAsyncStart, RanAsyncStop).
+
+- with a producer thread, DRanNormalZig and DRanU give the same sequence
+  as the synchronous generator, for every uniform RNG and several depths
+  of the ring buffer
+- after RanAsyncStop, the generator continues after the last number
+  generated by the producer
+- the counters are consistent
+- DRanNormalZigVec (or DRanUVec) reads the same ring buffer
+- mixing DRanU with DRanNormalZig (or the reverse) in asynchronous mode
+  aborts, instead of returning correlated numbers
+- RanInit and RanJumpRan stop the asynchronous mode
+- compare the time per call of DRanNormalZig, with and without the
+  asynchronous mode
+
+Without POSIX threads (or with RANDOMMW_NO_THREADS), the asynchronous
+mode is not supported, and the checks are skipped. The abort on misuse
+is checked in a child process, on POSIX systems only.
+
+*/
+
+#define _GNU_SOURCE		// CPU affinity of the producer thread
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <inttypes.h>
+#include <string.h>
+#if defined(__unix__) || defined(__APPLE__)
+#include <signal.h>
+#include <unistd.h>
+#include <sys/wait.h>
+#define CHECK_MISUSE 1
+#endif
+
+#include "randommw.h"
+
+#define NGEN 8
+#define NSAMPLES 1000000
+#define NTIME 100000000
+#define NVEC 10000
+
+static const char *sGen[NGEN] = {"MWC8222", "Lehmer64", "PCG64DXSM",
+                                 "Xoshiro256+", "MELG19937",
+                                 "Xoshiro256+x4", "Xoshiro256+x8",
+                                 "Philox4x32-10"};
+static const size_t anDepth[3] = {0, 100, 65536};
+
+/* number of mismatches between the asynchronous and synchronous streams
+   of DRanNormalZig (iKind RANASYNC_NORMAL) or DRanU */
+static int check_async(const char *sRan, int iKind, size_t nDepth,
+                       uint64_t zigseed, uint64_t jumpsize)
+{
+	static RANSTATE ran1, ran2;
+	static double adVec[2 * NVEC];
+	RANASYNCSTATS st;
+	uint64_t i;
+	int nfail = 0;
+
+	RanInit_r(&ran1, sRan, zigseed, jumpsize);
+	RanInit_r(&ran2, sRan, zigseed, jumpsize);
+	RanSetZig_r(&ran1, "ZIGNOR1W");
+	RanSetZig_r(&ran2, "ZIGNOR1W");
+	if (RanAsyncStart_r(&ran1, iKind, nDepth, 0) != 0)
+		return 1;
+	for (i = 0; i < NSAMPLES; i++)
+		if (iKind == RANASYNC_NORMAL)
+			nfail += (DRanNormalZig_r(&ran1) != DRanNormalZig_r(&ran2));
+		else
+			nfail += (DRanU_r(&ran1) != DRanU_r(&ran2));
+	
+	/* bulk reads from the ring buffer continue the same sequence */
+	for (i = 0; i < NVEC; i++)
+		if (iKind == RANASYNC_NORMAL)
+			adVec[i] = DRanNormalZig_r(&ran2);
+		else
+			adVec[i] = DRanU_r(&ran2);
+	if (iKind == RANASYNC_NORMAL)
+		DRanNormalZigVec_r(&ran1, adVec + NVEC, NVEC);
+	else
+		DRanUVec_r(&ran1, adVec + NVEC, NVEC);
+	nfail += (memcmp(adVec, adVec + NVEC, NVEC * sizeof(double)) != 0);
+	RanAsyncStop_r(&ran1, &st);
+	nfail += (st.uConsumed != NSAMPLES + NVEC) || 
+	         (st.uProduced < NSAMPLES + NVEC);
+	nfail += (st.uProduced - st.uConsumed > 65536); // at most the depth
+
+	/* the producer has generated uProduced numbers */
+	for (i = NSAMPLES + NVEC; i < st.uProduced; i++)
+		if (iKind == RANASYNC_NORMAL)
+			DRanNormalZig_r(&ran2);
+		else
+			DRanU_r(&ran2);
+	for (i = 0; i < 1000; i++)
+		nfail += (U64RanU_r(&ran1) != U64RanU_r(&ran2));
+	return nfail;
+}
+
+/* 1 if the asynchronous mode is available (POSIX threads) */
+static int async_available(void)
+{
+	static RANSTATE ran;
+
+	RanInit_r(&ran, "MWC8222", 12345, 0);
+	if (RanAsyncStart_r(&ran, RANASYNC_NORMAL, 0, -1) != 0)
+		return 0;
+	RanAsyncStop_r(&ran, NULL);
+	return 1;
+}
+
+#ifdef CHECK_MISUSE
+/* 1 if mixing the draw functions of the two modes does not abort */
+static int check_misuse(int iKind)
+{
+	pid_t pid;
+	int status;
+
+	fflush(stdout);
+	pid = fork();
+	if (pid == 0)
+	{
+		if (freopen("/dev/null", "w", stderr) == NULL)
+			_exit(0);
+		RanInit("MWC8222", 12345, 0);
+		RanAsyncStart(iKind, 0, -1);
+		if (iKind == RANASYNC_NORMAL)
+		{
+			DRanNormalZig();
+			DRanU();
+		}
+		else
+		{
+			DRanU();
+			DRanNormalZig();
+		}
+		_exit(0);
+	}
+	if ((pid < 0) || (waitpid(pid, &status, 0) != pid))
+		return 1;
+	return !(WIFSIGNALED(status) && (WTERMSIG(status) == SIGABRT));
+}
+#endif
+
+/* number of mismatches after RanInit_r in asynchronous mode, and 1 if
+   RanInit_r or RanJumpRan_r does not stop the asynchronous mode */
+static int check_restart(void)
+{
+	static RANSTATE ran1, ran2;
+	RANASYNCSTATS st;
+	uint64_t i;
+	int nfail = 0;
+
+	RanInit_r(&ran1, "Xoshiro256+", 12345, 0);
+	RanAsyncStart_r(&ran1, RANASYNC_NORMAL, 0, -1);
+	for (i = 0; i < 1000; i++)
+		DRanNormalZig_r(&ran1);
+	RanInit_r(&ran1, "Xoshiro256+", 54321, 1);
+	RanInit_r(&ran2, "Xoshiro256+", 54321, 1);
+	RanAsyncStats_r(&ran1, &st);
+	nfail += (st.uProduced != 0);
+	for (i = 0; i < 1000; i++)
+		nfail += (DRanU_r(&ran1) != DRanU_r(&ran2));
+
+	RanAsyncStart_r(&ran1, RANASYNC_UNIFORM, 0, -1);
+	RanJumpRan_r(&ran1, 1);
+	RanAsyncStats_r(&ran1, &st);
+	nfail += (st.uProduced != 0);
+	U64RanU_r(&ran1);
+	return nfail;
+}
+
+int main(void)
+{
+	RANASYNCSTATS st;
+	uint64_t zigseed = 12345;
+	uint64_t jumpsize = 1;
+	unsigned int i, j, k;
+	int nfail, nfailtot = 0;
+	int bAsync = async_available();
+
+	printf("asynchronous and synchronous streams\n");
+	for (j = 0; j < NGEN; j++)
+	{
+		if (!bAsync)
+		{
+			printf("%-14s %s\n", sGen[j], "not supported");
+			continue;
+		}
+		nfail = 0;
+		for (k = 0; k < 3; k++)
+		{
+			nfail += check_async(sGen[j], RANASYNC_NORMAL, anDepth[k],
+			                     zigseed, jumpsize);
+			nfail += check_async(sGen[j], RANASYNC_UNIFORM, anDepth[k],
+			                     zigseed, jumpsize);
+		}
+		printf("%-14s %s\n", sGen[j], (nfail == 0) ? "OK" : "FAILED");
+		nfailtot += nfail;
+	}
+
+	printf("\nmisuse in asynchronous mode\n");
+	if (!bAsync)
+		printf("%-14s %s\n", "mixed draws", "not supported");
+	else
+	{
+#ifdef CHECK_MISUSE
+		nfail = check_misuse(RANASYNC_NORMAL) + 
+		        check_misuse(RANASYNC_UNIFORM);
+		printf("%-14s %s\n", "mixed draws", (nfail == 0) ? "abort" : "FAILED");
+		nfailtot += nfail;
+#else
+		printf("%-14s %s\n", "mixed draws", "not tested");
+#endif
+	}
+	nfail = bAsync ? check_restart() : 0;
+	printf("%-14s %s\n", "RanInit", !bAsync ? "not supported" :
+	       (nfail == 0) ? "OK" : "FAILED");
+	nfailtot += nfail;
+
+	printf("\ntimings for %d normal variates\n", NTIME);
+	RanInit("Xoshiro256+", zigseed, jumpsize);
+	StartTimer();
+	for (i = 0; i < NTIME; i++)
+		DRanNormalZig();
+	StopTimer();
+	printf("%-14s %10s\n", "synchronous", GetLapsedTime());
+	if (bAsync)
+	{
+		RanAsyncStart(RANASYNC_NORMAL, 0, -1);
+		StartTimer();
+		for (i = 0; i < NTIME; i++)
+			DRanNormalZig();
+		StopTimer();
+		RanAsyncStop(&st);
+		printf("%-14s %10s\n", "asynchronous", GetLapsedTime());
+		printf("producer stalls %" PRIu64 ", consumer waits %" PRIu64 "\n",
+		       st.uStalls, st.uWaits);
+	}
+	else
+		printf("%-14s %10s\n", "asynchronous", "not supported");
+
+	printf("\n%d mismatches\n", nfailtot);
+
+	return (nfailtot != 0);
+}
@@ -0,0 +1,283 @@
+/*
+
+test_bench.c
+
+Benchmark harness for all uniform RNGs and the scalar and bulk interfaces,
+using the high-resolution RANTIMER. The normal interfaces are run with
+ZIGNOR, ZIGNOR1 (DRanNormalZig1) and McFarland's modified ziggurat
+(DRanNormalMF), see RanSetZig. The single precision interfaces (FRanU,
+FRanNormalZig) are included as well. The instruction set of the SIMD
+kernels (RanSetIsa) is the best one supported by the CPU, unless selected
+with -i, and is recorded in the output.
+
+Each generator x interface combination is run a number of times (after
+warm-up runs), each run generating Nsamples numbers. Results are given as
+time per sample (ns) and time-stamp counter ticks per sample (x86 only):
+median, 10th and 90th percentile and minimum over the runs. Output is a
+text table (default), JSON or CSV, for tracking performance across
+compilers, compiler flags and CPUs.
+
+usage: test_bench.exe [-n Nsamples] [-r Nruns] [-w Nwarmup] [-g RNG]
+                      [-i SCALAR|AVX2|AVX512] [-f text|json|csv]
+
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <inttypes.h>
+
+#include "randommw.h"
+
+#define NGEN 8
+#define NAPI 16
+#define NRUNSMAX 1000
+
+static const char *sGen[NGEN] = {"MWC8222", "Lehmer64", "PCG64DXSM",
+                                 "Xoshiro256+", "MELG19937",
+                                 "Xoshiro256+x4", "Xoshiro256+x8",
+                                 "Philox4x32-10"};
+
+static const char *sApi[NAPI] = {"DRanU", "DRanUVec", "U32RanU",
+                                 "U32RanUVec", "U64RanU", "U64RanUVec",
+                                 "DRanNormalZig", "DRanNormalZigVec",
+                                 "DRanNormalZig1", "DRanNormalZig1Vec",
+                                 "DRanNormalMF", "DRanNormalMFVec",
+                                 "FRanU", "FRanUVec", "FRanNormalZig",
+                                 "FRanNormalZigVec"};
+
+typedef struct
+{
+	double dMedian, dP10, dP90, dMin;
+} BENCHSTATS;
+
+static volatile double s_dSink;	// keeps results from being optimized away
+
+/* Generate n numbers with interface iApi, timed with *pTimer */
+static void BenchRun(RANSTATE *pRan, int iApi, void *pBuf, size_t n,
+                     RANTIMER *pTimer)
+{
+	double *pd = (double *)pBuf;
+	float *pf = (float *)pBuf;
+	uint32_t *pu32 = (uint32_t *)pBuf;
+	uint64_t *pu64 = (uint64_t *)pBuf;
+	double dSum = 0.0;
+	uint64_t uSum = 0;
+	size_t i;
+
+	RanTimerStart(pTimer);
+	switch (iApi)
+	{
+		case 0:
+			for (i = 0; i < n; i++)
+				dSum += DRanU_r(pRan);
+			break;
+		case 1:
+			DRanUVec_r(pRan, pd, n);
+			break;
+		case 2:
+			for (i = 0; i < n; i++)
+				uSum += U32RanU_r(pRan);
+			break;
+		case 3:
+			U32RanUVec_r(pRan, pu32, n);
+			break;
+		case 4:
+			for (i = 0; i < n; i++)
+				uSum += U64RanU_r(pRan);
+			break;
+		case 5:
+			U64RanUVec_r(pRan, pu64, n);
+			break;
+		case 6: case 8: case 10:
+			for (i = 0; i < n; i++)
+				dSum += DRanNormalZig_r(pRan);
+			break;
+		case 7: case 9: case 11:
+			DRanNormalZigVec_r(pRan, pd, n);
+			break;
+		case 12:
+			for (i = 0; i < n; i++)
+				dSum += FRanU_r(pRan);
+			break;
+		case 13:
+			FRanUVec_r(pRan, pf, n);
+			break;
+		case 14:
+			for (i = 0; i < n; i++)
+				dSum += FRanNormalZig_r(pRan);
+			break;
+		case 15:
+			FRanNormalZigVec_r(pRan, pf, n);
+			break;
+	}
+	RanTimerStop(pTimer);
+
+	switch (iApi)
+	{
+		case 1: case 7: case 9: case 11:
+			dSum = pd[n / 2];
+			break;
+		case 3:
+			uSum = pu32[n / 2];
+			break;
+		case 13: case 15:
+			dSum = pf[n / 2];
+			break;
+		case 5:
+			uSum = pu64[n / 2];
+			break;
+	}
+	s_dSink = dSum + uSum;
+}
+
+static int CompareDouble(const void *a, const void *b)
+{
+	double da = *(const double *)a, db = *(const double *)b;
+
+	return (da > db) - (da < db);
+}
+
+/* Percentile p (0...100) of sorted array, with linear interpolation */
+static double Percentile(const double *pdSorted, int n, double p)
+{
+	double x = p / 100.0 * (n - 1);
+	int i = (int)x;
+
+	if (i >= n - 1)
+		return pdSorted[n - 1];
+	return pdSorted[i] + (x - i) * (pdSorted[i + 1] - pdSorted[i]);
+}
+
+static void Stats(double *pd, int n, BENCHSTATS *pStats)
+{
+	qsort(pd, n, sizeof(double), CompareDouble);
+	pStats->dMin = pd[0];
+	pStats->dP10 = Percentile(pd, n, 10.0);
+	pStats->dMedian = Percentile(pd, n, 50.0);
+	pStats->dP90 = Percentile(pd, n, 90.0);
+}
+
+int main(int argc, char **argv)
+{
+	size_t nSamples = 1 << 20;
+	int nRuns = 15, nWarmup = 2, iFormat = 0;
+	const char *sOnly = NULL, *sIsa = "";
+	int iarg, g, a, r, bFirst = 1;
+	double adNs[NRUNSMAX], adTicks[NRUNSMAX];
+	BENCHSTATS ns, ticks;
+	RANSTATE *pRan;
+	RANTIMER timer;
+	void *pBuf;
+
+	for (iarg = 1; iarg + 1 < argc; iarg += 2)
+	{
+		if (strcmp(argv[iarg], "-n") == 0)
+			nSamples = strtoull(argv[iarg + 1], NULL, 10);
+		else if (strcmp(argv[iarg], "-r") == 0)
+			nRuns = atoi(argv[iarg + 1]);
+		else if (strcmp(argv[iarg], "-w") == 0)
+			nWarmup = atoi(argv[iarg + 1]);
+		else if (strcmp(argv[iarg], "-g") == 0)
+			sOnly = argv[iarg + 1];
+		else if (strcmp(argv[iarg], "-i") == 0)
+			sIsa = argv[iarg + 1];
+		else if (strcmp(argv[iarg], "-f") == 0)
+			iFormat = (strcmp(argv[iarg + 1], "json") == 0) ? 1 :
+			          (strcmp(argv[iarg + 1], "csv") == 0) ? 2 : 0;
+		else
+			break;
+	}
+	if ((iarg != argc) || (nSamples == 0) || (nRuns < 1) || (nRuns > NRUNSMAX)
+	    || (nWarmup < 0))
+	{
+		printf("usage: %s [-n Nsamples] [-r Nruns] [-w Nwarmup] [-g RNG]"
+		       " [-i SCALAR|AVX2|AVX512] [-f text|json|csv]\n", argv[0]);
+		return 1;
+	}
+
+	pRan = malloc(sizeof(*pRan));
+	pBuf = malloc(nSamples * sizeof(uint64_t));
+	RanInit_r(pRan, "", 17732, 0);
+	RanSetIsa_r(pRan, sIsa);
+	sIsa = RanGetIsa_r(pRan);
+
+	if (iFormat == 1)
+	{
+		printf("{\n  \"compiler\": \"%s\",\n", __VERSION__);
+		printf("  \"isa\": \"%s\",\n", sIsa);
+		printf("  \"samples\": %zu,\n  \"runs\": %d,\n  \"warmup\": %d,\n",
+		       nSamples, nRuns, nWarmup);
+		printf("  \"results\": [\n");
+	}
+	else if (iFormat == 2)
+		printf("generator,api,isa,samples,runs,ns_median,ns_p10,ns_p90,ns_min,"
+		       "ticks_median,ticks_p10,ticks_p90,ticks_min\n");
+	else
+	{
+		printf("%zu samples per run, %d runs (after %d warm-up runs), %s\n",
+		       nSamples, nRuns, nWarmup, sIsa);
+		printf("--------------------------------------------------------------------------\n");
+		printf("%-15s%-18s %29s %9s\n", "", "", "ns/sample", "ticks/s.");
+		printf("%-15s%-18s %9s %9s %9s %9s\n", "RNG", "interface",
+		       "median", "p10", "p90", "median");
+		printf("--------------------------------------------------------------------------\n");
+	}
+
+	for (g = 0; g < NGEN; g++)
+	{
+		if ((sOnly != NULL) && (strcmp(sOnly, sGen[g]) != 0))
+			continue;
+		for (a = 0; a < NAPI; a++)
+		{
+			RanInit_r(pRan, sGen[g], 17732, 0);
+			RanSetIsa_r(pRan, sIsa);
+			if ((a >= 10) && (a < 12))
+				RanSetZig_r(pRan, "MCFARLAND");
+			else if (a >= 8)
+				RanSetZig_r(pRan, "ZIGNOR1");
+			for (r = 0; r < nWarmup; r++)
+				BenchRun(pRan, a, pBuf, nSamples, &timer);
+			for (r = 0; r < nRuns; r++)
+			{
+				BenchRun(pRan, a, pBuf, nSamples, &timer);
+				adNs[r] = 1e9 * RanTimerSeconds(&timer) / nSamples;
+				adTicks[r] = (double)RanTimerTicks(&timer) / nSamples;
+			}
+			Stats(adNs, nRuns, &ns);
+			Stats(adTicks, nRuns, &ticks);
+
+			if (iFormat == 1)
+			{
+				printf("%s    {\"generator\": \"%s\", \"api\": \"%s\", "
+				       "\"ns_per_sample\": {\"median\": %.4f, \"p10\": %.4f, "
+				       "\"p90\": %.4f, \"min\": %.4f}, "
+				       "\"ticks_per_sample\": {\"median\": %.4f, \"p10\": %.4f, "
+				       "\"p90\": %.4f, \"min\": %.4f}}",
+				       bFirst ? "" : ",\n", sGen[g], sApi[a],
+				       ns.dMedian, ns.dP10, ns.dP90, ns.dMin,
+				       ticks.dMedian, ticks.dP10, ticks.dP90, ticks.dMin);
+			}
+			else if (iFormat == 2)
+				printf("%s,%s,%s,%zu,%d,%.4f,%.4f,%.4f,%.4f,%.4f,%.4f,%.4f,%.4f\n",
+				       sGen[g], sApi[a], sIsa, nSamples, nRuns,
+				       ns.dMedian, ns.dP10, ns.dP90, ns.dMin,
+				       ticks.dMedian, ticks.dP10, ticks.dP90, ticks.dMin);
+			else
+				printf("%-15s%-18s %9.3f %9.3f %9.3f %9.2f\n", sGen[g], sApi[a],
+				       ns.dMedian, ns.dP10, ns.dP90, ticks.dMedian);
+			fflush(stdout);
+			bFirst = 0;
+		}
+	}
+
+	if (iFormat == 1)
+		printf("\n  ]\n}\n");
+	else if (iFormat == 0)
+		printf("--------------------------------------------------------------------------\n");
+
+	free(pBuf);
+	free(pRan);
+
+	return 0;
+}
@@ -0,0 +1,262 @@
+/*
+
+test_bulk.c
+
+Check that the bulk generation routines (DRanUVec, U32RanUVec, U64RanUVec,
+DRanNormalZigVec, FRanUVec, FRanNormalZigVec) give arrays that are 
+identical to those obtained by successive calls to the scalar functions 
+(DRanU, U32RanU, U64RanU, DRanNormalZig, FRanU, FRanNormalZig), for every
+uniform RNG and every ziggurat variant, and compare their speed.
+
+For the multi-lane Xoshiro256+ engines, also check the lane layout: number
+k*L + l of the output stream is the k-th number of lane l, which is the 
+scalar Xoshiro256+ advanced by l jumps of 2^128 steps.
+
+For the multi-lane Xoshiro256+ engines and Philox4x32-10, check that the 
+SIMD kernels of all instruction sets supported by the CPU (RanSetIsa) give
+the same output.
+
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <inttypes.h>
+#include <string.h>
+
+#include "randommw.h"
+
+#define NGEN 8
+#define NSAMPLES 1000000
+#define NREPS 100
+
+static const char *sGen[NGEN] = {"MWC8222", "Lehmer64", "PCG64DXSM",
+                                 "Xoshiro256+", "MELG19937",
+                                 "Xoshiro256+x4", "Xoshiro256+x8",
+                                 "Philox4x32-10"};
+static const char *sZig[6] = {"ZIGNOR1", "ZIGNORW", "ZIGNOR1W", "ZIGNORX",
+                              "ZIGNOR1WX", "MCFARLAND"};
+static const char *sIsa[3] = {"SCALAR", "AVX2", "AVX512"};
+
+uint64_t xoshiro256p_next(void);
+void xoshiro256p_jump(void);
+
+/* number of mismatches between the L-lane engine and L scalar Xoshiro256+ */
+static int check_lanes(const char *sRan, unsigned int L, uint64_t *uvec,
+                       uint64_t zigseed, uint64_t jumpsize)
+{
+	unsigned int k, l, nsteps = NSAMPLES / L;
+	int nfail = 0;
+	
+	RanInit(sRan, zigseed, jumpsize);
+	U64RanUVec(uvec, nsteps * L);
+	for (l = 0; l < L; l++)
+	{
+		RanInit("Xoshiro256+", zigseed, jumpsize);
+		for (k = 0; k < l; k++)
+			xoshiro256p_jump();
+		for (k = 0; k < nsteps; k++)
+			nfail += (uvec[k * L + l] != xoshiro256p_next());
+	}
+	return nfail;
+}
+
+/* number of mismatches between the instruction sets, or -1 if sIsaTest is
+   not supported */
+static int check_isa(const char *sRan, const char *sIsaTest, double *dref, 
+                     double *dvec, uint64_t *uref, uint64_t *uvec,
+                     uint64_t zigseed, uint64_t jumpsize)
+{
+	unsigned int i, k;
+	int nfail = 0;
+	
+	for (k = 0; k < 3; k++)
+	{
+		RanInit(sRan, zigseed, jumpsize);
+		RanSetIsa("SCALAR");
+		RanSetZig((k == 0) ? "ZIGNOR" : sZig[k - 1]);
+		DRanNormalZigVec(dref, NSAMPLES);
+		U64RanUVec(uref, NSAMPLES);
+		RanInit(sRan, zigseed, jumpsize);
+		RanSetIsa(sIsaTest);
+		if (strcmp(RanGetIsa(), sIsaTest) != 0)
+			return -1;
+		RanSetZig((k == 0) ? "ZIGNOR" : sZig[k - 1]);
+		DRanNormalZigVec(dvec, NSAMPLES);
+		U64RanUVec(uvec, NSAMPLES);
+		for (i = 0; i < NSAMPLES; i++)
+			nfail += (dvec[i] != dref[i]) + (uvec[i] != uref[i]);
+	}
+	RanSetZig("ZIGNOR");
+	RanInit(sRan, zigseed, jumpsize);
+	RanSetIsa("SCALAR");
+	DRanUVec(dref, NSAMPLES);
+	RanInit(sRan, zigseed, jumpsize);
+	RanSetIsa(sIsaTest);
+	DRanUVec(dvec, NSAMPLES);
+	for (i = 0; i < NSAMPLES; i++)
+		nfail += (dvec[i] != dref[i]);
+	return nfail;
+}
+
+int main(void)
+{
+	double *dref, *dvec;
+	float *fref, *fvec, *fref2, *fvec2;
+	uint64_t *uref, *uvec;
+	unsigned int i, j, k;
+	uint64_t zigseed = 12345;
+	uint64_t jumpsize = 1;
+	int nfail, nfailtot = 0;
+	
+	dref = malloc(sizeof(double) * NSAMPLES);
+	dvec = malloc(sizeof(double) * NSAMPLES);
+	uref = malloc(sizeof(uint64_t) * NSAMPLES);
+	uvec = malloc(sizeof(uint64_t) * NSAMPLES);
+	fref = malloc(sizeof(float) * NSAMPLES);
+	fvec = malloc(sizeof(float) * NSAMPLES);
+	fref2 = malloc(sizeof(float) * NSAMPLES);
+	fvec2 = malloc(sizeof(float) * NSAMPLES);
+
+	printf("identity of bulk and scalar generation\n");
+	for (j = 0; j < NGEN; j++)
+	{
+		nfail = 0;
+		
+		// scalar reference: normals, uniform doubles, uint32, uint64
+		RanInit(sGen[j], zigseed, jumpsize);
+		for (i = 0; i < NSAMPLES; i++)
+			dref[i] = DRanNormalZig();
+		for (i = 0; i < NSAMPLES; i++)
+			uref[i] = U64RanU();
+		
+		RanInit(sGen[j], zigseed, jumpsize);
+		DRanNormalZigVec(dvec, NSAMPLES);
+		U64RanUVec(uvec, NSAMPLES);
+		for (i = 0; i < NSAMPLES; i++)
+			nfail += (dvec[i] != dref[i]) + (uvec[i] != uref[i]);
+		
+		RanInit(sGen[j], zigseed, jumpsize);
+		for (i = 0; i < NSAMPLES; i++)
+			dref[i] = DRanU();
+		for (i = 0; i < NSAMPLES; i++)
+			uref[i] = U32RanU();
+		
+		RanInit(sGen[j], zigseed, jumpsize);
+		DRanUVec(dvec, NSAMPLES);
+		U32RanUVec((uint32_t *)uvec, NSAMPLES);
+		for (i = 0; i < NSAMPLES; i++)
+			nfail += (dvec[i] != dref[i]) + 
+			         (((uint32_t *)uvec)[i] != (uint32_t)uref[i]);
+		
+		// arrays filled in several parts continue the same stream
+		RanInit(sGen[j], zigseed, jumpsize);
+		DRanNormalZigVec(dvec, 1);
+		DRanNormalZigVec(dvec + 1, 12345);
+		DRanNormalZigVec(dvec + 12346, NSAMPLES - 12346);
+		RanInit(sGen[j], zigseed, jumpsize);
+		for (i = 0; i < NSAMPLES; i++)
+			nfail += (dvec[i] != DRanNormalZig());
+		
+		// the other ziggurat variants
+		for (k = 0; k < 6; k++)
+		{
+			RanInit(sGen[j], zigseed, jumpsize);
+			RanSetZig(sZig[k]);
+			for (i = 0; i < NSAMPLES; i++)
+				dref[i] = DRanNormalZig();
+			RanInit(sGen[j], zigseed, jumpsize);
+			RanSetZig(sZig[k]);
+			DRanNormalZigVec(dvec, 7);
+			DRanNormalZigVec(dvec + 7, NSAMPLES - 7);
+			for (i = 0; i < NSAMPLES; i++)
+				nfail += (dvec[i] != dref[i]);
+		}
+		RanSetZig("ZIGNOR");
+		
+		// single precision, also starting with a pending 32-bit half
+		RanInit(sGen[j], zigseed, jumpsize);
+		for (i = 0; i < NSAMPLES; i++)
+			fref[i] = FRanU();
+		for (i = 0; i < NSAMPLES; i++)
+			fref2[i] = FRanNormalZig();
+		RanInit(sGen[j], zigseed, jumpsize);
+		FRanUVec(fvec, 1);
+		FRanUVec(fvec + 1, NSAMPLES - 1);
+		FRanNormalZigVec(fvec2, 3);
+		FRanNormalZigVec(fvec2 + 3, NSAMPLES - 3);
+		for (i = 0; i < NSAMPLES; i++)
+			nfail += (fvec[i] != fref[i]) + (fvec2[i] != fref2[i]);
+		
+		printf("%-14s %s\n", sGen[j], (nfail == 0) ? "OK" : "FAILED");
+		nfailtot += nfail;
+	}
+	
+	printf("\nlane layout of multi-lane Xoshiro256+\n");
+	nfail = check_lanes("Xoshiro256+x4", 4, uvec, zigseed, jumpsize);
+	printf("%-14s %s\n", "Xoshiro256+x4", (nfail == 0) ? "OK" : "FAILED");
+	nfailtot += nfail;
+	nfail = check_lanes("Xoshiro256+x8", 8, uvec, zigseed, jumpsize);
+	printf("%-14s %s\n", "Xoshiro256+x8", (nfail == 0) ? "OK" : "FAILED");
+	nfailtot += nfail;
+	
+	printf("\ninstruction sets of multi-lane Xoshiro256+ and Philox4x32-10\n");
+	for (j = 5; j < NGEN; j++)
+		for (k = 1; k < 3; k++)
+		{
+			nfail = check_isa(sGen[j], sIsa[k], dref, dvec, uref, uvec,
+			                  zigseed, jumpsize);
+			printf("%-14s %-7s %s\n", sGen[j], sIsa[k], (nfail < 0) ? 
+			       "not supported" : (nfail == 0) ? "OK" : "FAILED");
+			nfailtot += (nfail > 0) ? nfail : 0;
+		}
+	RanSetIsa("");
+	
+	printf("\ntimings for %d x %d uniform variates\n", NREPS, NSAMPLES);
+	for (j = 0; j < NGEN; j++)
+	{
+		RanInit(sGen[j], zigseed, jumpsize);
+		printf("%-14s", sGen[j]);
+		StartTimer();
+		for (k = 0; k < NREPS; k++)
+			for (i = 0; i < NSAMPLES; i++)
+				dref[i] = DRanU();
+		StopTimer();
+		printf("   scalar %10s", GetLapsedTime());
+		StartTimer();
+		for (k = 0; k < NREPS; k++)
+			DRanUVec(dvec, NSAMPLES);
+		StopTimer();
+		printf("   bulk %10s\n", GetLapsedTime());
+	}
+	
+	printf("\ntimings for %d x %d normal variates\n", NREPS, NSAMPLES);
+	for (j = 0; j < NGEN; j++)
+	{
+		RanInit(sGen[j], zigseed, jumpsize);
+		printf("%-14s", sGen[j]);
+		StartTimer();
+		for (k = 0; k < NREPS; k++)
+			for (i = 0; i < NSAMPLES; i++)
+				dref[i] = DRanNormalZig();
+		StopTimer();
+		printf("   scalar %10s", GetLapsedTime());
+		StartTimer();
+		for (k = 0; k < NREPS; k++)
+			DRanNormalZigVec(dvec, NSAMPLES);
+		StopTimer();
+		printf("   bulk %10s\n", GetLapsedTime());
+	}
+	
+	free(dref);
+	free(dvec);
+	free(uref);
+	free(uvec);
+	free(fref);
+	free(fvec);
+	free(fref2);
+	free(fvec2);
+
+	printf("\n%d mismatches\n", nfailtot);
+
+	return (nfailtot != 0);
+}
@@ -0,0 +1,214 @@
+/*
+
+test_cpp.cpp
+
+Check the C++ engine classes of randommw.hpp against the C API.
+
+- every engine satisfies std::uniform_random_bit_generator
+- operator() gives the stream of U64RanU, and zignor_normal<Engine> that of
+  DRanNormalZig, for the same seed and number of jumps, also for the
+  ziggurats selected with RanSetZig
+- discard(n), jump(n) and set_stream(uId, uStep) give the streams of
+  RanAdvanceRan, RanJumpRan and RanSetStream
+- in asynchronous mode, zignor_normal and uniform() read the stream of the
+  producer (RANASYNC_NORMAL, RANASYNC_UNIFORM), operator() and the other
+  draws abort (checked in a child process, on POSIX systems only), and
+  discard() stops the asynchronous mode
+- the engines work with the distributions of <random>
+
+Without POSIX threads (or with RANDOMMW_NO_THREADS), the asynchronous
+mode is not supported, and its checks are skipped.
+
+*/
+
+#include <cstdio>
+#include <concepts>
+#include <random>
+#if defined(__unix__) || defined(__APPLE__)
+#include <csignal>
+#include <unistd.h>
+#include <sys/wait.h>
+#define CHECK_MISUSE 1
+#endif
+
+#include "randommw.hpp"
+
+#define NCMP 100000
+#define NZIG 3
+
+static const char *sZig[NZIG] = {"ZIGNOR1W", "ZIGNORX", "MCFARLAND"};
+
+static_assert(std::uniform_random_bit_generator<randommw::xoshiro256p>);
+static_assert(std::uniform_random_bit_generator<randommw::pcg64dxsm>);
+static_assert(std::uniform_random_bit_generator<randommw::mwc8222>);
+static_assert(std::uniform_random_bit_generator<randommw::lehmer64>);
+static_assert(std::uniform_random_bit_generator<randommw::melg19937>);
+static_assert(std::uniform_random_bit_generator<randommw::philox4x32>);
+
+static RANSTATE s_ranRef;
+
+/* number of mismatches between the engine and the C API */
+template <class Engine>
+static int check_engine(uint64_t zigseed, uint64_t jumpsize)
+{
+	static Engine e;
+	randommw::zignor_normal<Engine> normal;
+	const char *sRan = Engine::kernel_type::sRan;
+	int i, k, nfail = 0;
+
+	e.seed(zigseed, jumpsize);
+	RanInit_r(&s_ranRef, sRan, zigseed, jumpsize);
+	for (i = 0; i < NCMP; i++)
+		nfail += (e() != U64RanU_r(&s_ranRef));
+	for (i = 0; i < NCMP; i++)
+		nfail += (normal(e) != DRanNormalZig_r(&s_ranRef));
+	for (i = 0; i < NCMP; i++)
+		nfail += (e.uniform() != DRanU_r(&s_ranRef));
+	for (k = 0; k < NZIG; k++)
+	{
+		RanSetZig_r(e.state(), sZig[k]);
+		RanSetZig_r(&s_ranRef, sZig[k]);
+		for (i = 0; i < NCMP; i++)
+			nfail += (normal(e) != DRanNormalZig_r(&s_ranRef));
+	}
+	RanSetZig_r(e.state(), "ZIGNOR");
+	RanSetZig_r(&s_ranRef, "ZIGNOR");
+
+	e.discard(12345);
+	RanAdvanceRan_r(&s_ranRef, 12345);
+	for (i = 0; i < NCMP; i++)
+		nfail += (e() != U64RanU_r(&s_ranRef));
+
+	e.jump(3);
+	RanJumpRan_r(&s_ranRef, 3);
+	for (i = 0; i < NCMP; i++)
+		nfail += (e() != U64RanU_r(&s_ranRef));
+
+	e.set_stream(17, 4);
+	RanSetStream_r(&s_ranRef, 17, 4);
+	for (i = 0; i < NCMP; i++)
+		nfail += (e() != U64RanU_r(&s_ranRef));
+
+	printf("%-14s %s\n", sRan, (nfail == 0) ? "OK" : "FAILED");
+	return nfail;
+}
+
+/* number of mismatches between the engine in asynchronous mode and the
+   synchronous C API, and 1 if discard() does not stop the asynchronous
+   mode; -1 if the asynchronous mode is not supported */
+static int check_async(uint64_t zigseed)
+{
+	static randommw::xoshiro256p e;
+	randommw::zignor_normal<randommw::xoshiro256p> normal;
+	int i, nfail = 0;
+
+	e.seed(zigseed);
+	RanInit_r(&s_ranRef, "Xoshiro256+", zigseed, 0);
+	if (RanAsyncStart_r(e.state(), RANASYNC_NORMAL, 0, -1) != 0)
+		return -1;
+	for (i = 0; i < NCMP; i++)
+		nfail += (normal(e) != DRanNormalZig_r(&s_ranRef));
+	RanAsyncStop_r(e.state(), NULL);
+
+	e.seed(zigseed);
+	RanInit_r(&s_ranRef, "Xoshiro256+", zigseed, 0);
+	RanAsyncStart_r(e.state(), RANASYNC_UNIFORM, 0, -1);
+	for (i = 0; i < NCMP; i++)
+		nfail += (e.uniform() != DRanU_r(&s_ranRef));
+	e.discard(1);
+	nfail += (e.state()->pAsync != NULL);
+	return nfail;
+}
+
+#ifdef CHECK_MISUSE
+/* 1 if operator() or the draw of the other mode does not abort */
+static int check_misuse(int iKind, int bRaw)
+{
+	static randommw::xoshiro256p e;
+	randommw::zignor_normal<randommw::xoshiro256p> normal;
+	pid_t pid;
+	int status;
+
+	fflush(stdout);
+	pid = fork();
+	if (pid == 0)
+	{
+		if (freopen("/dev/null", "w", stderr) == NULL)
+			_exit(0);
+		e.seed(12345);
+		RanAsyncStart_r(e.state(), iKind, 0, -1);
+		if (bRaw)
+			e();
+		else if (iKind == RANASYNC_NORMAL)
+			e.uniform();
+		else
+			normal(e);
+		_exit(0);
+	}
+	if ((pid < 0) || (waitpid(pid, &status, 0) != pid))
+		return 1;
+	return !(WIFSIGNALED(status) && (WTERMSIG(status) == SIGABRT));
+}
+#endif
+
+int main(void)
+{
+	uint64_t zigseed = 12345;
+	uint64_t jumpsize = 1;
+	int nfailtot = 0;
+
+	printf("engines and the C API\n");
+	nfailtot += check_engine<randommw::mwc8222>(zigseed, jumpsize);
+	nfailtot += check_engine<randommw::lehmer64>(zigseed, jumpsize);
+	nfailtot += check_engine<randommw::pcg64dxsm>(zigseed, jumpsize);
+	nfailtot += check_engine<randommw::xoshiro256p>(zigseed, jumpsize);
+	nfailtot += check_engine<randommw::melg19937>(zigseed, jumpsize);
+	nfailtot += check_engine<randommw::philox4x32>(zigseed, jumpsize);
+
+	printf("\nasynchronous mode\n");
+	{
+		int nfail = check_async(zigseed);
+
+		printf("%-14s %s\n", "streams", (nfail < 0) ? "not supported" :
+		       (nfail == 0) ? "OK" : "FAILED");
+		if (nfail >= 0)
+		{
+			nfailtot += nfail;
+#ifdef CHECK_MISUSE
+			nfail = check_misuse(RANASYNC_NORMAL, 1) +
+			        check_misuse(RANASYNC_NORMAL, 0) +
+			        check_misuse(RANASYNC_UNIFORM, 1) +
+			        check_misuse(RANASYNC_UNIFORM, 0);
+			printf("%-14s %s\n", "mixed draws", (nfail == 0) ? "abort" : "FAILED");
+			nfailtot += nfail;
+#else
+			printf("%-14s %s\n", "mixed draws", "not tested");
+#endif
+		}
+		else
+			printf("%-14s %s\n", "mixed draws", "not supported");
+	}
+
+	printf("\n<random> distributions\n");
+	{
+		randommw::xoshiro256p e(zigseed);
+		std::uniform_int_distribution<int> dice(1, 6);
+		std::normal_distribution<double> normal(0.0, 1.0);
+		int i, nfail = 0;
+		double sum = 0.0;
+
+		for (i = 0; i < NCMP; i++)
+		{
+			int k = dice(e);
+			nfail += (k < 1) || (k > 6);
+			sum += normal(e);
+		}
+		nfail += (sum / NCMP > 0.02) || (sum / NCMP < -0.02);
+		printf("%-14s %s\n", "Xoshiro256+", (nfail == 0) ? "OK" : "FAILED");
+		nfailtot += nfail;
+	}
+
+	printf("\n%d mismatches\n", nfailtot);
+
+	return (nfailtot != 0);
+}
@@ -3,7 +3,7 @@
 test_jumps.c
 
 Test the speed of the long jump capability of the PRNGs.
-(Presently, only Xoshiro256+ and MELG19937 support this.)
+(All PRNGs support this; default Xoshiro256+.)
 
 
 Xoshiro256+ long jump corresponds to 2^192 calls to next()
@@ -17,7 +17,9 @@ Typical speed test results on Intel Core i7 (Windows 11, gcc, w64devkit, 2024)
 - 200000000 long jumps of Xoshiro256+ in  1'33.57
 - 1000000000 long jumps of Xoshiro256+ in  7'47.33
 
-(MELG19937 long jumps are considerably slower)
+(MELG19937 long jumps are considerably slower: about 0.7 ms for each 
+nonzero bit of Njumps below 2^11, using precomputed jump polynomials for
+2^256 * 2^j steps, see genmelgjump.c)
 
 */
 
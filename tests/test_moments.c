@@ -1,5 +1,6 @@
 #include <stdio.h>
 #include <stdlib.h>
+#include <string.h>
 #include <inttypes.h>
 
 #include "randommw.h"
@@ -9,9 +10,12 @@
  * Returns the raw moments of a Gaussian pseudorandom number generator.
  *
  *
- * This program takes 1 or 2 optional arguments: 
+ * This program takes 1, 2 or 3 optional arguments: 
  * - the random seed
  * - the underlying uniform random number generator
+ * - the ziggurat algorithm (ZIGNOR, ZIGNOR1, ..., see RanSetZig), or
+ *   EXPZIG for the raw moments of the exponential distribution (DRanExpZig),
+ *   or FLOAT for the single precision normal variates (FRanNormalZig)
  *
  *
  * Analysis of the raw moments of the generated numbers proceeds
@@ -41,6 +45,10 @@
 
 // utility functions
 
+double FRanNormalZigD(void) {
+    return FRanNormalZig();
+}
+
 int factorial(int n) {
     if (n<=1) return(1);
     else n=n*factorial(n-1);
@@ -66,6 +74,8 @@ int main(int argc, char *argv[])
 	int SeedZig;
 
 	int expected;
+	int bExp = 0;
+	double (*fnRan)(void) = DRanNormalZig;
 	
 	switch(argc)
 	{
@@ -82,6 +92,19 @@ int main(int argc, char *argv[])
 			printf("%s pseudo-random number generator selected.\n", argv[2]);
 			RanInit(argv[2], (uint64_t)SeedZig, 0);
 			break;
+		case 4:
+			SeedZig = atoi(argv[1]);
+			printf("%s pseudo-random number generator selected.\n", argv[2]);
+			RanInit(argv[2], (uint64_t)SeedZig, 0);
+			printf("%s ziggurat algorithm selected.\n", argv[3]);
+			bExp = (strcmp(argv[3], "EXPZIG") == 0);
+			if (bExp)
+				fnRan = DRanExpZig;
+			else if (strcmp(argv[3], "FLOAT") == 0)
+				fnRan = FRanNormalZigD;
+			else
+				RanSetZig(argv[3]);
+			break;
 		default:
 			printf("ERROR. Unexpected number of arguments\n");
 			return(1);
@@ -93,7 +116,7 @@ int main(int argc, char *argv[])
 	// Print the first numbers generated, for visual inspection
 	for (i = 0; i < PREPRINT; i++)
 	{
-		ran = DRanNormalZig();
+		ran = fnRan();
 		printf("%10.6f\n", ran);
 	}
 	
@@ -103,16 +126,20 @@ int main(int argc, char *argv[])
 	}
 
 	for (i=0; i<TRIALS; i++) {
-		val = DRanNormalZig();
+		val = fnRan();
 		for (j=0, x_j=val; j<NUM_RAW_MOMENTS; j++, x_j*=val) {
 			X[j] += x_j;
 		}
 	}
 
 	//Output moments
-	printf("Created %ld normally distributed pseudo-random numbers...\n", (long)TRIALS);
+	printf("Created %ld %s distributed pseudo-random numbers...\n", (long)TRIALS,
+	       bExp ? "exponentially" : "normally");
 	for (i=0; i<NUM_RAW_MOMENTS; i++) {
-		expected = ( (i+1)%2 == 0 ? double_factorial(i) : 0 );
+		if (bExp)
+			expected = factorial(i+1);
+		else
+			expected = ( (i+1)%2 == 0 ? double_factorial(i) : 0 );
 		printf("X%lu: %f (Expected %i)\n", i+1, X[i]/TRIALS, expected);	
 	}
 	return 0;
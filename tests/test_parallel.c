@@ -0,0 +1,126 @@
+/*
+
+test_parallel.c
+
+Check RanFillNormalParallel.
+
+- the array does not depend on the number of threads (RanSetThreads),
+  also with more threads than cores (NMANY)
+- chunk c of the array is the output of DRanNormalZigVec for the RNG
+  jumped c times (RanJumpRan) from its state, and the stream of the 
+  generator continues after (number of chunks) jumps
+- compare the speed with DRanNormalZigVec on a single thread
+
+Compiled with POSIX threads (test_parallel.exe) and with OpenMP
+(test_parallel_omp.exe).
+
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <inttypes.h>
+#include <string.h>
+
+#include "randommw.h"
+
+#define NGEN 8
+#define NSAMPLES 10000000
+#define NCHUNK 300000
+#define NCHUNKS ((NSAMPLES - 1) / NCHUNK + 1)
+#define NTIME 100000000
+#define NMANY 300
+
+static const char *sGen[NGEN] = {"MWC8222", "Lehmer64", "PCG64DXSM",
+                                 "Xoshiro256+", "MELG19937",
+                                 "Xoshiro256+x4", "Xoshiro256+x8",
+                                 "Philox4x32-10"};
+static const int anThreads[4] = {1, 2, 3, 8};
+
+/* number of mismatches between the chunks of dvec and the streams of
+   sRan with uJumpsize, jumped c times */
+static int check_chunks(const char *sRan, const double *dvec, double *dref,
+                        uint64_t zigseed, uint64_t jumpsize)
+{
+	static RANSTATE ran;
+	size_t c, i, m;
+	int nfail = 0;
+
+	for (c = 0; c < NCHUNKS; c++)
+	{
+		m = (NSAMPLES - c * NCHUNK < NCHUNK) ? NSAMPLES - c * NCHUNK : NCHUNK;
+		RanInit_r(&ran, sRan, zigseed, jumpsize);
+		RanJumpRan_r(&ran, c);
+		DRanNormalZigVec_r(&ran, dref, m);
+		for (i = 0; i < m; i++)
+			nfail += (dvec[c * NCHUNK + i] != dref[i]);
+	}
+	return nfail;
+}
+
+int main(void)
+{
+	static RANSTATE ran1, ran2;
+	double *dref, *dvec;
+	uint64_t zigseed = 12345;
+	uint64_t jumpsize = 1;
+	unsigned int i, j, k;
+	int nfail, nfailtot = 0;
+
+	dref = malloc(sizeof(double) * NSAMPLES);
+	dvec = malloc(sizeof(double) * NTIME);
+
+	printf("chunks and number of threads\n");
+	for (j = 0; j < NGEN; j++)
+	{
+		RanInit_r(&ran1, sGen[j], zigseed, jumpsize);
+		RanSetThreads(anThreads[0]);
+		RanFillNormalParallel_r(&ran1, dvec, NSAMPLES, NCHUNK);
+		nfail = check_chunks(sGen[j], dvec, dref, zigseed, jumpsize);
+		RanInit_r(&ran2, sGen[j], zigseed, jumpsize);
+		RanJumpRan_r(&ran2, NCHUNKS);
+		for (i = 0; i < 1000; i++)
+			nfail += (U64RanU_r(&ran1) != U64RanU_r(&ran2));
+		for (k = 1; k < 4; k++)
+		{
+			RanInit_r(&ran1, sGen[j], zigseed, jumpsize);
+			RanSetThreads(anThreads[k]);
+			RanFillNormalParallel_r(&ran1, dref, NSAMPLES, NCHUNK);
+			nfail += (memcmp(dref, dvec, sizeof(double) * NSAMPLES) != 0);
+		}
+		printf("%-14s %s\n", sGen[j], (nfail == 0) ? "OK" : "FAILED");
+		nfailtot += nfail;
+	}
+
+	/* many small chunks, one per thread */
+	RanInit_r(&ran1, "Xoshiro256+", zigseed, jumpsize);
+	RanSetThreads(1);
+	RanFillNormalParallel_r(&ran1, dvec, NSAMPLES, NSAMPLES / NMANY + 1);
+	RanInit_r(&ran2, "Xoshiro256+", zigseed, jumpsize);
+	RanSetThreads(NMANY);
+	RanFillNormalParallel_r(&ran2, dref, NSAMPLES, NSAMPLES / NMANY + 1);
+	nfail = (memcmp(dref, dvec, sizeof(double) * NSAMPLES) != 0);
+	for (i = 0; i < 1000; i++)
+		nfail += (U64RanU_r(&ran1) != U64RanU_r(&ran2));
+	printf("%d threads    %s\n", NMANY, (nfail == 0) ? "OK" : "FAILED");
+	nfailtot += nfail;
+	RanSetThreads(0);
+
+	printf("\ntimings for %d normal variates\n", NTIME);
+	RanInit("Xoshiro256+x8", zigseed, jumpsize);
+	memset(dvec, 0, sizeof(double) * NTIME); // page faults not timed
+	StartTimer();
+	DRanNormalZigVec(dvec, NTIME);
+	StopTimer();
+	printf("%-22s %10s\n", "DRanNormalZigVec", GetLapsedTime());
+	StartTimer();
+	RanFillNormalParallel(dvec, NTIME, 0);
+	StopTimer();
+	printf("%-22s %10s\n", "RanFillNormalParallel", GetLapsedTime());
+
+	free(dref);
+	free(dvec);
+
+	printf("\n%d mismatches\n", nfailtot);
+
+	return (nfailtot != 0);
+}
@@ -0,0 +1,205 @@
+/*
+
+test_philox.c
+
+Check the counter-based Philox4x32-10 generator.
+
+- philox4x32_10 reproduces the known-answer tests of Random123
+- the stream of Philox4x32-10 is the sequence of blocks philox4x32_10(key,
+  c), c = 0, 1, 2, ..., for every instruction set supported by the CPU
+- RanSetStream(uId, uStep) positions the generator at the block with
+  counter (0, uId, uStep)
+- for the other RNGs, which have no stream key, and for uId >= 2^32,
+  RanSetStream returns -1 and leaves the generator unchanged
+- the normal variates obtained for a set of particles and time steps do
+  not depend on the order in which they are generated
+
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <inttypes.h>
+#include <string.h>
+
+#include "randommw.h"
+
+#define NCMP 100000
+#define NPART 1000
+#define NSTEP 10
+#define NNORM 3
+
+static const char *sIsa[3] = {"SCALAR", "AVX2", "AVX512"};
+static const char *sRanOther[7] = {"MWC8222", "Lehmer64", "PCG64DXSM",
+	"Xoshiro256+", "Xoshiro256+x4", "Xoshiro256+x8", "MELG19937"};
+
+/* Random123 known-answer tests (kat_vectors): counter, key, output */
+static const uint32_t s_auKat[3][10] = {
+	{0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	 0x00000000, 0x00000000,
+	 0x6627e8d5, 0xe169c58d, 0xbc57ac4c, 0x9b00dbd8},
+	{0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+	 0xffffffff, 0xffffffff,
+	 0x408f276d, 0x41c83b0e, 0xa20bc7c6, 0x6d5451fd},
+	{0x243f6a88, 0x85a308d3, 0x13198a2e, 0x03707344,
+	 0xa4093822, 0x299f31d0,
+	 0xd16cfe09, 0x94fdcceb, 0x5001e420, 0x24126ea1}};
+
+/* the first number of the block with counter (c0, c1, c2, c3) */
+static uint64_t block_first(RANSTATE *pRan, uint32_t c0, uint32_t c1,
+                            uint32_t c2, uint32_t c3)
+{
+	uint32_t auCtr[4], auOut[4];
+
+	auCtr[0] = c0;
+	auCtr[1] = c1;
+	auCtr[2] = c2;
+	auCtr[3] = c3;
+	philox4x32_10(pRan->philox_key, auCtr, auOut);
+	return auOut[0] | ((uint64_t)auOut[1] << 32);
+}
+
+/* number of mismatches between the stream and the blocks of successive
+   counters (with a carry into word 1), or -1 if sIsaTest is not supported */
+static int check_stream(const char *sIsaTest, uint64_t *uvec,
+                        uint64_t zigseed)
+{
+	static RANSTATE ran;
+	uint32_t auCtr[4] = {0, 0, 0, 0}, auOut[4];
+	unsigned int i;
+	int nfail = 0;
+
+	RanInit_r(&ran, "Philox4x32-10", zigseed, 0);
+	RanSetIsa_r(&ran, sIsaTest);
+	if (strcmp(RanGetIsa_r(&ran), sIsaTest) != 0)
+		return -1;
+	auCtr[0] = 0xffffffff - NCMP / 4; // carry into word 1 halfway
+	RanSetStream_r(&ran, 0, 0);
+	RanAdvanceRan_r(&ran, 2 * (uint64_t)auCtr[0]);
+	U64RanUVec_r(&ran, uvec, NCMP);
+	for (i = 0; i < NCMP / 2; i++)
+	{
+		philox4x32_10(ran.philox_key, auCtr, auOut);
+		nfail += (uvec[2 * i] != (auOut[0] | ((uint64_t)auOut[1] << 32)));
+		nfail += (uvec[2 * i + 1] != (auOut[2] | ((uint64_t)auOut[3] << 32)));
+		if (++auCtr[0] == 0)
+			auCtr[1]++;
+	}
+	return nfail;
+}
+
+/* number of mismatches if RanSetStream does not return -1 or changes the
+   generator, for an RNG without stream key */
+static int check_nostream(const char *sRan, uint64_t zigseed)
+{
+	static RANSTATE ran, ranref;
+	int i, nfail;
+
+	RanInit_r(&ran, sRan, zigseed, 0);
+	RanInit_r(&ranref, sRan, zigseed, 0);
+	nfail = (RanSetStream_r(&ran, 1, 1) != -1);
+	for (i = 0; i < 1000; i++)
+		nfail += (U64RanU_r(&ran) != U64RanU_r(&ranref));
+	return nfail;
+}
+
+/* normal variates of particle uId at time step uStep */
+static void particle_normals(RANSTATE *pRan, uint64_t uId, uint64_t uStep,
+                             double *pdOut)
+{
+	int k;
+
+	RanSetStream_r(pRan, uId, uStep);
+	for (k = 0; k < NNORM; k++)
+		pdOut[k] = DRanNormalZig_r(pRan);
+}
+
+int main(void)
+{
+	static RANSTATE ran;
+	static double dref[NSTEP][NPART][NNORM], dout[NNORM];
+	uint64_t *uvec;
+	uint64_t zigseed = 12345;
+	uint32_t auOut[4];
+	unsigned int i, j, k, p, s;
+	int nfail, nfailtot = 0;
+
+	uvec = malloc(sizeof(uint64_t) * NCMP);
+
+	printf("Random123 known-answer tests\n");
+	for (j = 0; j < 3; j++)
+	{
+		philox4x32_10(s_auKat[j] + 4, s_auKat[j], auOut);
+		nfail = (memcmp(auOut, s_auKat[j] + 6, sizeof(auOut)) != 0);
+		printf("vector %u %21s %s\n", j, "", (nfail == 0) ? "OK" : "FAILED");
+		nfailtot += nfail;
+	}
+
+	printf("\nstream and blocks\n");
+	for (k = 0; k < 3; k++)
+	{
+		nfail = check_stream(sIsa[k], uvec, zigseed);
+		printf("%-30s %s\n", sIsa[k], (nfail < 0) ?
+		       "not supported" : (nfail == 0) ? "OK" : "FAILED");
+		nfailtot += (nfail > 0) ? nfail : 0;
+	}
+
+	printf("\nRanSetStream\n");
+	RanInit_r(&ran, "Philox4x32-10", zigseed, 0);
+	nfail = 0;
+	for (i = 0; i < 1000; i++)
+	{
+		nfail += (RanSetStream_r(&ran, 7 * i, 3 * i + ((uint64_t)i << 32)) != 0);
+		FRanU_r(&ran); // pending half is discarded by RanSetStream
+		RanSetStream_r(&ran, 7 * i, 3 * i + ((uint64_t)i << 32));
+		nfail += (U64RanU_r(&ran) != block_first(&ran, 0, 7 * i, 3 * i, i));
+	}
+	printf("%-30s %s\n", "counter (0, uId, uStep)", (nfail == 0) ? "OK" : "FAILED");
+	nfailtot += nfail;
+	RanInit_r(&ran, "Philox4x32-10", zigseed, 0);
+	RanSetStream_r(&ran, UINT32_MAX, 5);
+	nfail = (RanSetStream_r(&ran, (uint64_t)UINT32_MAX + 1, 5) != -1);
+	nfail += (RanSetStream_r(&ran, UINT64_MAX, 5) != -1);
+	nfail += (U64RanU_r(&ran) != block_first(&ran, 0, UINT32_MAX, 5, 0));
+	printf("%-30s %s\n", "uId >= 2^32", (nfail == 0) ? "-1, unchanged" : "FAILED");
+	nfailtot += nfail;
+	for (k = 0; k < 7; k++)
+	{
+		nfail = check_nostream(sRanOther[k], zigseed);
+		printf("%-30s %s\n", sRanOther[k], (nfail == 0) ? "-1, unchanged" : "FAILED");
+		nfailtot += nfail;
+	}
+
+	printf("\norder independence\n");
+	for (s = 0; s < NSTEP; s++)
+		for (p = 0; p < NPART; p++)
+			particle_normals(&ran, p, s, dref[s][p]);
+	nfail = 0;
+	for (s = NSTEP; s-- > 0; )
+		for (p = NPART; p-- > 0; )
+		{
+			particle_normals(&ran, p, s, dout);
+			for (k = 0; k < NNORM; k++)
+				nfail += (dout[k] != dref[s][p][k]);
+		}
+	printf("%-30s %s\n", "reverse order", (nfail == 0) ? "OK" : "FAILED");
+	nfailtot += nfail;
+	nfail = 0;
+	for (i = 0; i < NSTEP * NPART; i++)
+	{
+		// particles and steps in a scrambled order (7919 is prime)
+		j = (i * 7919) % (NSTEP * NPART);
+		s = j / NPART;
+		p = j % NPART;
+		particle_normals(&ran, p, s, dout);
+		for (k = 0; k < NNORM; k++)
+			nfail += (dout[k] != dref[s][p][k]);
+	}
+	printf("%-30s %s\n", "scrambled order", (nfail == 0) ? "OK" : "FAILED");
+	nfailtot += nfail;
+
+	free(uvec);
+
+	printf("\n%d mismatches\n", nfailtot);
+
+	return (nfailtot != 0);
+}
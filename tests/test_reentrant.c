@@ -0,0 +1,75 @@
+/*
+
+test_reentrant.c
+
+Check that random number streams from caller-owned generator states
+(RanInit_r, DRanU_r, U32RanU_r, DRanNormalZig_r) are identical to the
+streams obtained from the default generator (RanInit, DRanU, U32RanU,
+DRanNormalZig) with the same RNG, seed and jump size, and that several
+generator states used in an interleaved fashion do not influence each other.
+RanInit resets the ziggurat selected before with RanSetZig to ZIGNOR, as
+RanInit_r.
+
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <inttypes.h>
+
+#include "randommw.h"
+
+#define NGEN 5
+#define NSAMPLES 1000000
+
+static const char *sGen[NGEN] = {"MWC8222", "Lehmer64", "PCG64DXSM",
+                                 "Xoshiro256+", "MELG19937"};
+
+int main(void)
+{
+	RANSTATE ran[NGEN];
+	double *dref[NGEN];
+	uint32_t uref[NGEN];
+	unsigned int i, j;
+	uint64_t zigseed = 12345;
+	uint64_t jumpsize = 2;
+	int nfail = 0;
+
+	// reference streams from the default generator
+	for (j = 0; j < NGEN; j++)
+	{
+		dref[j] = malloc(sizeof(double) * NSAMPLES);
+		RanSetZig("MCFARLAND"); // reset by RanInit
+		RanInit(sGen[j], zigseed, jumpsize);
+		for (i = 0; i < NSAMPLES; i++)
+			dref[j][i] = (i % 3) ? DRanNormalZig() : DRanU();
+		uref[j] = U32RanU();
+	}
+
+	// interleaved streams from separate generator states
+	for (j = 0; j < NGEN; j++)
+		RanInit_r(&ran[j], sGen[j], zigseed, jumpsize);
+
+	for (i = 0; i < NSAMPLES; i++)
+	{
+		for (j = 0; j < NGEN; j++)
+		{
+			double val = (i % 3) ? DRanNormalZig_r(&ran[j]) : DRanU_r(&ran[j]);
+			if (val != dref[j][i])
+				nfail++;
+		}
+	}
+
+	for (j = 0; j < NGEN; j++)
+	{
+		uint32_t u = U32RanU_r(&ran[j]);
+		printf("%-12s %s\n", sGen[j], (u == uref[j]) ? "OK" : "FAILED");
+		if (u != uref[j])
+			nfail++;
+		free(dref[j]);
+	}
+
+	printf("\n%d mismatches in %d samples from %d generators\n",
+	       nfail, NSAMPLES, NGEN);
+
+	return (nfail != 0);
+}
@@ -7,7 +7,7 @@
 void TimerHeader() 
 {
 	printf("------------------------------------------------------------------------\n");
-	printf("%-30s%8s %22s %10s\n", "Name", "time", "mean", "reps");
+	printf("%-26s%9s %8s %20s %10s\n", "Name", "time (s)", "ns/rep", "mean", "reps");
 	printf("------------------------------------------------------------------------\n");
 }
 
@@ -20,27 +20,40 @@ void Timer(char *sName, double (*DRan)(), void (*DRanSeed)(uint64_t), unsigned i
 {
 	unsigned int i;
 	double ran, mean;
+	RANTIMER timer;
 	
-	printf("%-29s", sName);
+	printf("%-26s", sName);
 
 	(*DRanSeed)(17732);
 
-	StartTimer();
+	RanTimerStart(&timer);
 	for (i = 0, mean = 0.0; i < cM; ++i)
 	{
 		ran = (*DRan)();
 		mean += ran;
 	}
 	mean /= cM;
-	StopTimer();
+	RanTimerStop(&timer);
 
-	printf(" %8s %#22.15g %10d\n", GetLapsedTime(), mean, cM);
+	printf("%9.3f %8.3f %#20.13g %10d\n", RanTimerSeconds(&timer),
+	       1e9 * RanTimerSeconds(&timer) / cM, mean, cM);
+}
+
+
+double FRanNormalZigD(void)
+{
+	return FRanNormalZig();
 }
 
 
 int main(void) 
 {
 	unsigned int cm = 1000000000;
+	const char *asGen[5] = {"MWC8222", "Lehmer64", "PCG64DXSM", "Xoshiro256+",
+	                        "MELG19937"};
+	const char *asZig[4] = {"ZIGNOR1", "ZIGNORW", "ZIGNOR1W", "MCFARLAND"};
+	char sName[32];
+	int g, z;
 
 	TimerHeader();
 
@@ -82,6 +95,32 @@ int main(void)
 	RanInit("MWC8222", 0, 0);
 	Timer("ZIGNOR MWC8222 (again)",	DRanNormalZig, 			RanSetSeed, cm);
 
+	/* the other ziggurat algorithms, see RanSetZig */
+	for (z = 0; z < 4; z++)
+		for (g = 0; g < 5; g++)
+		{
+			RanInit(asGen[g], 0, 0);
+			RanSetZig(asZig[z]);
+			snprintf(sName, sizeof(sName), "%s %s", asZig[z], asGen[g]);
+			Timer(sName,	DRanNormalZig, 			RanSetSeed, cm);
+		}
+
+	/* single precision ziggurat */
+	for (g = 0; g < 5; g++)
+	{
+		RanInit(asGen[g], 0, 0);
+		snprintf(sName, sizeof(sName), "FLOAT %s", asGen[g]);
+		Timer(sName,	FRanNormalZigD, 		RanSetSeed, cm);
+	}
+
+	/* exponential ziggurat */
+	for (g = 0; g < 5; g++)
+	{
+		RanInit(asGen[g], 0, 0);
+		snprintf(sName, sizeof(sName), "EXPZIG %s", asGen[g]);
+		Timer(sName,	DRanExpZig, 			RanSetSeed, cm);
+	}
+
 	
 	/* Code snippet to see if the program indeed crashes gracefully if
 	 * wrong string passed to RanSetRan                          */
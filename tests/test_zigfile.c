@@ -0,0 +1,238 @@
+/*
+
+test_zigfile.c
+
+Check the genzignor file format (genzignor.h): write a file with header
+and samples, then memory-map it and check header, samples and checksum.
+Several threads then consume the samples through a shared cursor, and it
+is checked that every sample is handed out exactly once. Finally, a
+corrupted file, a file with an unknown element type (with a valid header
+checksum) and a truncated file must be rejected.
+
+Without memory mapping (ZIGFILE_MMAP, POSIX systems only), the file is
+read back with ZigFileReadHeader and fread instead, and the cursor is
+not tested.
+
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <inttypes.h>
+
+#include "randommw.h"
+#include "genzignor.h"
+
+#ifdef ZIGFILE_MMAP
+#include <pthread.h>
+#endif
+
+#define NSAMPLES 1000003
+#define NTHREADS 4
+#define SLICE 4099
+#define FNAME "test_zigfile.bin"
+
+#ifdef ZIGFILE_MMAP
+typedef struct
+{
+	ZIGFILECURSOR *pCur;
+	const double *pdFirst;
+	unsigned char *auCount;
+	uint64_t nSlices;
+} CONSUMER;
+
+static void *Consume(void *arg)
+{
+	CONSUMER *pCon = (CONSUMER *)arg;
+	const double *pd;
+	uint64_t i, n;
+
+	while ((pd = ZigFileCursorNext(pCon->pCur, SLICE, &n)) != NULL)
+	{
+		for (i = 0; i < n; i++)
+			pCon->auCount[(pd - pCon->pdFirst) + i]++;
+		pCon->nSlices++;
+	}
+	return NULL;
+}
+#else
+/* Read a file without memory mapping: 0 on success, the error of
+   ZigFileReadHeader, or -5 if the file is shorter than its header says */
+static int ReadFile(const char *sFile, ZIGFILEHEADER *pHdr, double *pd)
+{
+	FILE *fp;
+	int iErr;
+
+	fp = fopen(sFile, "rb");
+	if (fp == NULL)
+		return -1;
+	iErr = ZigFileReadHeader(fp, pHdr);
+	if ((iErr == 0) && 
+	    (fread(pd, sizeof(double), pHdr->uSamples, fp) != pHdr->uSamples))
+		iErr = -5;
+	fclose(fp);
+	return iErr;
+}
+#endif
+
+static int WriteFile(const char *sFile, const double *pd, uint64_t n,
+                     uint64_t nWrite, int bCorrupt, uint32_t uElemType)
+{
+	ZIGFILEHEADER hdr;
+	ZIGFILESUM sum;
+	FILE *fp;
+
+	ZigFileInitHeader(&hdr, "Xoshiro256+", 12345, 0, n, 0,
+	                  uElemType, ZIGFILE_NORMAL);
+	ZigFileSumInit(&sum);
+	ZigFileSumAdd(&sum, pd, n * sizeof(double));
+	hdr.uChecksum = ZigFileSumGet(&sum);
+
+	fp = fopen(sFile, "wb");
+	if (fp == NULL)
+		return -1;
+	ZigFileWriteHeader(fp, &hdr);
+	fwrite(pd, sizeof(double), nWrite, fp);
+	if (bCorrupt)
+	{
+		fseek(fp, 80, SEEK_SET);	// sample count
+		fputc(0x55, fp);
+	}
+	fclose(fp);
+	return 0;
+}
+
+int main(void)
+{
+	double *dref;
+	int iErr, nfail = 0;
+#ifdef ZIGFILE_MMAP
+	const double *pd;
+	unsigned char *auCount;
+	uint64_t i, n, nSlices = 0;
+	ZIGFILEMAP map;
+	ZIGFILECURSOR cur;
+	CONSUMER con[NTHREADS];
+	pthread_t threads[NTHREADS];
+	int t;
+#else
+	ZIGFILEHEADER hdr;
+	double *dvec;
+#endif
+
+	dref = malloc(sizeof(double) * NSAMPLES);
+	RanInit("Xoshiro256+", 12345, 0);
+	DRanNormalZigVec(dref, NSAMPLES);
+
+#ifdef ZIGFILE_MMAP
+	// write, map and check
+	WriteFile(FNAME, dref, NSAMPLES, NSAMPLES, 0, ZIGFILE_FLOAT64);
+	iErr = ZigFileMap(&map, FNAME, ZIGFILE_ADV_SEQUENTIAL | ZIGFILE_ADV_HUGEPAGE);
+	printf("map                 : %s\n", (iErr == 0) ? "OK" : "FAILED");
+	if (iErr != 0)
+		return 1;
+
+	pd = ZigFileDoubles(&map, &n);
+	iErr = (pd == NULL) || (n != NSAMPLES) || (ZigFileFloats(&map, &n) != NULL)
+	       || (((uintptr_t)pd & 4095) != 0) || (strcmp(map.hdr.acRan, "Xoshiro256+") != 0)
+	       || (map.hdr.uSeed != 12345);
+	printf("header              : %s\n", iErr ? "FAILED" : "OK");
+	nfail += iErr;
+
+	pd = ZigFileDoubles(&map, &n);
+	iErr = (memcmp(pd, dref, sizeof(double) * NSAMPLES) != 0);
+	printf("samples             : %s\n", iErr ? "FAILED" : "OK");
+	nfail += iErr;
+
+	iErr = (ZigFileVerify(&map.hdr, map.pData) != 0);
+	printf("checksum            : %s\n", iErr ? "FAILED" : "OK");
+	nfail += iErr;
+
+	// several consumers sharing a cursor
+	auCount = calloc(NSAMPLES, 1);
+	ZigFileCursorInit(&cur, &map, 0);
+	for (t = 0; t < NTHREADS; t++)
+	{
+		con[t].pCur = &cur;
+		con[t].pdFirst = pd;
+		con[t].auCount = auCount;
+		con[t].nSlices = 0;
+		pthread_create(&threads[t], NULL, Consume, &con[t]);
+	}
+	for (t = 0; t < NTHREADS; t++)
+	{
+		pthread_join(threads[t], NULL);
+		nSlices += con[t].nSlices;
+	}
+	iErr = (nSlices != (NSAMPLES + SLICE - 1) / SLICE);
+	for (i = 0; i < NSAMPLES; i++)
+		iErr |= (auCount[i] != 1);
+	printf("cursor              : %s\n", iErr ? "FAILED" : "OK");
+	nfail += iErr;
+	free(auCount);
+	ZigFileUnmap(&map);
+
+	// corrupted header and truncated file
+	WriteFile(FNAME, dref, NSAMPLES, NSAMPLES, 1, ZIGFILE_FLOAT64);
+	iErr = (ZigFileMap(&map, FNAME, ZIGFILE_ADV_NORMAL) != -3);
+	printf("corrupt header      : %s\n", iErr ? "FAILED" : "OK");
+	nfail += iErr;
+
+	WriteFile(FNAME, dref, NSAMPLES, NSAMPLES, 0, 7);
+	iErr = (ZigFileMap(&map, FNAME, ZIGFILE_ADV_NORMAL) != -3);
+	printf("element type        : %s\n", iErr ? "FAILED" : "OK");
+	nfail += iErr;
+
+	WriteFile(FNAME, dref, NSAMPLES, NSAMPLES - 1, 0, ZIGFILE_FLOAT64);
+	iErr = (ZigFileMap(&map, FNAME, ZIGFILE_ADV_NORMAL) != -5);
+	printf("truncated file      : %s\n", iErr ? "FAILED" : "OK");
+	nfail += iErr;
+#else
+	// write, read back and check
+	dvec = malloc(sizeof(double) * NSAMPLES);
+	WriteFile(FNAME, dref, NSAMPLES, NSAMPLES, 0, ZIGFILE_FLOAT64);
+	iErr = ReadFile(FNAME, &hdr, dvec);
+	printf("read                : %s\n", (iErr == 0) ? "OK" : "FAILED");
+	if (iErr != 0)
+		return 1;
+
+	iErr = (hdr.uSamples != NSAMPLES) || (hdr.uElemType != ZIGFILE_FLOAT64)
+	       || (strcmp(hdr.acRan, "Xoshiro256+") != 0) || (hdr.uSeed != 12345);
+	printf("header              : %s\n", iErr ? "FAILED" : "OK");
+	nfail += iErr;
+
+	iErr = (memcmp(dvec, dref, sizeof(double) * NSAMPLES) != 0);
+	printf("samples             : %s\n", iErr ? "FAILED" : "OK");
+	nfail += iErr;
+
+	iErr = (ZigFileVerify(&hdr, dvec) != 0);
+	printf("checksum            : %s\n", iErr ? "FAILED" : "OK");
+	nfail += iErr;
+
+	printf("cursor              : not supported\n");
+
+	// corrupted header and truncated file
+	WriteFile(FNAME, dref, NSAMPLES, NSAMPLES, 1, ZIGFILE_FLOAT64);
+	iErr = (ReadFile(FNAME, &hdr, dvec) != -3);
+	printf("corrupt header      : %s\n", iErr ? "FAILED" : "OK");
+	nfail += iErr;
+
+	WriteFile(FNAME, dref, NSAMPLES, NSAMPLES, 0, 7);
+	iErr = (ReadFile(FNAME, &hdr, dvec) != -3);
+	printf("element type        : %s\n", iErr ? "FAILED" : "OK");
+	nfail += iErr;
+
+	WriteFile(FNAME, dref, NSAMPLES, NSAMPLES - 1, 0, ZIGFILE_FLOAT64);
+	iErr = (ReadFile(FNAME, &hdr, dvec) != -5);
+	printf("truncated file      : %s\n", iErr ? "FAILED" : "OK");
+	nfail += iErr;
+	free(dvec);
+#endif
+
+	remove(FNAME);
+	free(dref);
+
+	printf("\n%d failures\n", nfail);
+
+	return (nfail != 0);
+}
@@ -0,0 +1,153 @@
+/*
+
+test_zigstats.c
+
+Ziggurat path statistics for all RNGs, using the instrumentation that is
+enabled by compiling with RANDOMMW_ZIGSTATS defined. For each RNG, the
+fractions of normal variates obtained from the rectangles, the wedges and
+the tail are given, together with the number of uniform random numbers
+drawn and of exp() evaluations per normal variate. This is done for ZIGNOR
+and its variants ZIGNOR1, ZIGNORW, ZIGNOR1W, ZIGNORX and ZIGNOR1WX, and for
+McFarland's modified ziggurat (see RanSetZig). For the latter, "wedge" 
+refers to the overhangs.
+
+It is checked that the counters are consistent, and that the bulk routine
+DRanNormalZigVec takes exactly the same paths as DRanNormalZig.
+
+*/
+
+#ifndef RANDOMMW_ZIGSTATS
+#define RANDOMMW_ZIGSTATS
+#endif
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <inttypes.h>
+
+#include "randommw.h"
+
+#define NGEN 8
+#define NSAMPLES 10000000
+#define NZIG 7
+
+static const char *sGen[NGEN] = {"MWC8222", "Lehmer64", "PCG64DXSM",
+                                 "Xoshiro256+", "MELG19937",
+                                 "Xoshiro256+x4", "Xoshiro256+x8",
+                                 "Philox4x32-10"};
+static const char *sZig[NZIG] = {"ZIGNOR", "ZIGNOR1", "ZIGNORW", "ZIGNOR1W",
+                                 "ZIGNORX", "ZIGNOR1WX", "MCFARLAND"};
+static const int aiZig[NZIG] = {RANZIG_ZIGNOR, RANZIG_ZIGNOR1, RANZIG_ZIGNORW,
+                                RANZIG_ZIGNOR1W, RANZIG_ZIGNORX, 
+                                RANZIG_ZIGNOR1WX, RANZIG_MCFARLAND};
+
+int main(void)
+{
+	RANSTATE *pRan;
+	RANZIGSTATS st, stv;
+	double *pd;
+	uint64_t uIter, uWedge, uBase;
+	unsigned int i, j, z;
+	int iZig, iErr, nfail = 0;
+
+	pRan = malloc(sizeof(*pRan));
+	pd = malloc(sizeof(double) * NSAMPLES);
+
+	printf("%u normal variates per RNG\n", NSAMPLES);
+
+	for (z = 0; z < NZIG; z++)
+	{
+		printf("\n%s\n", sZig[z]);
+		printf("--------------------------------------------------------------------------------\n");
+		printf("%-15s %9s %9s %9s %9s %9s %8s %7s\n", "RNG", "rect %", "wedge %",
+		       "w.rej %", "tail %", "it/tail", "draws/N", "exp/N");
+		printf("--------------------------------------------------------------------------------\n");
+
+		iZig = aiZig[z];
+		for (j = 0; j < NGEN; j++)
+		{
+			RanInit_r(pRan, sGen[j], 0, 0);
+			RanSetZig_r(pRan, sZig[z]);
+			for (i = 0; i < NSAMPLES; i++)
+				DRanNormalZig_r(pRan);
+			RanZigStatsGet_r(pRan, &st);
+
+			RanInit_r(pRan, sGen[j], 0, 0);
+			RanSetZig_r(pRan, sZig[z]);
+			DRanNormalZigVec_r(pRan, pd, NSAMPLES);
+			RanZigStatsGet_r(pRan, &stv);
+
+			// every pass through the ziggurat loop draws one double and one
+			// uint32 (ZIGNOR) or a single uint64 (ZIGNOR1), the wedge test 
+			// one more double; the ZIGNOR wedge test evaluates exp() twice,
+			// the table-driven one (W) at most once; each tail iteration
+			// takes two uniform doubles, or two exponential variates (X), 
+			// which draw a varying number of uint64 and doubles
+			uIter = st.uRectAccept + st.uWedgeAccept + st.uWedgeReject + st.uTail;
+			uWedge = st.uWedgeAccept + st.uWedgeReject;
+			uBase = ((iZig & RANZIG_ZIGNOR1) ? 0 : uIter) + uWedge;
+			iErr = (st.uNormals != NSAMPLES)
+			       || (st.uNormals != st.uRectAccept + st.uWedgeAccept + st.uTail)
+			       || (memcmp(&st, &stv, sizeof(st)) != 0);
+			if (iZig == RANZIG_MCFARLAND)
+			{
+				// one uint64 per variate, one more for the alias table 
+				// outside the rectangles, two per overhang trial, and the
+				// exponential variates of the tail
+				uBase = 2 * st.uNormals - st.uRectAccept + 2 * uWedge;
+				iErr |= (st.uU32Ran != 0) || (st.uExpZig != 2 * st.uTailIter)
+				        || (st.uU64Ran < uBase + st.uExpZig)
+				        || ((st.uTail == 0) && (st.uU64Ran != uBase))
+				        || (st.uExp > uWedge);
+			}
+			else
+			{
+				if (iZig & RANZIG_ZIGNOR1)
+					iErr |= (st.uU32Ran != 0);
+				else
+					iErr |= (st.uU32Ran != uIter);
+				if (iZig & RANZIG_ZIGNORX)
+				{
+					iErr |= (st.uExpZig != 2 * st.uTailIter)
+					        || (st.uDRan < uBase)
+					        || (st.uU64Ran < ((iZig & RANZIG_ZIGNOR1) ? uIter : 0)
+					                         + st.uExpZig);
+				}
+				else
+				{
+					iErr |= (st.uExpZig != 0)
+					        || (st.uDRan != uBase + 2 * st.uTailIter)
+					        || (st.uU64Ran != ((iZig & RANZIG_ZIGNOR1) ? uIter : 0));
+					if (iZig & RANZIG_ZIGNORW)
+						iErr |= (st.uExp > uWedge);
+					else
+						iErr |= (st.uExp != 2 * uWedge);
+				}
+			}
+
+			printf("%-15s %9.4f %9.4f %9.4f %9.4f %9.4f %8.5f %7.5f %s\n", sGen[j],
+			       100.0 * st.uRectAccept / st.uNormals,
+			       100.0 * st.uWedgeAccept / st.uNormals,
+			       100.0 * st.uWedgeReject / st.uNormals,
+			       100.0 * st.uTail / st.uNormals,
+			       (double)st.uTailIter / st.uTail,
+			       (double)(st.uDRan + st.uU32Ran + st.uU64Ran) / st.uNormals,
+			       (double)st.uExp / st.uNormals,
+			       iErr ? "FAILED" : "OK");
+			nfail += iErr;
+		}
+		printf("--------------------------------------------------------------------------------\n");
+	}
+
+	// reset
+	RanZigStatsReset_r(pRan);
+	RanZigStatsGet_r(pRan, &st);
+	iErr = (st.uNormals != 0) || (st.uDRan != 0);
+	printf("reset: %s\n", iErr ? "FAILED" : "OK");
+	nfail += iErr;
+
+	free(pd);
+	free(pRan);
+
+	return (nfail != 0);
+}